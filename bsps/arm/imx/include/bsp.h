@@ -59,6 +59,12 @@ extern uintptr_t imx_gic_dist_base;
 
 void arm_generic_timer_get_config(uint32_t *frequency, uint32_t *irq);
 
+#if ARM_GENERIC_TIMER_USE_ONE_SHOT != 0 && !defined(RTEMS_SMP)
+void *Clock_driver_tickless_idle_body(uintptr_t ignored);
+
+#define BSP_IDLE_TASK_BODY Clock_driver_tickless_idle_body
+#endif
+
 void *imx_get_reg_of_node(const void *fdt, int node);
 
 int imx_iomux_configure_pins(const void *fdt, uint32_t phandle);
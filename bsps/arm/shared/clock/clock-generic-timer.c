@@ -32,8 +32,18 @@
  *
  * The BSP may optionally define ARM_GENERIC_TIMER_USE_VIRTUAL in <bsp.h> to
  * use the virtual timer instead of the physical timer.
+ *
+ * The BSP may optionally define ARM_GENERIC_TIMER_USE_ONE_SHOT in <bsp.h> to a
+ * value other than zero to use the one-shot clock event mode of the clock
+ * driver shell in uniprocessor configurations.  In this case, the BSP should
+ * use Clock_driver_tickless_idle_body() as the BSP_IDLE_TASK_BODY.
  */
 
+#if defined(ARM_GENERIC_TIMER_USE_ONE_SHOT) \
+  && ARM_GENERIC_TIMER_USE_ONE_SHOT != 0 && !defined(RTEMS_SMP)
+#define CLOCK_DRIVER_USE_ONE_SHOT
+#endif
+
 typedef struct {
   struct timecounter tc;
   uint32_t interval;
@@ -81,6 +91,7 @@ static inline void arm_gt_clock_set_control(uint32_t ctl)
 #endif
 }
 
+#ifndef CLOCK_DRIVER_USE_ONE_SHOT
 static void arm_gt_clock_at_tick(void)
 {
   uint64_t cval;
@@ -94,6 +105,7 @@ static void arm_gt_clock_at_tick(void)
   arm_gt_clock_set_control(0x1);
 #endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
 }
+#endif
 
 static void arm_gt_clock_handler_install(void)
 {
@@ -198,8 +210,32 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_FIRST
 );
 
+#ifdef CLOCK_DRIVER_USE_ONE_SHOT
+static void arm_gt_clock_set_one_shot(sbintime_t delta)
+{
+  uint64_t cval;
+
+  cval = arm_gt_clock_get_count();
+  cval += ((uint64_t) delta * arm_gt_clock_instance.tc.tc_frequency) >> 32;
+  arm_gt_clock_set_compare_value(cval);
+  arm_gt_clock_set_control(0x1);
+}
+
+static void arm_gt_clock_idle_wait(void)
+{
+  /* The WFI instruction wakes up on a pending interrupt even if masked */
+  __asm__ volatile ("wfi" : : : "memory");
+}
+
+#define Clock_driver_support_set_one_shot(delta) \
+  arm_gt_clock_set_one_shot(delta)
+
+#define Clock_driver_support_idle_wait() \
+  arm_gt_clock_idle_wait()
+#else
 #define Clock_driver_support_at_tick() \
   arm_gt_clock_at_tick()
+#endif
 
 #define Clock_driver_support_initialize_hardware() \
   arm_gt_clock_initialize()
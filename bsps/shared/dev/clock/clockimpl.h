@@ -23,6 +23,7 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems/score/watchdogimpl.h>
 
 #ifdef Clock_driver_nanoseconds_since_last_tick
@@ -41,6 +42,44 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if defined(CLOCK_DRIVER_USE_ONE_SHOT)
+  #if defined(RTEMS_SMP)
+    #error "The one-shot clock event mode is not supported in SMP configurations"
+  #endif
+
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK \
+    || defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER)
+    #error "The one-shot clock event mode requires a timecounter and one ISR per event"
+  #endif
+
+  #ifndef Clock_driver_support_set_one_shot
+    #error "The one-shot clock event mode requires Clock_driver_support_set_one_shot()"
+  #endif
+
+  #ifndef Clock_driver_support_idle_wait
+    #error "The one-shot clock event mode requires Clock_driver_support_idle_wait()"
+  #endif
+
+  /**
+   * @brief The maximum interval of a one-shot clock event in sbintime units.
+   *
+   * It must be less than the wrap around period of the timecounter.  The
+   * default is 125ms.
+   */
+  #ifndef CLOCK_DRIVER_ONE_SHOT_MAXIMUM
+    #define CLOCK_DRIVER_ONE_SHOT_MAXIMUM ( (sbintime_t) 1 << 29 )
+  #endif
+
+  /**
+   * @brief The minimum interval of a one-shot clock event in sbintime units.
+   *
+   * The default is about 1us.
+   */
+  #ifndef CLOCK_DRIVER_ONE_SHOT_MINIMUM
+    #define CLOCK_DRIVER_ONE_SHOT_MINIMUM ( (sbintime_t) 1 << 12 )
+  #endif
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -113,6 +152,231 @@ static void Clock_driver_timecounter_tick( void )
  */
 volatile uint32_t    Clock_driver_ticks;
 
+#if defined(CLOCK_DRIVER_USE_ONE_SHOT)
+/*
+ * In the one-shot clock event mode, the clock event is programmed for each
+ * event.  The watchdog ticks are derived from the timecounter, so the clock
+ * events do not have to be aligned to the tick boundaries.  While the
+ * processor is idle, the clock event is programmed to the next watchdog
+ * expiration and the skipped ticks are processed once the processor wakes up.
+ */
+
+/**
+ * @brief The tick interval in sbintime units.
+ */
+static sbintime_t Clock_driver_tick_interval;
+
+/**
+ * @brief The uptime in sbintime units associated with a zero watchdog ticks
+ * value.
+ */
+static sbintime_t Clock_driver_tick_base;
+
+static sbintime_t Clock_driver_watchdog_to_sbintime( uint64_t expire )
+{
+  uint64_t nsec;
+
+  nsec = expire & ( ( UINT64_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 );
+
+  /* Round up, so that the watchdog is expired at the clock event */
+  return ( (sbintime_t) ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) << 32 )
+    + (sbintime_t) ( ( ( nsec << 32 ) + 999999999 ) / 1000000000 );
+}
+
+static void Clock_driver_one_shot_init( void )
+{
+  Clock_driver_tick_interval = (sbintime_t) (
+    ( ( (uint64_t) rtems_configuration_get_nanoseconds_per_tick() << 32 )
+      + 999999999 ) / 1000000000
+  );
+  Clock_driver_tick_base = _Timecounter_Sbinuptime()
+    - (sbintime_t) _Per_CPU_Get()->Watchdog.ticks * Clock_driver_tick_interval;
+}
+
+/*
+ * Processes the ticks which passed according to the timecounter.  In case no
+ * tick passed, then only the nanoseconds based watchdogs are serviced.  The
+ * interrupts are disabled only for one tick at a time, so that a long idle
+ * period does not result in a long interrupt latency.  A clock interrupt
+ * during the catch up processes the remaining ticks itself.
+ */
+static void Clock_driver_one_shot_catch_up( sbintime_t now )
+{
+  Per_CPU_Control *cpu;
+  uint64_t         ticks;
+  ISR_Level        level;
+
+  cpu = _Per_CPU_Get();
+  ticks = (uint64_t) ( ( now - Clock_driver_tick_base )
+    / Clock_driver_tick_interval );
+
+  _ISR_Local_disable( level );
+
+  if ( cpu->Watchdog.ticks < ticks ) {
+    do {
+      Clock_driver_timecounter_tick();
+      _ISR_Local_enable( level );
+      _ISR_Local_disable( level );
+    } while ( cpu->Watchdog.ticks < ticks );
+  } else {
+    _Watchdog_Tickle_clocks( cpu );
+  }
+
+  _ISR_Local_enable( level );
+}
+
+static sbintime_t Clock_driver_one_shot_next_event(
+  Per_CPU_Control *cpu,
+  sbintime_t       now,
+  bool             idle
+)
+{
+  ISR_lock_Context lock_context;
+  struct bintime   boottime;
+  sbintime_t       next;
+  uint64_t         ticks;
+  uint64_t         expire;
+
+  if ( idle ) {
+    next = now + CLOCK_DRIVER_ONE_SHOT_MAXIMUM;
+  } else {
+    next = Clock_driver_tick_base
+      + (sbintime_t) ( cpu->Watchdog.ticks + 1 ) * Clock_driver_tick_interval;
+  }
+
+  _Timecounter_Getboottimebin( &boottime );
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  ticks = cpu->Watchdog.ticks;
+  expire = _Watchdog_Header_next_expiration(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+  );
+
+  if ( expire != WATCHDOG_MAXIMUM_TICKS ) {
+    /*
+     * An already expired watchdog is serviced by the next tick.  Check this
+     * before the interval is computed, since the ticks are unsigned.
+     */
+    if ( expire <= ticks ) {
+      expire = ticks + 1;
+    }
+  }
+
+  if (
+    expire != WATCHDOG_MAXIMUM_TICKS
+      && expire - ticks
+        <= (uint64_t) ( CLOCK_DRIVER_ONE_SHOT_MAXIMUM
+          / Clock_driver_tick_interval ) + 1
+  ) {
+    sbintime_t candidate;
+
+    candidate = Clock_driver_tick_base
+      + (sbintime_t) expire * Clock_driver_tick_interval;
+
+    if ( candidate < next ) {
+      next = candidate;
+    }
+  }
+
+  expire = _Watchdog_Header_next_expiration(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  );
+
+  if ( expire != WATCHDOG_MAXIMUM_TICKS ) {
+    sbintime_t candidate;
+
+    candidate = Clock_driver_watchdog_to_sbintime( expire );
+
+    if ( candidate < next ) {
+      next = candidate;
+    }
+  }
+
+  expire = _Watchdog_Header_next_expiration(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  );
+
+  if ( expire != WATCHDOG_MAXIMUM_TICKS ) {
+    sbintime_t candidate;
+
+    candidate = Clock_driver_watchdog_to_sbintime( expire )
+      - ( ( (sbintime_t) boottime.sec << 32 )
+        + (sbintime_t) ( boottime.frac >> 32 ) );
+
+    if ( candidate < next ) {
+      next = candidate;
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return next;
+}
+
+static void Clock_driver_one_shot_program( sbintime_t next )
+{
+  sbintime_t delta;
+
+  delta = next - _Timecounter_Sbinuptime();
+
+  if ( delta < CLOCK_DRIVER_ONE_SHOT_MINIMUM ) {
+    delta = CLOCK_DRIVER_ONE_SHOT_MINIMUM;
+  }
+
+  Clock_driver_support_set_one_shot( delta );
+}
+
+/**
+ * @brief Idle body which stops the clock ticks while the processor is idle.
+ *
+ * A BSP using the one-shot clock event mode may use this function as
+ * BSP_IDLE_TASK_BODY.  The clock event is programmed to the next watchdog
+ * expiration, then Clock_driver_support_idle_wait() waits with interrupts
+ * disabled until an interrupt is pending.  The interrupts are enabled before
+ * the skipped ticks are processed.  So, interrupt service routines other than
+ * the clock interrupt may observe an outdated watchdog ticks value.
+ */
+void *Clock_driver_tickless_idle_body( uintptr_t ignored );
+
+void *Clock_driver_tickless_idle_body( uintptr_t ignored )
+{
+  (void) ignored;
+
+  while ( true ) {
+    Per_CPU_Control *cpu_self;
+    ISR_Level        level;
+    sbintime_t       now;
+
+    cpu_self = _Thread_Dispatch_disable();
+    _ISR_Local_disable( level );
+
+    if ( !cpu_self->dispatch_necessary ) {
+      now = _Timecounter_Sbinuptime();
+      Clock_driver_one_shot_program(
+        Clock_driver_one_shot_next_event( cpu_self, now, true )
+      );
+
+      Clock_driver_support_idle_wait();
+      _ISR_Local_enable( level );
+
+      now = _Timecounter_Sbinuptime();
+      Clock_driver_one_shot_catch_up( now );
+
+      _ISR_Local_disable( level );
+      Clock_driver_one_shot_program(
+        Clock_driver_one_shot_next_event( cpu_self, now, false )
+      );
+    }
+
+    _ISR_Local_enable( level );
+    _Thread_Dispatch_enable( cpu_self );
+  }
+
+  return NULL;
+}
+#endif
+
 #ifdef Clock_driver_support_shutdown_hardware
 #error "Clock_driver_support_shutdown_hardware() is no longer supported"
 #endif
@@ -167,6 +431,18 @@ rtems_isr Clock_isr(
 
       Clock_driver_support_at_tick();
     }
+  #elif defined(CLOCK_DRIVER_USE_ONE_SHOT)
+    {
+      sbintime_t now;
+
+      Clock_driver_support_at_tick();
+
+      now = _Timecounter_Sbinuptime();
+      Clock_driver_one_shot_catch_up( now );
+      Clock_driver_one_shot_program(
+        Clock_driver_one_shot_next_event( _Per_CPU_Get(), now, false )
+      );
+    }
   #else
     /*
      *  Do the hardware specific per-tick action.
@@ -219,6 +495,14 @@ void _Clock_Initialize( void )
    */
   Clock_driver_support_initialize_hardware();
 
+  #if defined(CLOCK_DRIVER_USE_ONE_SHOT)
+    Clock_driver_one_shot_init();
+    Clock_driver_one_shot_program(
+      Clock_driver_tick_base + Clock_driver_tick_interval
+        * (sbintime_t) ( _Per_CPU_Get()->Watchdog.ticks + 1 )
+    );
+  #endif
+
   /*
    *  If we are counting ISRs per tick, then initialize the counter.
    */
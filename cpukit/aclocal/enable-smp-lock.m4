@@ -0,0 +1,9 @@
+AC_DEFUN([RTEMS_ENABLE_SMP_LOCK],
+  [AC_ARG_ENABLE(smp-lock,
+    [AS_HELP_STRING([--enable-smp-lock=ALGORITHM],[select the SMP lock algorithm, either ticket or mcs (default=ticket)])],
+    [case "${enableval}" in
+      ticket) RTEMS_SMP_LOCK=ticket ;;
+      mcs) RTEMS_SMP_LOCK=mcs ;;
+      *) AC_MSG_ERROR(bad value ${enableval} for enable smp-lock option) ;;
+    esac],
+    [RTEMS_SMP_LOCK=ticket])])
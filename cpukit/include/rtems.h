@@ -36,6 +36,7 @@
 #include <rtems/rtems/tasks.h>
 #include <rtems/rtems/intr.h>
 #include <rtems/rtems/barrier.h>
+#include <rtems/rtems/rwlock.h>
 #include <rtems/rtems/cache.h>
 #include <rtems/rtems/clock.h>
 #include <rtems/extension.h>
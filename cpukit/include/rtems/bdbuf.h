@@ -47,7 +47,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using a hash table.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -61,7 +61,14 @@ extern "C" {
  * descriptors allocated so all the buffer memory can be used as minimum sized
  * buffers.
  *
- * The cache is a single pool of buffers.  The buffer memory is divided into
+ * The cache is divided into one or more partitions, see the
+ * CONFIGURE_BDBUF_CACHE_PARTITIONS configuration option.  Each disk device
+ * uses exactly one partition.  The partitions are assigned to the disk devices
+ * in a round-robin order.  A partition has its own buffers, lists, hash table
+ * and lock, so accesses to disk devices of different partitions do not
+ * serialize.  A disk device can only use the buffers of its partition.
+ *
+ * A partition is a single pool of buffers.  The buffer memory is divided into
  * groups where the size of buffer memory allocated to a group is the maximum
  * buffer size.  A group's memory can be divided down into small buffer sizes
  * that are a multiple of 2 of the minimum buffer size.  A group is the minimum
@@ -132,11 +139,11 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
- * If the block is to be read by the user and not in the cache it is transfered
- * from the disk into memory.  If no buffers are on the LRU list the modified
- * list is checked.  If buffers are on the modified the swap out task will be
- * woken.  The request blocks until a buffer is available for recycle.
+ * assigned to a block and inserted to the hash table based on the block/device
+ * key.  If the block is to be read by the user and not in the cache it is
+ * transfered from the disk into memory.  If no buffers are on the LRU list the
+ * modified list is checked.  If buffers are on the modified the swap out task
+ * will be woken.  The request blocks until a buffer is available for recycle.
  *
  * A block being accessed is given to the file system layer and not accessible
  * to another requester until released back to the cache.  The same goes to a
@@ -181,11 +188,11 @@ extern "C" {
  * @brief State of a buffer of the cache.
  *
  * The state has several implications.  Depending on the state a buffer can be
- * in the AVL tree, in a list, in use by an entity and a group user or not.
+ * in the hash table, in a list, in use by an entity and a group user or not.
  *
  * <table>
  *   <tr>
- *     <th>State</th><th>Valid Data</th><th>AVL Tree</th>
+ *     <th>State</th><th>Valid Data</th><th>Hash Table</th>
  *     <th>LRU List</th><th>Modified List</th><th>Synchronization List</th>
  *     <th>Group User</th><th>External User</th>
  *   </tr>
@@ -302,20 +309,15 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
+ * speed-up buffer lookup descriptors are organized in a hash table. The fields
  * 'dd' and 'block' are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
+  struct rtems_bdbuf_buffer* hash_next; /**< Next BD in the hash table
+                                         * bucket. */
 
   rtems_disk_device *dd;        /**< disk device */
 
@@ -334,6 +336,11 @@ typedef struct rtems_bdbuf_buffer
 
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
+
+  uint32_t accesses;             /**< Count of accesses since the block was
+                                  * assigned to the buffer.  It saturates at
+                                  * two and is used by the replacement
+                                  * policy. */
 } rtems_bdbuf_buffer;
 
 /**
@@ -354,6 +361,26 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * Buffer replacement policies of the cache.
+ */
+typedef enum {
+  /**
+   * The least recently used cached buffer is recycled.
+   */
+  RTEMS_BDBUF_REPLACEMENT_POLICY_LRU,
+
+  /**
+   * Simplified 2Q replacement policy.  Blocks accessed once since they
+   * entered the cache are kept on a probation list.  Blocks accessed again
+   * while they are cached move to the protected LRU list.  Buffers are
+   * recycled from the probation list as long as it holds more than a quarter
+   * of the buffers.  This prevents sequential scans of large files from
+   * evicting frequently used blocks, for example file system meta-data.
+   */
+  RTEMS_BDBUF_REPLACEMENT_POLICY_2Q
+} rtems_bdbuf_replacement_policy;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -383,6 +410,10 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  rtems_bdbuf_replacement_policy replacement_policy; /**< Buffer replacement
+                                                      * policy. */
+  size_t              partitions;              /**< Number of cache
+                                                * partitions. */
 } rtems_bdbuf_config;
 
 /**
@@ -455,6 +486,17 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default buffer replacement policy.
+ */
+#define RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT \
+  RTEMS_BDBUF_REPLACEMENT_POLICY_LRU
+
+/**
+ * Default number of cache partitions.
+ */
+#define RTEMS_BDBUF_CACHE_PARTITIONS_DEFAULT 1
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -464,6 +506,8 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  * @retval RTEMS_CALLED_FROM_ISR Called from an interrupt context.
  * @retval RTEMS_INVALID_NUMBER The buffer maximum is not an integral multiple
  * of the buffer minimum.  The maximum read-ahead blocks count is too large.
+ * The partition count is zero or greater than the count of maximum size
+ * buffers.
  * @retval RTEMS_RESOURCE_IN_USE Already initialized.
  * @retval RTEMS_UNSATISFIED Not enough resources.
  */
@@ -190,6 +190,19 @@ static inline void rtems_blkdev_request_done(
 #define RTEMS_BLKIO_GETDEVSTATS     _IOR('B', 11, rtems_blkdev_stats *)
 #define RTEMS_BLKIO_RESETDEVSTATS   _IO('B', 12)
 
+/**
+ * @brief Returns the queue depth of the disk device.
+ *
+ * The queue depth is the count of transfer requests the driver can process
+ * in parallel.  The read-ahead of the cache issues up to this count of
+ * requests to a physical disk without waiting for their completion.  On a
+ * disk with a queue depth greater than one, the read-ahead of a read miss
+ * starts while the driver reads the missed block and the swapout workers
+ * write up to this count of requests in parallel.  A driver which does not
+ * support this IO control has a queue depth of one.
+ */
+#define RTEMS_BLKIO_GETQUEUEDEPTH   _IOR('B', 13, uint32_t)
+
 /** @} */
 
 static inline int rtems_disk_fd_get_media_block_size(
@@ -249,6 +262,14 @@ static inline int rtems_disk_fd_reset_device_stats(int fd)
   return ioctl(fd, RTEMS_BLKIO_RESETDEVSTATS);
 }
 
+static inline int rtems_disk_fd_get_queue_depth(
+  int fd,
+  uint32_t *queue_depth
+)
+{
+  return ioctl(fd, RTEMS_BLKIO_GETQUEUEDEPTH, queue_depth);
+}
+
 /**
  * @name Block Device Driver Capabilities
  */
@@ -732,7 +732,7 @@ rtems_capture_record_extract (const void* rec, void* data, size_t size)
  * @param[in] tcb is the task control block for the task
  */
 static inline bool rtems_capture_task_recorded (rtems_tcb* tcb) {
-  return ((tcb->Capture.flags & RTEMS_CAPTURE_RECORD_TASK) != 0);
+  return ((tcb->Cold->Capture.flags & RTEMS_CAPTURE_RECORD_TASK) != 0);
 }
 
 /**
@@ -744,7 +744,7 @@ static inline bool rtems_capture_task_recorded (rtems_tcb* tcb) {
  * @param[in] tcb is the task control block for the task
  */
 static inline bool rtems_capture_task_initialized (rtems_tcb* tcb) {
-  return ((tcb->Capture.flags & RTEMS_CAPTURE_INIT_TASK) != 0);
+  return ((tcb->Cold->Capture.flags & RTEMS_CAPTURE_INIT_TASK) != 0);
 }
 
 /**
@@ -823,7 +823,7 @@ rtems_capture_task_name (rtems_tcb* tcb)
 static inline uint32_t
 rtems_capture_task_flags (rtems_tcb* tcb)
 {
-  return tcb->Capture.flags;
+  return tcb->Cold->Capture.flags;
 }
 
 /**
@@ -838,7 +838,7 @@ rtems_capture_task_flags (rtems_tcb* tcb)
 static inline rtems_capture_control*
 rtems_capture_task_control (rtems_tcb* tcb)
 {
-  return tcb->Capture.control;
+  return tcb->Cold->Capture.control;
 }
 
 /**
@@ -853,7 +853,7 @@ rtems_capture_task_control (rtems_tcb* tcb)
 static inline uint32_t
 rtems_capture_task_control_flags (rtems_tcb* tcb)
 {
-  rtems_capture_control*  control = tcb->Capture.control;
+  rtems_capture_control*  control = tcb->Cold->Capture.control;
   if (!control)
     return 0;
   return control->flags;
@@ -874,7 +874,7 @@ static inline rtems_task_priority
 rtems_capture_task_start_priority (rtems_tcb* tcb)
 {
   return _RTEMS_Priority_From_core (_Thread_Scheduler_get_home( tcb ),
-                                    tcb->Start.initial_priority);
+                                    tcb->Cold->Start.initial_priority);
 }
 
 /**
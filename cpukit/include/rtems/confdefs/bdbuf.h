@@ -115,6 +115,16 @@
     RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
 #endif
 
+#ifndef CONFIGURE_BDBUF_REPLACEMENT_POLICY
+  #define CONFIGURE_BDBUF_REPLACEMENT_POLICY \
+    RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_CACHE_PARTITIONS
+  #define CONFIGURE_BDBUF_CACHE_PARTITIONS \
+    RTEMS_BDBUF_CACHE_PARTITIONS_DEFAULT
+#endif
+
 #define _CONFIGURE_LIBBLOCK_TASKS \
   ( 1 + CONFIGURE_SWAPOUT_WORKER_TASKS \
     + ( CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS != 0 ) )
@@ -141,7 +151,9 @@ const rtems_bdbuf_config rtems_bdbuf_configuration = {
   CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
   CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
   CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+  CONFIGURE_BDBUF_REPLACEMENT_POLICY,
+  CONFIGURE_BDBUF_CACHE_PARTITIONS
 };
 
 #ifdef __cplusplus
@@ -45,10 +45,15 @@
 #include <rtems/confdefs/bsp.h>
 
 #if defined(CONFIGURE_MALLOC_BSP_SUPPORTS_SBRK) \
-  || defined(CONFIGURE_MALLOC_DIRTY)
+  || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_PER_PROCESSOR_CACHE)
 #include <rtems/malloc.h>
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_PROCESSOR_CACHE
+#include <rtems/confdefs/percpu.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,6 +68,23 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_PROCESSOR_CACHE
+  #ifndef CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE
+    #define CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE 16
+  #endif
+
+  #if CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE <= 0
+    #error "CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE must be positive"
+  #endif
+
+  static Malloc_Cache _Malloc_Caches[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  const Malloc_Cache_configuration _Malloc_Cache_configuration = {
+    CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE,
+    &_Malloc_Caches[ 0 ]
+  };
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -70,6 +70,10 @@
   #include <rtems/rtems/regiondata.h>
 #endif
 
+#if CONFIGURE_MAXIMUM_RWLOCKS > 0
+  #include <rtems/rtems/rwlockdata.h>
+#endif
+
 #if CONFIGURE_MAXIMUM_SEMAPHORES > 0
   #include <rtems/confdefs/scheduler.h>
   #include <rtems/rtems/semdata.h>
@@ -107,6 +111,10 @@ extern "C" {
   REGION_INFORMATION_DEFINE( CONFIGURE_MAXIMUM_REGIONS );
 #endif
 
+#if CONFIGURE_MAXIMUM_RWLOCKS > 0
+  RWLOCK_INFORMATION_DEFINE( CONFIGURE_MAXIMUM_RWLOCKS );
+#endif
+
 #if CONFIGURE_MAXIMUM_SEMAPHORES > 0
   SEMAPHORE_INFORMATION_DEFINE(
     CONFIGURE_MAXIMUM_SEMAPHORES,
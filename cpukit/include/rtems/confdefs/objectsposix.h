@@ -44,6 +44,7 @@
 
 #ifdef CONFIGURE_INIT
 
+#include <rtems/confdefs/percpu.h>
 #include <rtems/confdefs/threads.h>
 #include <rtems/confdefs/wkspacesupport.h>
 #include <rtems/config.h>
@@ -115,6 +116,14 @@ extern "C" {
 
   const uint32_t _POSIX_Keys_Key_value_pair_maximum =
     CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS;
+
+  #ifdef CONFIGURE_POSIX_KEYS_PER_PROCESSOR_CACHE
+    static Freechain_Cache
+    _POSIX_Keys_Keypool_cache_table[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+    Freechain_Cache * const _POSIX_Keys_Keypool_caches =
+      &_POSIX_Keys_Keypool_cache_table[ 0 ];
+  #endif
 #endif
 
 #if CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES > 0
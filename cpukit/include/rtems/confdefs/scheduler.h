@@ -47,12 +47,14 @@
 #if !defined(CONFIGURE_SCHEDULER_CBS) \
   && !defined(CONFIGURE_SCHEDULER_EDF) \
   && !defined(CONFIGURE_SCHEDULER_EDF_SMP) \
+  && !defined(CONFIGURE_SCHEDULER_EDF_PARTITIONED_SMP) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) \
   && !defined(CONFIGURE_SCHEDULER_STRONG_APA) \
+  && !defined(CONFIGURE_SCHEDULER_STRONG_APA_INDEXED) \
   && !defined(CONFIGURE_SCHEDULER_USER)
   #if defined(RTEMS_SMP) && _CONFIGURE_MAXIMUM_PROCESSORS > 1
     #define CONFIGURE_SCHEDULER_EDF_SMP
@@ -156,6 +158,23 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_STRONG_APA_INDEXED
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'I', 'A', 'P', 'A' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER \
+      RTEMS_SCHEDULER_STRONG_APA_INDEXED( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1 \
+      )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_STRONG_APA_INDEXED( dflt, CONFIGURE_SCHEDULER_NAME )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_SIMPLE
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'U', 'P', 'S', ' ' )
@@ -209,6 +228,19 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_EDF_PARTITIONED_SMP
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'P', 'E', 'D', 'F' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER RTEMS_SCHEDULER_EDF_PARTITIONED_SMP( dflt )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_EDF_PARTITIONED_SMP( dflt, CONFIGURE_SCHEDULER_NAME )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_CBS
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'U', 'C', 'B', 'S' )
@@ -82,6 +82,15 @@
   #define CONFIGURE_MAXIMUM_THREAD_NAME_SIZE THREAD_DEFAULT_MAXIMUM_NAME_SIZE
 #endif
 
+#ifndef CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD
+  #define CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD \
+    THREAD_DEFAULT_BRWLOCK_READ_MAXIMUM
+#endif
+
+#ifndef CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT
+  #define CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -97,6 +106,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_EDF_SMP
     Scheduler_EDF_SMP_Node EDF_SMP;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_EDF_PARTITIONED_SMP
+    Scheduler_EDF_partitioned_SMP_Node EDF_partitioned_SMP;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_PRIORITY
     Scheduler_priority_Node Priority;
   #endif
@@ -112,6 +124,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_STRONG_APA
     Scheduler_strong_APA_Node Strong_APA;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_STRONG_APA_INDEXED
+    Scheduler_strong_APA_indexed_Node Strong_APA_indexed;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_USER_PER_THREAD
     CONFIGURE_SCHEDULER_USER_PER_THREAD User;
   #endif
@@ -123,6 +138,9 @@ typedef union {
 
 const size_t _Thread_Maximum_name_size = CONFIGURE_MAXIMUM_THREAD_NAME_SIZE;
 
+const size_t _Thread_BRWLock_read_maximum =
+  CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD;
+
 struct Thread_Configured_control {
   Thread_Control Control;
   #if CONFIGURE_MAXIMUM_USER_EXTENSIONS > 0
@@ -141,6 +159,12 @@ struct Thread_Configured_control {
   #else
     struct { /* Empty */ } Newlib;
   #endif
+  Thread_Cold_control Cold;
+  #if CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD > 0
+    struct CORE_BRWLock_Control *brwlocks_read[
+      CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD
+    ];
+  #endif
 };
 
 const Thread_Control_add_on _Thread_Control_add_ons[] = {
@@ -159,6 +183,9 @@ const Thread_Control_add_on _Thread_Control_add_ons[] = {
       Control.libc_reent
     ),
     offsetof( Thread_Configured_control, Newlib )
+  }, {
+    offsetof( Thread_Configured_control, Control.Cold ),
+    offsetof( Thread_Configured_control, Cold )
   }
   #if CONFIGURE_MAXIMUM_THREAD_NAME_SIZE > 1
     , {
@@ -169,6 +196,12 @@ const Thread_Control_add_on _Thread_Control_add_ons[] = {
       offsetof( Thread_Configured_control, name )
     }
   #endif
+  #if CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD > 0
+    , {
+      offsetof( Thread_Configured_control, Cold.brwlocks_read ),
+      offsetof( Thread_Configured_control, brwlocks_read )
+    }
+  #endif
   #ifdef RTEMS_POSIX_API
     , {
       offsetof(
@@ -191,6 +224,9 @@ const size_t _Thread_Control_add_on_count =
 
   const size_t _Thread_queue_Heads_size =
     sizeof( Thread_queue_Configured_heads );
+
+  const uint32_t _Thread_queue_Spin_limit =
+    CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT;
 #endif
 
 const size_t _Thread_Initial_thread_count =
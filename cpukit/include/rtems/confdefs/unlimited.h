@@ -101,6 +101,11 @@
     rtems_resource_unlimited( CONFIGURE_UNLIMITED_ALLOCATION_SIZE )
 #endif
 
+#ifndef CONFIGURE_MAXIMUM_RWLOCKS
+  #define CONFIGURE_MAXIMUM_RWLOCKS \
+    rtems_resource_unlimited( CONFIGURE_UNLIMITED_ALLOCATION_SIZE )
+#endif
+
 #ifndef CONFIGURE_MAXIMUM_POSIX_KEYS
   #define CONFIGURE_MAXIMUM_POSIX_KEYS \
     rtems_resource_unlimited( CONFIGURE_UNLIMITED_ALLOCATION_SIZE )
@@ -45,15 +45,62 @@
 #include <rtems/confdefs/bdbuf.h>
 #include <rtems/confdefs/inittask.h>
 #include <rtems/confdefs/initthread.h>
+#include <rtems/confdefs/objectsclassic.h>
 #include <rtems/confdefs/objectsposix.h>
 #include <rtems/confdefs/threads.h>
 #include <rtems/confdefs/wkspacesupport.h>
 #include <rtems/score/coremsg.h>
 #include <rtems/score/context.h>
+#include <rtems/score/heapimpl.h>
 #include <rtems/score/memory.h>
+#include <rtems/score/objectimpl.h>
 #include <rtems/score/stack.h>
+#include <rtems/score/stackpool.h>
 #include <rtems/sysinit.h>
 
+#ifdef CONFIGURE_TASK_STACK_POOL_MAXIMUM
+  #if defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_DEALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_ALLOCATOR_INIT) \
+    || defined(CONFIGURE_TASK_STACK_FROM_ALLOCATOR)
+    #error "CONFIGURE_TASK_STACK_POOL_MAXIMUM cannot be used together with a custom task stack allocator"
+  #endif
+
+  #ifndef CONFIGURE_TASK_STACK_POOL_STACK_SIZE
+    #define CONFIGURE_TASK_STACK_POOL_STACK_SIZE \
+      CONFIGURE_MINIMUM_TASK_STACK_SIZE
+  #endif
+
+  #ifndef CONFIGURE_TASK_STACK_POOL_GUARD_SIZE
+    #define CONFIGURE_TASK_STACK_POOL_GUARD_SIZE 0
+  #endif
+
+  #define CONFIGURE_TASK_STACK_ALLOCATOR_INIT _Stack_Pool_Initialize
+
+  #define CONFIGURE_TASK_STACK_ALLOCATOR _Stack_Pool_Allocate
+
+  #define CONFIGURE_TASK_STACK_DEALLOCATOR _Stack_Pool_Free
+
+  /*
+   * A stack of the pool stack size or less occupies a complete slab.  Each
+   * allocation has a header and a guard region.
+   */
+  #define CONFIGURE_TASK_STACK_FROM_ALLOCATOR( _stack_size ) \
+    _Configure_From_workspace( \
+      ( ( _stack_size ) > CONFIGURE_TASK_STACK_POOL_STACK_SIZE \
+          + CONTEXT_FP_SIZE ? \
+        ( _stack_size ) : \
+        CONFIGURE_TASK_STACK_POOL_STACK_SIZE + CONTEXT_FP_SIZE ) \
+      + _Configure_Align_up( \
+        sizeof( Stack_Pool_Header ), \
+        CPU_STACK_ALIGNMENT \
+      ) \
+      + _Configure_Align_up( \
+        CONFIGURE_TASK_STACK_POOL_GUARD_SIZE, \
+        CPU_STACK_ALIGNMENT \
+      ) )
+#endif
+
 #ifdef CONFIGURE_TASK_STACK_FROM_ALLOCATOR
   #define _Configure_From_stackspace( _stack_size ) \
     CONFIGURE_TASK_STACK_FROM_ALLOCATOR( _stack_size + CONTEXT_FP_SIZE )
@@ -73,6 +120,14 @@
     ( _messages ) * ( _Configure_Align_up( _size, sizeof( uintptr_t ) ) \
         + sizeof( CORE_message_queue_Buffer_control ) ) )
 
+#define CONFIGURE_MESSAGE_BUFFERS_FOR_RING_QUEUE( _messages, _size ) \
+  _Configure_From_workspace( \
+    sizeof( CORE_message_queue_Ring ) + CPU_CACHE_LINE_BYTES \
+      + ( _messages ) * _Configure_Align_up( \
+        offsetof( CORE_message_queue_Ring_slot, Contents.buffer ) \
+          + _Configure_Align_up( _size, sizeof( uintptr_t ) ), \
+        sizeof( uintptr_t ) ) )
+
 #ifndef CONFIGURE_MESSAGE_BUFFER_MEMORY
   #define CONFIGURE_MESSAGE_BUFFER_MEMORY 0
 #endif
@@ -86,11 +141,142 @@
  * into two parts so that we have a free block for the last allocation.  See
  * _Heap_Block_split().
  */
-#define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
-  _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
+#ifdef CONFIGURE_SEGREGATED_FIT_HEAPS
+  #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
+    ( _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT ) \
+      + _Configure_Align_up( sizeof( Heap_Segregated_index ), CPU_ALIGNMENT ) \
+      + CPU_ALIGNMENT )
+#else
+  #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
+    _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
+#endif
+
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  #define _Configure_Name_index( _maximum ) \
+    _Configure_From_workspace( OBJECTS_NAME_INDEX_SIZE( \
+      _Objects_Maximum_per_allocation( _maximum ) ) )
+
+  #if CONFIGURE_MAXIMUM_BARRIERS > 0
+    #define _CONFIGURE_NAME_INDEX_BARRIERS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_BARRIERS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_BARRIERS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_MESSAGE_QUEUES > 0
+    #define _CONFIGURE_NAME_INDEX_MESSAGE_QUEUES \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_MESSAGE_QUEUES )
+  #else
+    #define _CONFIGURE_NAME_INDEX_MESSAGE_QUEUES 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_PARTITIONS > 0
+    #define _CONFIGURE_NAME_INDEX_PARTITIONS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_PARTITIONS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_PARTITIONS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_PERIODS > 0
+    #define _CONFIGURE_NAME_INDEX_PERIODS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_PERIODS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_PERIODS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_PORTS > 0
+    #define _CONFIGURE_NAME_INDEX_PORTS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_PORTS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_PORTS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_REGIONS > 0
+    #define _CONFIGURE_NAME_INDEX_REGIONS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_REGIONS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_REGIONS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_RWLOCKS > 0
+    #define _CONFIGURE_NAME_INDEX_RWLOCKS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_RWLOCKS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_RWLOCKS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_SEMAPHORES > 0
+    #define _CONFIGURE_NAME_INDEX_SEMAPHORES \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_SEMAPHORES )
+  #else
+    #define _CONFIGURE_NAME_INDEX_SEMAPHORES 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_TIMERS > 0
+    #define _CONFIGURE_NAME_INDEX_TIMERS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_TIMERS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_TIMERS 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES > 0
+    #define _CONFIGURE_NAME_INDEX_POSIX_MESSAGE_QUEUES \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES )
+  #else
+    #define _CONFIGURE_NAME_INDEX_POSIX_MESSAGE_QUEUES 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_POSIX_SEMAPHORES > 0
+    #define _CONFIGURE_NAME_INDEX_POSIX_SEMAPHORES \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_SEMAPHORES )
+  #else
+    #define _CONFIGURE_NAME_INDEX_POSIX_SEMAPHORES 0
+  #endif
+
+  #if CONFIGURE_MAXIMUM_POSIX_SHMS > 0
+    #define _CONFIGURE_NAME_INDEX_POSIX_SHMS \
+      _Configure_Name_index( CONFIGURE_MAXIMUM_POSIX_SHMS )
+  #else
+    #define _CONFIGURE_NAME_INDEX_POSIX_SHMS 0
+  #endif
+
+  #define _CONFIGURE_MEMORY_FOR_NAME_INDEX \
+    ( _Configure_Name_index( _CONFIGURE_TASKS ) \
+      + _Configure_Name_index( CONFIGURE_MAXIMUM_USER_EXTENSIONS ) \
+      + _CONFIGURE_NAME_INDEX_BARRIERS \
+      + _CONFIGURE_NAME_INDEX_MESSAGE_QUEUES \
+      + _CONFIGURE_NAME_INDEX_PARTITIONS \
+      + _CONFIGURE_NAME_INDEX_PERIODS \
+      + _CONFIGURE_NAME_INDEX_PORTS \
+      + _CONFIGURE_NAME_INDEX_REGIONS \
+      + _CONFIGURE_NAME_INDEX_RWLOCKS \
+      + _CONFIGURE_NAME_INDEX_SEMAPHORES \
+      + _CONFIGURE_NAME_INDEX_TIMERS \
+      + _CONFIGURE_NAME_INDEX_POSIX_MESSAGE_QUEUES \
+      + _CONFIGURE_NAME_INDEX_POSIX_SEMAPHORES \
+      + _CONFIGURE_NAME_INDEX_POSIX_SHMS )
+#else
+  #define _CONFIGURE_MEMORY_FOR_NAME_INDEX 0
+#endif
+
+/*
+ * The Classic RWLocks allocate the per-processor reader counters with a cache
+ * line alignment.
+ */
+#if CONFIGURE_MAXIMUM_RWLOCKS > 0
+  #define _CONFIGURE_MEMORY_FOR_RWLOCKS \
+    ( rtems_resource_maximum_per_allocation( CONFIGURE_MAXIMUM_RWLOCKS ) \
+      * _Configure_From_workspace( \
+        _CONFIGURE_MAXIMUM_PROCESSORS * sizeof( CORE_BRWLock_Per_CPU ) \
+          + CPU_CACHE_LINE_BYTES ) )
+#else
+  #define _CONFIGURE_MEMORY_FOR_RWLOCKS 0
+#endif
 
 #define CONFIGURE_EXECUTIVE_RAM_SIZE \
   ( _CONFIGURE_MEMORY_FOR_POSIX_OBJECTS \
+    + _CONFIGURE_MEMORY_FOR_NAME_INDEX \
+    + _CONFIGURE_MEMORY_FOR_RWLOCKS \
     + CONFIGURE_MESSAGE_BUFFER_MEMORY \
     + 1024 * CONFIGURE_MEMORY_OVERHEAD \
     + _CONFIGURE_HEAP_HANDLER_OVERHEAD )
@@ -126,6 +312,11 @@ const uintptr_t _Workspace_Size = CONFIGURE_EXECUTIVE_RAM_SIZE;
   const bool _Workspace_Is_unified = true;
 #endif
 
+#ifdef CONFIGURE_SEGREGATED_FIT_HEAPS
+  const Heap_Initialization_or_extend_handler _Workspace_Heap_initialize =
+    _Heap_Initialize_segregated;
+#endif
+
 uint32_t rtems_minimum_stack_size = CONFIGURE_MINIMUM_TASK_STACK_SIZE;
 
 const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
@@ -155,6 +346,22 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
   #error "CONFIGURE_TASK_STACK_ALLOCATOR and CONFIGURE_TASK_STACK_DEALLOCATOR must be both defined or both undefined"
 #endif
 
+#ifdef CONFIGURE_TASK_STACK_POOL_MAXIMUM
+  const Stack_Pool_Configuration _Stack_Pool_Configuration = {
+    CONFIGURE_TASK_STACK_POOL_MAXIMUM,
+    CONFIGURE_TASK_STACK_POOL_STACK_SIZE,
+    CONFIGURE_TASK_STACK_POOL_GUARD_SIZE
+  };
+#endif
+
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  RTEMS_SYSINIT_ITEM(
+    _Objects_Name_index_initialize,
+    RTEMS_SYSINIT_OBJECTS_NAME_INDEX,
+    RTEMS_SYSINIT_ORDER_MIDDLE
+  );
+#endif
+
 #ifdef CONFIGURE_DIRTY_MEMORY
   RTEMS_SYSINIT_ITEM(
     _Memory_Dirty_free_areas,
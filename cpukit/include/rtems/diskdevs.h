@@ -59,7 +59,12 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_NO_TRIGGER ((rtems_blkdev_bnum) -1)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of sequential read streams tracked by the read-ahead of a disk.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAMS 4
+
+/**
+ * @brief Block device read-ahead control of a sequential read stream.
  */
 typedef struct {
   /**
@@ -67,6 +72,11 @@ typedef struct {
    */
   rtems_chain_node node;
 
+  /**
+   * @brief The disk device of this stream.
+   */
+  rtems_disk_device *dd;
+
   /**
    * @brief Block value to trigger the read-ahead request.
    *
@@ -82,6 +92,31 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Start block of the last read-ahead request.
+   *
+   * The blocks from this value up to the next value were read ahead.  A read
+   * miss in this range indicates that read-ahead blocks were recycled before
+   * they were used.
+   */
+  rtems_blkdev_bnum window_begin;
+
+  /**
+   * @brief Block count of the next read-ahead request.
+   *
+   * The window shrinks if read-ahead blocks were recycled before they were
+   * used and grows up to the configured maximum read-ahead blocks each time
+   * the stream reaches the trigger.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Stamp of the last use of this stream.
+   *
+   * A new stream replaces the least recently used stream of the disk.
+   */
+  uint32_t stamp;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -144,6 +179,24 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Eviction count.
+   *
+   * An eviction occurs in case a cached block of this device is recycled to
+   * hold another block.
+   */
+  uint32_t evictions;
+
+  /**
+   * @brief Promotion count.
+   *
+   * A promotion occurs in case a block is accessed the second time while it
+   * is cached and the 2Q replacement policy is used.  Such a block moves from
+   * the probation list to the protected list of the cache.  This count is
+   * always zero for the LRU replacement policy.
+   */
+  uint32_t promotions;
 } rtems_blkdev_stats;
 
 /**
@@ -267,9 +320,32 @@ struct rtems_disk_device {
   rtems_blkdev_stats stats;
 
   /**
-   * @brief Read-ahead control for this disk.
+   * @brief Read-ahead control for the sequential read streams of this disk.
+   */
+  rtems_blkdev_read_ahead read_ahead[RTEMS_DISK_READ_AHEAD_STREAMS];
+
+  /**
+   * @brief Queue depth of the driver.
+   *
+   * @see RTEMS_BLKIO_GETQUEUEDEPTH.
+   */
+  uint32_t queue_depth;
+
+  /**
+   * @brief Count of read-ahead requests in progress.
+   *
+   * Only valid for physical disks.  The cache keeps this value below the
+   * queue depth.
+   */
+  uint32_t read_ahead_in_flight;
+
+  /**
+   * @brief Partition of the block device buffer cache used by this disk.
+   *
+   * The first rtems_bdbuf_set_block_size() call for this disk assigns the
+   * partition.
    */
-  rtems_blkdev_read_ahead read_ahead;
+  struct rtems_bdbuf_partition *cache_partition;
 };
 
 /**
@@ -70,7 +70,8 @@ extern size_t malloc_free_space(void);
 /**
  * @brief Get malloc status information.
  * 
- * Find amount of free heap remaining.
+ * Find amount of free heap remaining.  Blocks held by the per-processor
+ * malloc() caches are accounted as free blocks, see malloc_cache_info().
  */
 extern int malloc_info(Heap_Information_block *the_info);
 
@@ -228,6 +228,142 @@ void *rtems_heap_greedy_allocate_all_except_largest(
  */
 void rtems_heap_greedy_free( void *opaque );
 
+/**
+ * @brief The count of size classes of the per-processor malloc() cache.
+ */
+#define RTEMS_MALLOC_CACHE_CLASS_COUNT 6
+
+/**
+ * @brief The allocation size in bytes of the smallest size class of the
+ * per-processor malloc() cache.
+ *
+ * The allocation size of a size class is two times the allocation size of
+ * the previous size class.
+ */
+#define RTEMS_MALLOC_CACHE_MINIMUM_SIZE 16
+
+/**
+ * @brief The allocation size in bytes of the largest size class of the
+ * per-processor malloc() cache.
+ *
+ * Allocations above this size are always satisfied by the C program heap.
+ */
+#define RTEMS_MALLOC_CACHE_MAXIMUM_SIZE \
+  ( RTEMS_MALLOC_CACHE_MINIMUM_SIZE << ( RTEMS_MALLOC_CACHE_CLASS_COUNT - 1 ) )
+
+/**
+ * @brief Statistics of the malloc() cache of one processor.
+ */
+typedef struct {
+  /**
+   * @brief Count of allocations satisfied by the cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of allocations which found an empty magazine.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of batch refills of a magazine from the heap.
+   */
+  uint32_t refills;
+
+  /**
+   * @brief Count of frees which put the memory area into the cache.
+   */
+  uint32_t frees;
+
+  /**
+   * @brief Count of batch flushes of a full magazine to the heap.
+   */
+  uint32_t flushes;
+
+  /**
+   * @brief Count of blocks currently held by the cache.
+   */
+  uint32_t cached_blocks;
+
+  /**
+   * @brief Sum of the sizes of the blocks currently held by the cache.
+   */
+  uintptr_t cached_size;
+} rtems_malloc_cache_statistics;
+
+/**
+ * @brief A magazine of cached blocks of one size class.
+ *
+ * The blocks are chained through the first word of their allocation area.
+ * The second word contains the size of the heap block.
+ */
+typedef struct {
+  void      *head;
+  uint32_t   count;
+  uintptr_t  size;
+} Malloc_Cache_magazine;
+
+/**
+ * @brief The malloc() cache of one processor.
+ *
+ * The cache is only accessed by its processor with interrupts disabled.
+ * Other processors use inter-processor actions to flush the cache or to get
+ * the statistics.
+ */
+typedef struct {
+  Malloc_Cache_magazine Magazines[ RTEMS_MALLOC_CACHE_CLASS_COUNT ];
+  rtems_malloc_cache_statistics Stats;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Malloc_Cache;
+
+/**
+ * @brief The malloc() cache configuration.
+ */
+typedef struct {
+  /**
+   * @brief The count of blocks of a magazine before it is flushed to the
+   * heap.
+   *
+   * A value of zero disables the cache.
+   */
+  uint32_t magazine_size;
+
+  /**
+   * @brief The table of caches with one entry per configured processor.
+   */
+  Malloc_Cache *caches;
+} Malloc_Cache_configuration;
+
+/**
+ * @brief The malloc() cache configuration.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>, see CONFIGURE_MALLOC_PER_PROCESSOR_CACHE.
+ */
+extern const Malloc_Cache_configuration _Malloc_Cache_configuration;
+
+/**
+ * @brief Returns all blocks held by the per-processor malloc() caches to the
+ * C program heap.
+ *
+ * This function must be called from thread context.
+ */
+void rtems_malloc_cache_flush( void );
+
+/**
+ * @brief Gets the statistics of the malloc() cache of a processor.
+ *
+ * @param cpu_index The index of the processor.
+ * @param[out] the_info The statistics.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 The cache is not configured, the processor index is invalid, or
+ *   @a the_info is @c NULL.
+ */
+int malloc_cache_info(
+  uint32_t                       cpu_index,
+  rtems_malloc_cache_statistics *the_info
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,8 @@
 #include <pthread.h>
 
 #include <rtems/score/chain.h>
+#include <rtems/score/freechain.h>
+#include <rtems/score/isrlock.h>
 #include <rtems/score/object.h>
 #include <rtems/score/rbtree.h>
 #include <rtems/score/thread.h>
@@ -88,6 +90,15 @@ extern POSIX_Keys_Key_value_pair _POSIX_Keys_Key_value_pairs[];
  */
 extern const uint32_t _POSIX_Keys_Key_value_pair_maximum;
 
+/**
+ * @brief The per-processor caches of the POSIX key and value pair pool.
+ *
+ * This pointer is provided via <rtems/confdefs.h> in case
+ * CONFIGURE_POSIX_KEYS_PER_PROCESSOR_CACHE is defined, otherwise it is
+ * @c NULL.  The array must have one cache for each configured processor.
+ */
+extern Freechain_Cache * const _POSIX_Keys_Keypool_caches;
+
 /**
  * @brief The data structure used to manage a POSIX key.
  */
@@ -97,6 +108,11 @@ typedef struct {
    /** This field is the data destructor. */
    void (*destructor) (void *);
 
+   /**
+    * @brief The lock to protect the key value pairs chain.
+    */
+   ISR_LOCK_MEMBER( Lock )
+
    /**
     * @brief Key value pairs of this key.
     */
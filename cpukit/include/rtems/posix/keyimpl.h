@@ -41,6 +41,12 @@ extern "C" {
  */
 extern Freechain_Control _POSIX_Keys_Keypool;
 
+/**
+ * @brief The count of key and value pairs moved at once between a
+ * per-processor cache and the key and value pair pool.
+ */
+#define POSIX_KEYS_KEYPOOL_CACHE_BATCH_SIZE 8
+
 #define POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node ) \
   RTEMS_CONTAINER_OF( node, POSIX_Keys_Key_value_pair, Lookup_node )
 
@@ -75,12 +81,69 @@ RTEMS_INLINE_ROUTINE POSIX_Keys_Control *_POSIX_Keys_Get( pthread_key_t key )
     _Objects_Get_no_protection( (Objects_Id) key, &_POSIX_Keys_Information );
 }
 
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Acquire(
+  POSIX_Keys_Control *the_key,
+  ISR_lock_Context   *lock_context
+)
+{
+  _ISR_lock_ISR_disable_and_acquire( &the_key->Lock, lock_context );
+}
+
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Release(
+  POSIX_Keys_Control *the_key,
+  ISR_lock_Context   *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &the_key->Lock, lock_context );
+}
+
+/**
+ * @brief Gets a key and acquires its lock.
+ *
+ * The allocator mutex is not required.  Since pthread_key_delete() closes the
+ * key while it owns the key lock, the key is checked again after the key lock
+ * is obtained.
+ *
+ * @param key The key identifier.
+ * @param[out] lock_context The lock context to release the key lock.
+ *
+ * @retval NULL The key identifier is invalid.
+ * @retval the_key The key.  The key lock is owned and interrupts are
+ *   disabled.
+ */
+RTEMS_INLINE_ROUTINE POSIX_Keys_Control *_POSIX_Keys_Get_and_acquire(
+  pthread_key_t     key,
+  ISR_lock_Context *lock_context
+)
+{
+  POSIX_Keys_Control *the_key;
+
+  the_key = (POSIX_Keys_Control *)
+    _Objects_Get( (Objects_Id) key, lock_context, &_POSIX_Keys_Information );
+
+  if ( the_key == NULL ) {
+    return NULL;
+  }
+
+  _ISR_lock_Acquire( &the_key->Lock, lock_context );
+
+  if ( RTEMS_PREDICT_FALSE( _POSIX_Keys_Get( key ) != the_key ) ) {
+    _POSIX_Keys_Release( the_key, lock_context );
+    return NULL;
+  }
+
+  return the_key;
+}
+
 RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_acquire(
   Thread_Control   *the_thread,
   ISR_lock_Context *lock_context
 )
 {
-  _ISR_lock_ISR_disable_and_acquire( &the_thread->Keys.Lock, lock_context );
+  _ISR_lock_ISR_disable_and_acquire(
+    &the_thread->Cold->Keys.Lock,
+    lock_context
+  );
 }
 
 RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_release(
@@ -88,17 +151,67 @@ RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_release(
   ISR_lock_Context *lock_context
 )
 {
-  _ISR_lock_Release_and_ISR_enable( &the_thread->Keys.Lock, lock_context );
+  _ISR_lock_Release_and_ISR_enable(
+    &the_thread->Cold->Keys.Lock,
+    lock_context
+  );
+}
+
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_acquire_critical(
+  Thread_Control   *the_thread,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Acquire( &the_thread->Cold->Keys.Lock, lock_context );
+}
+
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_release_critical(
+  Thread_Control   *the_thread,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release( &the_thread->Cold->Keys.Lock, lock_context );
 }
 
+/**
+ * @brief Allocates a key and value pair.
+ *
+ * In case the key and value pair pool has per-processor caches, the
+ * allocator mutex is only obtained to extend the pool.
+ */
 POSIX_Keys_Key_value_pair * _POSIX_Keys_Key_value_allocate( void );
 
-RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_free(
+/**
+ * @brief Frees a key and value pair.
+ *
+ * The key and value pair must be already extracted from the key value pairs
+ * chain of its key and the lookup tree of its thread.  In case the key and
+ * value pair pool has per-processor caches, the allocator mutex is not
+ * obtained.
+ */
+void _POSIX_Keys_Key_value_free( POSIX_Keys_Key_value_pair *key_value_pair );
+
+/**
+ * @brief Extracts a key and value pair from the key value pairs chain of its
+ * key and the lookup tree of its thread.
+ *
+ * The key lock must be owned.
+ */
+RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_extract(
   POSIX_Keys_Key_value_pair *key_value_pair
 )
 {
+  Thread_Control   *the_thread;
+  ISR_lock_Context  lock_context;
+
+  the_thread = key_value_pair->thread;
+  _POSIX_Keys_Key_value_acquire_critical( the_thread, &lock_context );
+  _RBTree_Extract(
+    &the_thread->Cold->Keys.Key_value_pairs,
+    &key_value_pair->Lookup_node
+  );
+  _POSIX_Keys_Key_value_release_critical( the_thread, &lock_context );
   _Chain_Extract_unprotected( &key_value_pair->Key_node );
-  _Freechain_Put( &_POSIX_Keys_Keypool, key_value_pair );
 }
 
 RTEMS_INLINE_ROUTINE bool _POSIX_Keys_Key_value_equal(
@@ -140,7 +253,7 @@ RTEMS_INLINE_ROUTINE POSIX_Keys_Key_value_pair *_POSIX_Keys_Key_value_find(
 )
 {
   return _RBTree_Find_inline(
-    &the_thread->Keys.Key_value_pairs,
+    &the_thread->Cold->Keys.Key_value_pairs,
     &key,
     _POSIX_Keys_Key_value_equal,
     _POSIX_Keys_Key_value_less,
@@ -155,7 +268,7 @@ RTEMS_INLINE_ROUTINE void _POSIX_Keys_Key_value_insert(
 )
 {
   _RBTree_Insert_inline(
-    &the_thread->Keys.Key_value_pairs,
+    &the_thread->Cold->Keys.Key_value_pairs,
     &key_value_pair->Lookup_node,
     &key,
     _POSIX_Keys_Key_value_less
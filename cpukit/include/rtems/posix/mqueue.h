@@ -90,6 +90,80 @@ extern Objects_Information _POSIX_Message_queue_Information;
 
 /** @} */
 
+/**
+ * @brief Loans a message buffer of the message queue.
+ *
+ * This is an RTEMS extension.  The message content may be filled in directly
+ * and then sent with mq_send_buffer_np() without a copy.  A loaned buffer
+ * which is not sent must be given back with mq_return_buffer_np().  This
+ * function does not block.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param[out] buffer The loaned message buffer.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF, EINVAL or
+ *   EAGAIN.
+ */
+int mq_loan_buffer_np( mqd_t mqdes, void **buffer );
+
+/**
+ * @brief Sends a loaned message buffer to the message queue.
+ *
+ * This is an RTEMS extension.  The message content is not copied to a
+ * receiver waiting in mq_receive_buffer_np().  In contrast to mq_send(), this
+ * function does not block.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param buffer The message buffer obtained by mq_loan_buffer_np().
+ * @param msg_len The size of the message content.
+ * @param msg_prio The message priority.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF, EINVAL or
+ *   EMSGSIZE.
+ */
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *buffer,
+  size_t        msg_len,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receives a message buffer from the message queue.
+ *
+ * This is an RTEMS extension.  The message content is not copied.  The
+ * message buffer is loaned to the caller and must be given back with
+ * mq_return_buffer_np().
+ *
+ * @param mqdes The message queue descriptor.
+ * @param[out] buffer The loaned message buffer.
+ * @param[out] msg_prio The message priority, may be @c NULL.
+ *
+ * @return The size of the message or -1 if an error occurred.  The errno is
+ *   set to EBADF, EINVAL or EAGAIN.
+ */
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **buffer,
+  unsigned int  *msg_prio
+);
+
+/**
+ * @brief Gives a loaned message buffer back to the message queue.
+ *
+ * This is an RTEMS extension.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param buffer The message buffer obtained by mq_loan_buffer_np() or
+ *   mq_receive_buffer_np().
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to EBADF or EINVAL.
+ */
+int mq_return_buffer_np( mqd_t mqdes, void *buffer );
+
 #ifdef __cplusplus
 }
 #endif
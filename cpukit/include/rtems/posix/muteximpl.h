@@ -128,6 +128,8 @@ RTEMS_INLINE_ROUTINE bool _POSIX_Mutex_Is_locked(
   return _POSIX_Mutex_Get_owner( the_mutex ) != NULL;
 }
 
+#define POSIX_MUTEX_ABSTIME_TRY_LOCK ((uintptr_t) 1)
+
 Status_Control _POSIX_Mutex_Seize_slow(
   POSIX_Mutex_Control           *the_mutex,
   const Thread_queue_Operations *operations,
@@ -194,6 +196,23 @@ RTEMS_INLINE_ROUTINE Status_Control _POSIX_Mutex_Seize(
     return status;
   }
 
+#if defined(RTEMS_SMP)
+  if (
+    (uintptr_t) abstime != POSIX_MUTEX_ABSTIME_TRY_LOCK
+      && _Thread_queue_Spin_on_owner(
+        &the_mutex->Recursive.Mutex.Queue.Queue,
+        owner,
+        executing,
+        queue_context
+      )
+  ) {
+    _POSIX_Mutex_Set_owner( the_mutex, executing );
+    _Thread_Resource_count_increment( executing );
+    _POSIX_Mutex_Release( the_mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   return _POSIX_Mutex_Seize_slow(
     the_mutex,
     operations,
@@ -444,8 +463,6 @@ RTEMS_INLINE_ROUTINE Status_Control _POSIX_Mutex_Ceiling_surrender(
   return STATUS_SUCCESSFUL;
 }
 
-#define POSIX_MUTEX_ABSTIME_TRY_LOCK ((uintptr_t) 1)
-
 int _POSIX_Mutex_Lock_support(
   pthread_mutex_t              *mutex,
   const struct timespec        *abstime,
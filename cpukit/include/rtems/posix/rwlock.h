@@ -0,0 +1,105 @@
+/**
+ * @file
+ *
+ * @ingroup POSIXAPI
+ *
+ * @brief POSIX RWLock Extensions
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_POSIX_RWLOCK_H
+#define _RTEMS_POSIX_RWLOCK_H
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets the big reader kind of the rwlock attributes.
+ *
+ * A big reader rwlock uses per-processor reader counters, so that the read
+ * lock and unlock operations of readers on different processors do not
+ * contend for a common cache line as long as there is no writer.  The
+ * writer operations are more expensive, since a writer has to wait for all
+ * readers to drain.  Use this kind for read-mostly data.
+ *
+ * A big reader rwlock allocates memory from the C program heap in
+ * pthread_rwlock_init(), which may fail with ENOMEM.
+ *
+ * The read lock operations of a big reader rwlock fail with EDEADLK if the
+ * calling thread owns the rwlock already and with EAGAIN if the calling
+ * thread owns already the maximum count of big reader rwlocks for reading.
+ * A thread records each big reader rwlock it owns for reading in a table of
+ * its thread control block, so that the unlock operation knows the lock
+ * kind it releases.  The table size is defined by the application
+ * configuration option CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD, the
+ * default is four.  With a value of zero, big reader rwlocks cannot be
+ * obtained for reading.
+ * pthread_rwlock_unlock() fails with EPERM if the calling thread does not
+ * own the rwlock.
+ *
+ * This is an RTEMS extension.
+ *
+ * @param[in, out] attr The rwlock attributes.
+ * @param big_reader If non-zero, then rwlocks initialized with these
+ *   attributes are big reader rwlocks, otherwise they are default rwlocks.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL The attributes are invalid.
+ */
+int pthread_rwlockattr_setbigreader_np(
+  pthread_rwlockattr_t *attr,
+  int                   big_reader
+);
+
+/**
+ * @brief Gets the big reader kind of the rwlock attributes.
+ *
+ * This is an RTEMS extension.
+ *
+ * @param attr The rwlock attributes.
+ * @param[out] big_reader Is set to one, if the attributes specify a big
+ *   reader rwlock, otherwise it is set to zero.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL The attributes are invalid.
+ */
+int pthread_rwlockattr_getbigreader_np(
+  const pthread_rwlockattr_t *attr,
+  int                        *big_reader
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
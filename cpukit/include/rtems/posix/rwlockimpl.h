@@ -19,6 +19,8 @@
 #ifndef _RTEMS_POSIX_RWLOCKIMPL_H
 #define _RTEMS_POSIX_RWLOCKIMPL_H
 
+#include <rtems/posix/rwlock.h>
+#include <rtems/score/corebrwlockimpl.h>
 #include <rtems/score/corerwlockimpl.h>
 
 #include <errno.h>
@@ -30,9 +32,39 @@ extern "C" {
 
 #define POSIX_RWLOCK_MAGIC 0x9621dabdUL
 
+/*
+ * Bit one of the magic number is zero and the rwlock objects are at least
+ * four byte aligned, so this bit is available to indicate the big reader
+ * kind.
+ */
+#define POSIX_RWLOCK_BIG_READER 0x2UL
+
+#define POSIX_RWLOCK_FLAGS_MASK 0x2UL
+
+/*
+ * The big reader kind is stored in the is_initialized member of the
+ * attributes, since the layout of pthread_rwlockattr_t is fixed by Newlib.
+ */
+#define POSIX_RWLOCKATTR_BIG_READER 0x2
+
+/*
+ * The big reader rwlock does not fit into pthread_rwlock_t.  It is allocated
+ * together with the per-processor reader counters by pthread_rwlock_init().
+ */
+typedef struct {
+  CORE_BRWLock_Control Lock;
+  CORE_BRWLock_Per_CPU Per_CPU[ RTEMS_ZERO_LENGTH_ARRAY ];
+} POSIX_RWLock_Big_reader;
+
 typedef struct {
   unsigned long flags;
-  CORE_RWLock_Control RWLock;
+  union {
+    CORE_RWLock_Control RWLock;
+    struct {
+      Thread_queue_Syslock_queue Queue;
+      POSIX_RWLock_Big_reader *control;
+    } Big_reader;
+  };
 } POSIX_RWLock_Control;
 
 RTEMS_INLINE_ROUTINE POSIX_RWLock_Control *_POSIX_RWLock_Get(
@@ -42,6 +74,51 @@ RTEMS_INLINE_ROUTINE POSIX_RWLock_Control *_POSIX_RWLock_Get(
   return (POSIX_RWLock_Control *) rwlock;
 }
 
+RTEMS_INLINE_ROUTINE bool _POSIX_RWLock_Is_big_reader(
+  const POSIX_RWLock_Control *the_rwlock
+)
+{
+  return ( the_rwlock->flags & POSIX_RWLOCK_BIG_READER ) != 0;
+}
+
+RTEMS_INLINE_ROUTINE CORE_BRWLock_Control *_POSIX_RWLock_Get_big_reader(
+  const POSIX_RWLock_Control *the_rwlock
+)
+{
+  return &the_rwlock->Big_reader.control->Lock;
+}
+
+RTEMS_INLINE_ROUTINE Thread_Control *_POSIX_RWLock_ISR_disable(
+  Thread_queue_Context *queue_context
+)
+{
+  ISR_Level level;
+
+  _Thread_queue_Context_ISR_disable( queue_context, level );
+  _Thread_queue_Context_set_ISR_level( queue_context, level );
+  return _Thread_Executing;
+}
+
+/*
+ * Checks with interrupts disabled that the big reader rwlock was not
+ * destroyed after the object validation.  In this case, interrupts are
+ * enabled.  pthread_rwlock_destroy() invalidates the flags before it waits
+ * for the processors to leave their interrupt disabled sections and frees
+ * the storage.
+ */
+RTEMS_INLINE_ROUTINE bool _POSIX_RWLock_Big_reader_is_valid(
+  const POSIX_RWLock_Control *the_rwlock,
+  Thread_queue_Context       *queue_context
+)
+{
+  if ( !_POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return false;
+  }
+
+  return true;
+}
+
 bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
 
 #define POSIX_RWLOCK_VALIDATE_OBJECT( rw ) \
@@ -49,7 +126,11 @@ bool _POSIX_RWLock_Auto_initialization( POSIX_RWLock_Control *the_rwlock );
     if ( ( rw ) == NULL ) { \
       return EINVAL; \
     } \
-    if ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) != ( rw )->flags ) { \
+    if ( \
+      ( ( (uintptr_t) ( rw ) ^ POSIX_RWLOCK_MAGIC ) \
+          & ~POSIX_RWLOCK_FLAGS_MASK ) \
+        != ( ( rw )->flags & ~POSIX_RWLOCK_FLAGS_MASK ) \
+    ) { \
       if ( !_POSIX_RWLock_Auto_initialization( rw ) ) { \
         return EINVAL; \
       } \
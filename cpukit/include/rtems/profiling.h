@@ -50,8 +50,10 @@ extern "C" {
  *
  * Profiling information includes critical timing values such as the maximum
  * time of disabled thread dispatching which is a measure for the thread
- * dispatch latency.  On SMP configurations statistics of all SMP locks in the
- * system are available.
+ * dispatch latency.  Latency histograms of the scheduler block, unblock and
+ * update priority operations and the thread dispatch are available for each
+ * processor.  On SMP configurations statistics of all SMP locks in the system
+ * are available.
  *
  * Profiling information can be retrieved via rtems_profiling_iterate() and
  * reported as an XML dump via rtems_profiling_report_xml().  These functions
@@ -77,7 +79,14 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of scheduler operation profiling data.
+   *
+   * @see rtems_profiling_scheduler_operation.
+   */
+  RTEMS_PROFILING_SCHEDULER_OPERATION
 } rtems_profiling_type;
 
 /**
@@ -178,6 +187,28 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+  /**
+   * @brief Count of contended mutex obtain operations which got the mutex
+   * after spinning while the owner executed on another processor.
+   *
+   * Adaptive spinning is only available on SMP configurations and must be
+   * enabled via CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT.
+   *
+   * This value may overflow.
+   */
+  uint64_t mutex_spin_acquire_count;
+
+  /**
+   * @brief Count of contended mutex obtain operations which blocked with the
+   * adaptive spinning enabled.
+   *
+   * The ratio of the spin acquire count and this count shows the
+   * effectiveness of the adaptive spinning.
+   *
+   * This value may overflow.
+   */
+  uint64_t mutex_block_count;
 } rtems_profiling_per_cpu;
 
 /**
@@ -265,6 +296,111 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief Scheduler operations and the thread dispatch covered by the latency
+ * histograms.
+ */
+typedef enum {
+  /**
+   * @brief The scheduler block operation.
+   */
+  RTEMS_PROFILING_SCHEDULER_BLOCK,
+
+  /**
+   * @brief The scheduler unblock operation.
+   */
+  RTEMS_PROFILING_SCHEDULER_UNBLOCK,
+
+  /**
+   * @brief The scheduler update priority operation.
+   */
+  RTEMS_PROFILING_SCHEDULER_UPDATE_PRIORITY,
+
+  /**
+   * @brief The thread dispatch.
+   *
+   * This is the time to carry out the preemption intervention and to select
+   * the heir thread.  The context switch itself is not included.
+   */
+  RTEMS_PROFILING_THREAD_DISPATCH
+} rtems_profiling_scheduler_operation_type;
+
+/**
+ * @brief Count of latency histogram bins for scheduler operation profiling.
+ */
+#define RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS 20
+
+/**
+ * @brief Scheduler operation profiling data.
+ *
+ * The operation time is measured on the processor which carried out the
+ * operation.  It is the time elapsed between the operation start and end
+ * instants in a critical section with interrupts disabled.  The operation is
+ * accounted to the scheduler owning this processor.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The processor index of this profiling data.
+   */
+  uint32_t processor_index;
+
+  /**
+   * @brief The name of the scheduler owning the processor.
+   */
+  uint32_t scheduler_name;
+
+  /**
+   * @brief The scheduler operation.
+   */
+  rtems_profiling_scheduler_operation_type operation;
+
+  /**
+   * @brief The maximum operation time in nanoseconds.
+   */
+  uint32_t max_time;
+
+  /**
+   * @brief Count of operations.
+   *
+   * This value may overflow.
+   */
+  uint64_t count;
+
+  /**
+   * @brief Total operation time in nanoseconds.
+   *
+   * The average operation time is the total operation time divided by the
+   * operation count.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_time;
+
+  /**
+   * @brief The exclusive upper limits of the latency histogram bins in
+   * nanoseconds.
+   *
+   * The limits are derived from powers of two of the CPU counter ticks.  The
+   * last bin has no upper limit and its limit value is UINT32_MAX.
+   */
+  uint32_t histogram_limits[RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS];
+
+  /**
+   * @brief The latency histogram.
+   *
+   * The count for index N corresponds to operations with an operation time
+   * less than the limit N and greater than or equal to the limit N minus one.
+   *
+   * The values may overflow.
+   */
+  uint64_t histogram[RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS];
+} rtems_profiling_scheduler_operation;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -283,6 +419,11 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief Scheduler operation profiling data if indicated by the header.
+   */
+  rtems_profiling_scheduler_operation scheduler_operation;
 } rtems_profiling_data;
 
 /**
@@ -150,6 +150,30 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_MULTIPROCESSOR_RESOURCE_SHARING 0x00000100
 
+/**************** RTEMS Message Queue Specific Attributes ****************/
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created will pass messages through a lock-free ring.  There
+ *  must be at most one sending task.  There may be multiple receiving tasks,
+ *  however, the ring is optimized for one receiving task.
+ *
+ *  @note The message count must be a power of two.  Urgent messages are not
+ *  supported.
+ */
+#define RTEMS_MESSAGE_QUEUE_SPSC_RING 0x00000200
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created will pass messages through a lock-free ring.  There may
+ *  be multiple sending tasks and interrupt handlers.  There may be multiple
+ *  receiving tasks, however, the ring is optimized for one receiving task.
+ *
+ *  @note The message count must be a power of two.  Urgent messages are not
+ *  supported.
+ */
+#define RTEMS_MESSAGE_QUEUE_MPSC_RING 0x00000400
+
 /******************** RTEMS Barrier Specific Attributes ********************/
 
 /**
@@ -123,6 +123,21 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_priority(
    return ( attribute_set & RTEMS_PRIORITY ) ? true : false;
 }
 
+/**
+ *  @brief Checks if a message queue ring attribute is
+ *  enabled in the attribute_set.
+ *
+ *  This function returns TRUE if the single or multiple producer message
+ *  queue ring attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_message_queue_ring(
+  rtems_attribute attribute_set
+)
+{
+  return ( attribute_set
+    & ( RTEMS_MESSAGE_QUEUE_SPSC_RING | RTEMS_MESSAGE_QUEUE_MPSC_RING ) ) != 0;
+}
+
 /**
  *  @brief Checks if the binary semaphore attribute is
  *  enabled in the attribute_set.
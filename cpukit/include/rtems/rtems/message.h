@@ -237,6 +237,103 @@ rtems_status_code rtems_message_queue_get_number_pending(
   uint32_t *count
 );
 
+/**
+ * @brief Loans a message buffer of the message queue.
+ *
+ * The message content may be filled in directly and then sent with
+ * rtems_message_queue_send_buffer() without a copy.  A loaned buffer which
+ * is not sent must be given back with rtems_message_queue_return_buffer().
+ * This directive does not block.
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The loaned message buffer.  It may contain up to the
+ *   maximum message size of this message queue.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer is @c NULL.
+ * @retval RTEMS_NOT_DEFINED The message queue uses a lock-free ring.
+ * @retval RTEMS_TOO_MANY No message buffer is available.
+ */
+rtems_status_code rtems_message_queue_loan_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief Sends a loaned message buffer to the message queue.
+ *
+ * If a task waits in rtems_message_queue_receive_buffer(), then the message
+ * buffer is handed over to this task.  Otherwise, the message buffer is
+ * appended to the pending messages.  In both cases, the message content is
+ * not copied.  The buffer is no longer loaned to the caller.
+ *
+ * @param id The message queue ID.
+ * @param buffer The message buffer obtained by
+ *   rtems_message_queue_loan_buffer().
+ * @param size The size of the message content.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a loaned message buffer of
+ *   this message queue.
+ * @retval RTEMS_INVALID_SIZE The message size is too large.  The buffer
+ *   remains loaned.
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief Receives a message buffer from the message queue.
+ *
+ * In contrast to rtems_message_queue_receive(), the message content is not
+ * copied.  The message buffer is loaned to the caller and must be given back
+ * with rtems_message_queue_return_buffer().
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The loaned message buffer.
+ * @param[out] size The size of the message.
+ * @param option_set The option set, e.g. RTEMS_NO_WAIT or RTEMS_WAIT.
+ * @param timeout The number of ticks to wait if the RTEMS_WAIT is set.  Use
+ *   RTEMS_NO_TIMEOUT to wait indefinitely.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer or the message size
+ *   pointer is @c NULL.
+ * @retval RTEMS_NOT_DEFINED The message queue uses a lock-free ring.
+ * @retval RTEMS_UNSATISFIED No message was pending and RTEMS_NO_WAIT is set.
+ * @retval RTEMS_TIMEOUT A timeout occurred and no message was received.
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ * @brief Gives a loaned message buffer back to the message queue.
+ *
+ * @param id The message queue ID.
+ * @param buffer The message buffer obtained by
+ *   rtems_message_queue_loan_buffer() or
+ *   rtems_message_queue_receive_buffer().
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a loaned message buffer of
+ *   this message queue.
+ */
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,180 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicRWLock
+ *
+ * @brief Classic RWLock Manager API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RTEMS_RWLOCK_H
+#define _RTEMS_RTEMS_RWLOCK_H
+
+#include <rtems/rtems/options.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ClassicRWLock RWLocks
+ *
+ * @ingroup RTEMSAPIClassic
+ *
+ * @brief The Classic RWLock Manager provides big reader RWLocks.
+ *
+ * A big reader RWLock uses per-processor reader counters.  Readers on
+ * different processors do not contend for a common cache line as long as no
+ * writer is present.  A writer waits until all readers drained.  Use these
+ * locks to protect read-mostly data.
+ *
+ * The RWLocks are local objects.  They do not support priority inheritance
+ * or ceiling protocols and are not recursive.
+ */
+/**@{*/
+
+/**
+ * @brief Creates a RWLock.
+ *
+ * The per-processor reader counters are allocated from the RTEMS Workspace.
+ *
+ * @param[in] name is the name of the RWLock.
+ * @param[out] id will contain the identifier of the created RWLock.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_NAME Invalid name.
+ * @retval RTEMS_INVALID_ADDRESS The id parameter is NULL.
+ * @retval RTEMS_TOO_MANY No inactive RWLock object is available.
+ * @retval RTEMS_UNSATISFIED Not enough memory for the per-processor reader
+ *   counters.
+ */
+rtems_status_code rtems_rwlock_create(
+  rtems_name  name,
+  rtems_id   *id
+);
+
+/**
+ * @brief Gets the identifier of a RWLock by its name.
+ *
+ * @param[in] name is the name of the RWLock.
+ * @param[out] id will contain the identifier of the RWLock.
+ *
+ * @retval a status code indicating success or the reason for failure.
+ */
+rtems_status_code rtems_rwlock_ident(
+  rtems_name  name,
+  rtems_id   *id
+);
+
+/**
+ * @brief Deletes a RWLock.
+ *
+ * @param[in] id is the identifier of the RWLock.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid identifier.
+ * @retval RTEMS_RESOURCE_IN_USE The RWLock is locked or threads wait for it.
+ */
+rtems_status_code rtems_rwlock_delete(
+  rtems_id id
+);
+
+/**
+ * @brief Obtains a RWLock for reading.
+ *
+ * @param[in] id is the identifier of the RWLock.
+ * @param[in] option_set is the option set, e.g. RTEMS_WAIT or
+ *   RTEMS_NO_WAIT.
+ * @param[in] timeout is the maximum length of time in ticks the calling
+ *   task is willing to block.  Use RTEMS_NO_TIMEOUT to wait forever.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid identifier.
+ * @retval RTEMS_INCORRECT_STATE The calling task owns the RWLock already.
+ * @retval RTEMS_TOO_MANY The calling task owns already the maximum count of
+ *   RWLocks for reading, see
+ *   CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD.
+ * @retval RTEMS_OBJECT_WAS_DELETED The RWLock was deleted.
+ * @retval RTEMS_UNSATISFIED The RWLock is not available and RTEMS_NO_WAIT
+ *   was specified.
+ * @retval RTEMS_TIMEOUT A timeout occurred.
+ */
+rtems_status_code rtems_rwlock_obtain_read(
+  rtems_id       id,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/**
+ * @brief Obtains a RWLock for writing.
+ *
+ * @param[in] id is the identifier of the RWLock.
+ * @param[in] option_set is the option set, e.g. RTEMS_WAIT or
+ *   RTEMS_NO_WAIT.
+ * @param[in] timeout is the maximum length of time in ticks the calling
+ *   task is willing to block.  Use RTEMS_NO_TIMEOUT to wait forever.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid identifier.
+ * @retval RTEMS_INCORRECT_STATE The calling task owns the RWLock already.
+ * @retval RTEMS_OBJECT_WAS_DELETED The RWLock was deleted.
+ * @retval RTEMS_UNSATISFIED The RWLock is not available and RTEMS_NO_WAIT
+ *   was specified.
+ * @retval RTEMS_TIMEOUT A timeout occurred.
+ */
+rtems_status_code rtems_rwlock_obtain_write(
+  rtems_id       id,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/**
+ * @brief Releases a RWLock obtained for reading or writing.
+ *
+ * @param[in] id is the identifier of the RWLock.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid identifier.
+ * @retval RTEMS_NOT_OWNER_OF_RESOURCE The calling task does not own the
+ *   RWLock.
+ */
+rtems_status_code rtems_rwlock_release(
+  rtems_id id
+);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  end of include file */
@@ -0,0 +1,85 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicRWLockImpl
+ *
+ * @brief Classic RWLock Manager Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_RTEMS_RWLOCKIMPL_H
+#define _RTEMS_RTEMS_RWLOCKIMPL_H
+
+#include <rtems/rtems/rwlockdata.h>
+#include <rtems/score/corebrwlockimpl.h>
+#include <rtems/score/objectimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ClassicRWLockImpl Classic RWLock Implementation
+ *
+ * @ingroup RTEMSInternalClassic
+ *
+ * @{
+ */
+
+RTEMS_INLINE_ROUTINE RWLock_Control *_RWLock_Allocate( void )
+{
+  return (RWLock_Control *) _Objects_Allocate( &_RWLock_Information );
+}
+
+RTEMS_INLINE_ROUTINE void _RWLock_Free( RWLock_Control *the_rwlock )
+{
+  _Objects_Free( &_RWLock_Information, &the_rwlock->Object );
+}
+
+RTEMS_INLINE_ROUTINE RWLock_Control *_RWLock_Get(
+  Objects_Id            id,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Context_initialize( queue_context );
+  return (RWLock_Control *) _Objects_Get(
+    id,
+    &queue_context->Lock_context.Lock_context,
+    &_RWLock_Information
+  );
+}
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  end of include file */
@@ -152,6 +152,33 @@
     RTEMS_SCHEDULER_TABLE_EDF_SMP( name, obj_name )
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_EDF_PARTITIONED_SMP
+  #include <rtems/score/scheduleredfpartitionedsmp.h>
+
+  #ifndef CONFIGURE_MAXIMUM_PROCESSORS
+    #error "CONFIGURE_MAXIMUM_PROCESSORS must be defined to configure the partitioned EDF SMP scheduler"
+  #endif
+
+  #define SCHEDULER_EDF_PARTITIONED_SMP_CONTEXT_NAME( name ) \
+    SCHEDULER_CONTEXT_NAME( EDF_partitioned_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_EDF_PARTITIONED_SMP( name ) \
+    static struct { \
+      Scheduler_EDF_partitioned_SMP_Context Base; \
+      Scheduler_EDF_partitioned_SMP_Ready_queue \
+        Ready[ CONFIGURE_MAXIMUM_PROCESSORS + 1 ]; \
+    } SCHEDULER_EDF_PARTITIONED_SMP_CONTEXT_NAME( name )
+
+  #define RTEMS_SCHEDULER_TABLE_EDF_PARTITIONED_SMP( name, obj_name ) \
+    { \
+      &SCHEDULER_EDF_PARTITIONED_SMP_CONTEXT_NAME( name ).Base.Base.Base, \
+      SCHEDULER_EDF_PARTITIONED_SMP_ENTRY_POINTS, \
+      SCHEDULER_EDF_MAXIMUM_PRIORITY, \
+      ( obj_name ) \
+      SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_PRIORITY
   #include <rtems/score/schedulerpriority.h>
 
@@ -280,6 +307,30 @@
     RTEMS_SCHEDULER_TABLE_STRONG_APA( name, obj_name )
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_STRONG_APA_INDEXED
+  #include <rtems/score/schedulerstrongapaindexed.h>
+
+  #define SCHEDULER_STRONG_APA_INDEXED_CONTEXT_NAME( name ) \
+    SCHEDULER_CONTEXT_NAME( strong_APA_indexed_ ## name )
+
+  #define RTEMS_SCHEDULER_STRONG_APA_INDEXED( name, prio_count ) \
+    static struct { \
+      Scheduler_strong_APA_indexed_Context Base; \
+      Chain_Control                        Ready[ ( prio_count ) ]; \
+    } SCHEDULER_STRONG_APA_INDEXED_CONTEXT_NAME( name )
+
+  #define RTEMS_SCHEDULER_TABLE_STRONG_APA_INDEXED( name, obj_name ) \
+    { \
+      &SCHEDULER_STRONG_APA_INDEXED_CONTEXT_NAME( name ).Base.Base.Base, \
+      SCHEDULER_STRONG_APA_INDEXED_ENTRY_POINTS, \
+      RTEMS_ARRAY_SIZE( \
+        SCHEDULER_STRONG_APA_INDEXED_CONTEXT_NAME( name ).Ready \
+      ) - 1, \
+      ( obj_name ) \
+      SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_SIMPLE
   #include <rtems/score/schedulersimple.h>
 
@@ -0,0 +1,140 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRWLock
+ *
+ * @brief Constants and Structures Associated with the Big Reader RWLock
+ *   Handler
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_COREBRWLOCK_H
+#define _RTEMS_SCORE_COREBRWLOCK_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/threadq.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreBRWLock Big Reader RWLock Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief Reader-biased RWLock with per-processor reader counters.
+ *
+ * A reader acquires the lock by incrementing the reader counter of the
+ * current processor and checking that no writer is present.  This touches
+ * only a processor local cache line and the writer indicator, which is
+ * read-mostly.  A writer announces itself via the writer indicator and
+ * waits until the sum of all reader counters drops to zero (draining).
+ * Readers which observe the writer indicator back out and block on the
+ * thread queue until the writer releases the lock.
+ *
+ * Readers may release the lock on another processor than the one they used
+ * to acquire it.  This is fine, since only the sum of all counters (modulo
+ * the counter range) is of interest.
+ *
+ * Each thread records the locks it owns for reading, so that recursive
+ * obtain operations, which would deadlock with a draining writer, and
+ * release operations of threads which do not own the lock are rejected.
+ *
+ * The fast path of readers runs with interrupts disabled and without the
+ * thread queue lock.  Before the storage of a lock is freed, the lock is
+ * closed, so that readers back out to the thread queue, and then all other
+ * processors are synchronized, see _CORE_BRWLock_Close() and
+ * _CORE_BRWLock_Quiesce().
+ *
+ * @{
+ */
+
+/**
+ * @brief The per-processor reader counter of a big reader RWLock.
+ *
+ * Each counter occupies a cache line of its own.
+ */
+typedef struct {
+  /**
+   * @brief The count of readers which acquired the lock on this processor.
+   */
+  Atomic_Uint readers;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) CORE_BRWLock_Per_CPU;
+
+/**
+ * @brief The big reader RWLock control block.
+ */
+typedef struct CORE_BRWLock_Control {
+  /**
+   * @brief The thread queue for readers and writers which have to wait.
+   */
+  Thread_queue_Control Wait_queue;
+
+  /**
+   * @brief This indicator is non-zero, if a writer owns the lock or waits
+   * for the readers to drain.
+   */
+  Atomic_Uint writer;
+
+  /**
+   * @brief The writer which owns the lock, otherwise NULL.
+   */
+  Thread_Control *write_owner;
+
+  /**
+   * @brief The writer which waits for the readers to drain, otherwise NULL.
+   */
+  Thread_Control *draining_writer;
+
+  /**
+   * @brief The count of readers which handed over the lock to the draining
+   * writer and did not yet acquire the thread queue again.
+   *
+   * This count is protected by the thread queue lock.
+   */
+  uint32_t pending_readers;
+
+  /**
+   * @brief The per-processor reader counters.
+   *
+   * There is one counter for each configured processor, see
+   * _CORE_BRWLock_Per_CPU_size().
+   */
+  CORE_BRWLock_Per_CPU *per_cpu;
+} CORE_BRWLock_Control;
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
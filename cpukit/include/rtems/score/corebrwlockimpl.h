@@ -0,0 +1,381 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRWLock
+ *
+ * @brief Inlined Routines Associated with the Big Reader RWLock Handler
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_COREBRWLOCKIMPL_H
+#define _RTEMS_SCORE_COREBRWLOCKIMPL_H
+
+#include <rtems/score/corebrwlock.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/status.h>
+#include <rtems/score/threadqimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreBRWLock
+ *
+ * @{
+ */
+
+#define CORE_BRWLOCK_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+/**
+ * @brief This is used to denote that a thread is blocking waiting for
+ * read-only access to the big reader RWLock.
+ */
+#define CORE_BRWLOCK_THREAD_WAITING_FOR_READ 0
+
+/**
+ * @brief This is used to denote that a thread is blocking waiting for
+ * write-exclusive access to the big reader RWLock.
+ */
+#define CORE_BRWLOCK_THREAD_WAITING_FOR_WRITE 1
+
+/**
+ * @brief This is used to denote that a thread is blocking waiting for the
+ * readers to drain.
+ *
+ * The thread is the draining writer of the big reader RWLock.  This is set
+ * with the thread queue acquired.
+ */
+#define CORE_BRWLOCK_THREAD_DRAINING 2
+
+/**
+ * @brief This writer indicator value denotes a closed big reader RWLock.
+ *
+ * @see _CORE_BRWLock_Close().
+ */
+#define CORE_BRWLOCK_CLOSED 2
+
+/**
+ * @brief Returns the size of the per-processor reader counter storage.
+ *
+ * The storage must be aligned on a cache line boundary.
+ *
+ * @return The size in bytes of the storage required for the per-processor
+ *   reader counters of one big reader RWLock.
+ */
+RTEMS_INLINE_ROUTINE size_t _CORE_BRWLock_Per_CPU_size( void )
+{
+  return _SMP_Get_processor_maximum() * sizeof( CORE_BRWLock_Per_CPU );
+}
+
+/**
+ * @brief Initializes the big reader RWLock.
+ *
+ * @param[out] the_rwlock The big reader RWLock to initialize.
+ * @param per_cpu The per-processor reader counter storage of size
+ *   _CORE_BRWLock_Per_CPU_size().
+ */
+void _CORE_BRWLock_Initialize(
+  CORE_BRWLock_Control *the_rwlock,
+  CORE_BRWLock_Per_CPU *per_cpu
+);
+
+/**
+ * @brief Destroys the big reader RWLock.
+ *
+ * The per-processor reader counter storage is not freed by this function.
+ *
+ * @param[out] the_rwlock The big reader RWLock to destroy.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_BRWLock_Destroy(
+  CORE_BRWLock_Control *the_rwlock
+)
+{
+  _Thread_queue_Destroy( &the_rwlock->Wait_queue );
+}
+
+/**
+ * @brief Closes the big reader RWLock if it is not in use.
+ *
+ * The caller must disable interrupts and store the previous interrupt level
+ * in the thread queue context, e.g. via _Objects_Get().  Interrupts are
+ * enabled on return.
+ *
+ * Readers which observe the closed lock back out and return
+ * STATUS_OBJECT_WAS_DELETED.  The caller must make the lock unreachable for
+ * new operations and call _CORE_BRWLock_Quiesce() before the storage of the
+ * lock is freed.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock to close.
+ * @param queue_context The thread queue context.
+ *
+ * @retval STATUS_SUCCESSFUL The lock was closed.
+ * @retval STATUS_RESOURCE_IN_USE The lock is in use, see
+ *   _CORE_BRWLock_Is_in_use().
+ */
+Status_Control _CORE_BRWLock_Close(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Waits until no processor executes in an operation which started
+ * before a big reader RWLock was closed.
+ *
+ * The operations access the lock only with interrupts disabled, so it is
+ * sufficient that each other processor passes through a section with
+ * interrupts enabled.
+ *
+ * @see _CORE_BRWLock_Close().
+ */
+void _CORE_BRWLock_Quiesce( void );
+
+/**
+ * @brief Returns the entry of the executing thread which records the read
+ * ownership of the big reader RWLock.
+ *
+ * @param executing The executing thread.
+ * @param the_rwlock The big reader RWLock, or NULL to get an unused entry.
+ *
+ * @return The entry, or NULL if there is no such entry.
+ */
+RTEMS_INLINE_ROUTINE CORE_BRWLock_Control **_CORE_BRWLock_Get_read_entry(
+  Thread_Control             *executing,
+  const CORE_BRWLock_Control *the_rwlock
+)
+{
+  size_t i;
+
+  for ( i = 0 ; i < _Thread_BRWLock_read_maximum ; ++i ) {
+    if ( executing->Cold->brwlocks_read[ i ] == the_rwlock ) {
+      return &executing->Cold->brwlocks_read[ i ];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Acquires the big reader RWLock thread queue in a critical section.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock.
+ * @param queue_context The thread queue context.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_BRWLock_Acquire_critical(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Acquire_critical( &the_rwlock->Wait_queue, queue_context );
+}
+
+/**
+ * @brief Releases the big reader RWLock thread queue.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock.
+ * @param queue_context The thread queue context.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_BRWLock_Release(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _Thread_queue_Release( &the_rwlock->Wait_queue, queue_context );
+}
+
+/**
+ * @brief Returns the reader counter of the current processor.
+ *
+ * @param the_rwlock The big reader RWLock.
+ *
+ * @return The reader counter of the current processor.
+ */
+RTEMS_INLINE_ROUTINE Atomic_Uint *_CORE_BRWLock_Get_reader_counter(
+  CORE_BRWLock_Control *the_rwlock
+)
+{
+  uint32_t cpu_index;
+
+  cpu_index = _Per_CPU_Get_index( _Per_CPU_Get_snapshot() );
+  return &the_rwlock->per_cpu[ cpu_index ].readers;
+}
+
+/**
+ * @brief Returns the sum of all per-processor reader counters.
+ *
+ * @param the_rwlock The big reader RWLock.
+ *
+ * @return The count of readers which currently hold the lock or try to
+ *   acquire it.
+ */
+unsigned int _CORE_BRWLock_Get_number_of_readers(
+  const CORE_BRWLock_Control *the_rwlock
+);
+
+/**
+ * @brief Checks if the big reader RWLock is in use.
+ *
+ * @param the_rwlock The big reader RWLock.
+ *
+ * @retval true The lock is owned by a reader or writer, threads wait for it,
+ *   or it is closed.
+ * @retval false Otherwise.
+ */
+bool _CORE_BRWLock_Is_in_use( const CORE_BRWLock_Control *the_rwlock );
+
+/**
+ * @brief Obtains the big reader RWLock for reading.
+ *
+ * The caller must disable interrupts and store the previous interrupt level
+ * in the thread queue context, e.g. via _Objects_Get().
+ *
+ * @param[in, out] the_rwlock The big reader RWLock to obtain.
+ * @param[in, out] executing The currently executing thread.
+ * @param wait This parameter is true if the calling thread is willing to
+ *   wait.
+ * @param queue_context The thread queue context.
+ *
+ * @retval STATUS_SUCCESSFUL The lock was obtained for reading.
+ * @retval STATUS_DEADLOCK The executing thread owns the lock already.
+ * @retval STATUS_TOO_MANY The executing thread owns already
+ *   _Thread_BRWLock_read_maximum big reader RWLocks for reading.
+ * @retval STATUS_OBJECT_WAS_DELETED The lock was closed.
+ * @retval STATUS_UNAVAILABLE The lock was not available and the thread was
+ *   not willing to wait.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_BRWLock_Seize_for_reading(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Obtains the big reader RWLock for writing.
+ *
+ * The caller must disable interrupts and store the previous interrupt level
+ * in the thread queue context, e.g. via _Objects_Get().
+ *
+ * @param[in, out] the_rwlock The big reader RWLock to obtain.
+ * @param[in, out] executing The currently executing thread.
+ * @param wait This parameter is true if the calling thread is willing to
+ *   wait.
+ * @param queue_context The thread queue context.
+ *
+ * @retval STATUS_SUCCESSFUL The lock was obtained for writing.
+ * @retval STATUS_DEADLOCK The executing thread owns the lock already.
+ * @retval STATUS_OBJECT_WAS_DELETED The lock was closed.
+ * @retval STATUS_UNAVAILABLE The lock was not available and the thread was
+ *   not willing to wait.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_BRWLock_Seize_for_writing(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Releases the big reader RWLock.
+ *
+ * The caller must disable interrupts and store the previous interrupt level
+ * in the thread queue context, e.g. via _Objects_Get().
+ *
+ * @param[in, out] the_rwlock The big reader RWLock to release.
+ * @param executing The currently executing thread.
+ * @param queue_context The thread queue context.
+ *
+ * @retval STATUS_SUCCESSFUL The lock was released.
+ * @retval STATUS_NOT_OWNER The executing thread does not own the lock.
+ */
+Status_Control _CORE_BRWLock_Surrender(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Leaves the big reader RWLock as a reader.
+ *
+ * Hands over the lock to a draining writer if this was the last reader.
+ * Interrupts are enabled and the thread queue is released on return.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock.
+ * @param queue_context The thread queue context.
+ */
+void _CORE_BRWLock_Reader_leave(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Hands over the big reader RWLock to the draining writer if no
+ * readers are left.
+ *
+ * The thread queue must be acquired by the caller.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock.
+ * @param queue_context The thread queue context.
+ *
+ * @retval true The lock was handed over.  Interrupts are enabled and the
+ *   thread queue is released.
+ * @retval false Otherwise.  The thread queue is still acquired.
+ */
+bool _CORE_BRWLock_Hand_over_to_writer(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+);
+
+/**
+ * @brief Releases the write ownership of the big reader RWLock.
+ *
+ * The thread queue must be acquired by the caller.  It is released on
+ * return.  The waiting readers at the head of the thread queue are granted
+ * the lock.  The first waiting writer becomes the next owner or starts to
+ * drain the readers.
+ *
+ * @param[in, out] the_rwlock The big reader RWLock.
+ * @param queue_context The thread queue context.
+ */
+void _CORE_BRWLock_Release_writer(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
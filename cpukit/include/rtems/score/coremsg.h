@@ -21,6 +21,7 @@
 #ifndef _RTEMS_SCORE_COREMSG_H
 #define _RTEMS_SCORE_COREMSG_H
 
+#include <rtems/score/atomic.h>
 #include <rtems/score/chain.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/threadq.h>
@@ -113,6 +114,73 @@ typedef enum {
   CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY
 }   CORE_message_queue_Disciplines;
 
+/**
+ * @brief A slot of a lock-free message queue ring.
+ */
+typedef struct {
+  /**
+   * @brief The sequence number of this slot.
+   *
+   * It is used to synchronize the producers with the consumers.
+   */
+  Atomic_Uint sequence;
+
+  /**
+   * @brief The message contained in this slot.
+   */
+  CORE_message_queue_Buffer Contents;
+} CORE_message_queue_Ring_slot;
+
+/**
+ * @brief Control block of a lock-free message queue ring.
+ *
+ * A ring may be used by one or more producers and one or more consumers.  The
+ * producer and consumer positions reside in distinct cache lines.
+ */
+typedef struct {
+  /**
+   * @brief The begin of the slot area.
+   */
+  char *slots;
+
+  /**
+   * @brief The size of a slot in bytes.
+   */
+  size_t slot_size;
+
+  /**
+   * @brief The slot count minus one.  The slot count is a power of two.
+   */
+  unsigned int mask;
+
+  /**
+   * @brief Indicates if more than one producer may use this ring.
+   */
+  bool multiple_producers;
+
+  /**
+   * @brief Indicates if receivers may wait for a message.
+   *
+   * Producers use this member to decide if they have to use the thread
+   * queue to wake up a receiver.  A receiver sets it before it blocks and a
+   * producer clears it if the thread queue is empty, both with the message
+   * queue lock acquired.  A receiver which was woken up or which timed out
+   * does not access the ring, so it may be deleted in the meantime.  A stale
+   * value only causes one needless acquire of the message queue lock.
+   */
+  Atomic_Uint waiting_receivers;
+
+  /**
+   * @brief The position of the next enqueue operation.
+   */
+  Atomic_Uint enqueue_position RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+  /**
+   * @brief The position of the next dequeue operation.
+   */
+  Atomic_Uint dequeue_position RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) CORE_message_queue_Ring;
+
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
   /**
    *  @brief Type for a notification handler.
@@ -174,6 +242,22 @@ struct CORE_message_queue_Control {
    *  when it does not contain a pending message.
    */
   Chain_Control                      Inactive_messages;
+  /** This is the lock-free ring used instead of the pending and inactive
+   *  message chains.  It is NULL for message queues without a ring.
+   */
+  CORE_message_queue_Ring           *ring;
+  /** This is the count of lock-free operations currently in progress on the
+   *  ring.  The CORE_MESSAGE_QUEUE_RING_CLOSED bit is set once the message
+   *  queue is about to be deleted, see _CORE_message_queue_Ring_close().
+   */
+  Atomic_Uint                        ring_users;
+  /** This is the thread queue of threads waiting to receive a loaned
+   *  message buffer, see _CORE_message_queue_Seize_loan().  These threads
+   *  may wait at the same time as threads waiting to send a message while
+   *  all message buffers are loaned, so they cannot use the Wait_queue.  The
+   *  lock of the Wait_queue must be obtained before the lock of this queue.
+   */
+  Thread_queue_Control               Loan_wait_queue;
 };
 
 /** @} */
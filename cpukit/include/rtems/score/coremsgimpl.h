@@ -56,6 +56,12 @@ extern "C" {
  */
 #define  CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ * @brief This bit of the ring users count indicates that the message queue is
+ * about to be deleted.
+ */
+#define CORE_MESSAGE_QUEUE_RING_CLOSED 0x80000000U
+
 /**
  *  @brief The modes in which a message may be submitted to a message queue.
  *
@@ -95,6 +101,36 @@ bool _CORE_message_queue_Initialize(
   size_t                          maximum_message_size
 );
 
+/**
+ * @brief Initializes a message queue with a lock-free ring.
+ *
+ * The messages of a message queue with a ring are passed through a
+ * lock-free ring in FIFO order.  The thread queue is only used to block and
+ * wake up receivers in case the ring is empty.  In case @a multiple_producers
+ * is false, then there must be at most one sender.  A sender does not block
+ * if the ring is full.
+ *
+ * @param[out] the_message_queue The message queue to initialize.
+ * @param discipline The blocking discipline for the message queue.
+ * @param maximum_pending_messages The maximum number of messages
+ *        that will be allowed to pend at any given time.  It must be a
+ *        power of two.
+ * @param maximum_message_size The size of the largest message that
+ *        may be sent to this message queue instance.
+ * @param multiple_producers Indicates if more than one sender may use the
+ *        message queue.
+ *
+ * @retval true The message queue can be initialized.
+ * @retval false Memory for the ring cannot be allocated.
+ */
+bool _CORE_message_queue_Initialize_ring(
+  CORE_message_queue_Control     *the_message_queue,
+  CORE_message_queue_Disciplines  discipline,
+  uint32_t                        maximum_pending_messages,
+  size_t                          maximum_message_size,
+  bool                            multiple_producers
+);
+
 /**
  * @brief Closes a message queue.
  *
@@ -260,6 +296,176 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Starts a lock-free operation on the ring of the message queue.
+ *
+ * The ring is not freed before the operation ends, see
+ * _CORE_message_queue_Ring_leave().  Interrupts must be disabled until the
+ * operation ends, since _CORE_message_queue_Ring_close() busy waits for it.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ *
+ * @retval true The operation may access the ring.
+ * @retval false The message queue is about to be deleted.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Ring_enter(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  unsigned int users;
+
+  users = _Atomic_Fetch_add_uint(
+    &the_message_queue->ring_users,
+    1,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  if ( ( users & CORE_MESSAGE_QUEUE_RING_CLOSED ) != 0 ) {
+    _Atomic_Fetch_sub_uint(
+      &the_message_queue->ring_users,
+      1,
+      ATOMIC_ORDER_RELAXED
+    );
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Ends a lock-free operation on the ring of the message queue.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Ring_leave(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  _Atomic_Fetch_sub_uint(
+    &the_message_queue->ring_users,
+    1,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/**
+ * @brief Closes the ring of the message queue for lock-free operations.
+ *
+ * Subsequent lock-free operations fail with
+ * STATUS_MESSAGE_QUEUE_WAS_DELETED.  Busy waits until all lock-free
+ * operations in progress on other processors ended.  This function must be
+ * called before the message queue lock is acquired to close the message
+ * queue, since the operations in progress may acquire it.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ */
+void _CORE_message_queue_Ring_close(
+  CORE_message_queue_Control *the_message_queue
+);
+
+/**
+ * @brief Submits a message to the lock-free ring of the message queue.
+ *
+ * The message is submitted without acquiring the message queue lock.  The
+ * lock is only acquired to wake up a waiting receiver.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ * @param buffer The starting address of the message content.
+ * @param size The size of the message content.
+ * @param queue_context The thread queue context with interrupts disabled.
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully submitted.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size is too large.
+ * @retval STATUS_TOO_MANY The ring is full.
+ * @retval STATUS_MESSAGE_QUEUE_WAS_DELETED The message queue is about to be
+ *   deleted.
+ */
+Status_Control _CORE_message_queue_Ring_submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Seizes a message from the lock-free ring of the message queue.
+ *
+ * The message is fetched without acquiring the message queue lock.  The
+ * lock is only acquired to block the receiver in case the ring is empty.
+ * Multiple receivers may use the ring concurrently.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ * @param executing The currently executing thread.
+ * @param[out] buffer The buffer for the message content.
+ * @param[out] size_p The size of the message content.
+ * @param wait Indicates if the receiver shall wait for a message.
+ * @param queue_context The thread queue context with interrupts disabled.
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully received.
+ * @retval STATUS_UNSATISFIED The ring was empty and @a wait is false.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ * @retval STATUS_MESSAGE_QUEUE_WAS_DELETED The message queue was deleted.
+ */
+Status_Control _CORE_message_queue_Ring_seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Flushes the messages pending in the lock-free ring.
+ *
+ * This function acts as a consumer of the ring.  It may be called
+ * concurrently with receivers of the message queue.  The message queue lock
+ * shall be acquired.
+ *
+ * @param[in, out] the_message_queue The message queue with a ring.
+ *
+ * @return The count of flushed messages.
+ */
+uint32_t _CORE_message_queue_Ring_flush(
+  CORE_message_queue_Control *the_message_queue
+);
+
+/**
+ * @brief Gets the count of messages pending in the lock-free ring.
+ *
+ * The count is a snapshot which may be out of date if producers or
+ * consumers operate concurrently.  The caller shall start a lock-free
+ * operation, see _CORE_message_queue_Ring_enter().
+ *
+ * @param the_message_queue The message queue with a ring.
+ *
+ * @return The count of pending messages.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _CORE_message_queue_Ring_get_number_pending(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Ring *ring;
+  unsigned int             enqueue_position;
+  unsigned int             dequeue_position;
+
+  ring = the_message_queue->ring;
+  dequeue_position = _Atomic_Load_uint(
+    &ring->dequeue_position,
+    ATOMIC_ORDER_RELAXED
+  );
+  enqueue_position = _Atomic_Load_uint(
+    &ring->enqueue_position,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( enqueue_position - dequeue_position > ring->mask + 1 ) {
+    return ring->mask + 1;
+  }
+
+  return enqueue_position - dequeue_position;
+}
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -281,6 +487,114 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ * @brief Enqueues a filled message buffer to the pending messages.
+ *
+ * In contrast to _CORE_message_queue_Insert_message() the message content is
+ * not copied.  The message size must be already set.
+ *
+ * @param[in, out] the_message_queue The message queue to insert a message in.
+ * @param[in, out] the_message The filled message buffer to insert.
+ * @param submit_type The message submit type.
+ */
+void _CORE_message_queue_Enqueue_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  CORE_message_queue_Submit_types    submit_type
+);
+
+/**
+ * @brief Loans a message buffer of the message queue.
+ *
+ * The caller may fill in the message content directly and submit it with
+ * _CORE_message_queue_Commit() or give it back with
+ * _CORE_message_queue_Return().  This function does not block.
+ *
+ * @param[in, out] the_message_queue The message queue to loan a buffer from.
+ * @param[out] the_message_p The loaned message buffer.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message buffer was successfully loaned.
+ * @retval STATUS_TOO_MANY No message buffer was available.
+ */
+Status_Control _CORE_message_queue_Loan(
+  CORE_message_queue_Control         *the_message_queue,
+  CORE_message_queue_Buffer_control **the_message_p,
+  Thread_queue_Context               *queue_context
+);
+
+/**
+ * @brief Commits a loaned message buffer to the message queue.
+ *
+ * If a thread waits to receive a loaned buffer, then the message buffer is
+ * handed over without a copy.
+ *
+ * @param[in, out] the_message_queue The message queue to commit the message
+ *   buffer to.
+ * @param[in, out] the_message The loaned message buffer.
+ * @param size The size of the message content.
+ * @param submit_type The message submit type.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully committed.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size is too large.  The
+ *   message buffer remains loaned.
+ */
+Status_Control _CORE_message_queue_Commit(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+);
+
+/**
+ * @brief Seizes a message from the message queue without a copy.
+ *
+ * The received message buffer is loaned to the caller.  It must be given
+ * back with _CORE_message_queue_Return().
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message
+ *   buffer from.
+ * @param executing The currently executing thread.
+ * @param[out] the_message_p The loaned message buffer.
+ * @param wait Indicates if the calling thread is willing to block.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully received.
+ * @retval STATUS_UNSATISFIED There was no message and @a wait is false.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_loan(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+);
+
+/**
+ * @brief Gives a loaned message buffer back to the message queue.
+ *
+ * In case a thread waits to send a message, then the message is placed in
+ * this buffer on behalf of the waiting thread.  If additionally a thread
+ * waits to receive a loaned message buffer, then this buffer is handed over
+ * to it.
+ *
+ * @param[in, out] the_message_queue The message queue of the message buffer.
+ * @param[in, out] the_message The loaned message buffer.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ */
+void _CORE_message_queue_Return(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+);
+
 /**
  * @brief Sends a message to the message queue.
  *
@@ -395,6 +709,72 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Release(
   _Thread_queue_Release( &the_message_queue->Wait_queue, queue_context );
 }
 
+/**
+ * @brief Acquires the queue of threads waiting for a loaned message buffer.
+ *
+ * The message queue must be acquired by the caller.
+ *
+ * @param[in, out] the_message_queue The message queue.
+ * @param queue_context The thread queue context of the message queue.
+ * @param[out] lock_context The interrupt lock context for the nested lock.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Acquire_loan_receivers(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context,
+  ISR_lock_Context           *lock_context
+)
+{
+  *lock_context = queue_context->Lock_context.Lock_context;
+  _Thread_queue_Do_acquire_critical(
+    &the_message_queue->Loan_wait_queue,
+    lock_context
+  );
+}
+
+/**
+ * @brief Releases the queue of threads waiting for a loaned message buffer.
+ *
+ * @param[in, out] the_message_queue The message queue.
+ * @param lock_context The interrupt lock context of the nested lock.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Release_loan_receivers(
+  CORE_message_queue_Control *the_message_queue,
+  ISR_lock_Context           *lock_context
+)
+{
+  _Thread_queue_Do_release_critical(
+    &the_message_queue->Loan_wait_queue,
+    lock_context
+  );
+}
+
+/**
+ * @brief Releases the message queue and keeps the queue of threads waiting
+ *   for a loaned message buffer acquired.
+ *
+ * Afterwards, the thread queue context belongs to the loan wait queue, so
+ * that it can be used to enqueue or extract a thread.  Interrupts remain
+ * disabled.
+ *
+ * @param[in, out] the_message_queue The message queue.
+ * @param[in, out] queue_context The thread queue context of the message
+ *   queue.
+ * @param lock_context The interrupt lock context used for
+ *   _CORE_message_queue_Acquire_loan_receivers().
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Hand_over_to_loan_receivers(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context,
+  ISR_lock_Context           *lock_context
+)
+{
+  _Thread_queue_Release_critical(
+    &the_message_queue->Wait_queue,
+    queue_context
+  );
+  queue_context->Lock_context.Lock_context = *lock_context;
+}
+
 /**
  * @brief Copies the source message buffer to the destination message buffer.
  *
@@ -451,6 +831,57 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * @brief Gets the loaned message buffer associated with the message content.
+ *
+ * @param the_message_queue The message queue of the message buffer.
+ * @param buffer The message content of a loaned message buffer.
+ *
+ * @retval pointer The loaned message buffer.
+ * @retval NULL The message content does not belong to a loaned message
+ *   buffer of this message queue.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_loaned_message(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  uintptr_t                          begin;
+  uintptr_t                          offset;
+  size_t                             buffer_size;
+  size_t                             align_mask;
+
+  if ( the_message_queue->message_buffers == NULL || buffer == NULL ) {
+    return NULL;
+  }
+
+  the_message = RTEMS_CONTAINER_OF(
+    buffer,
+    CORE_message_queue_Buffer_control,
+    Contents.buffer
+  );
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) the_message - begin;
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  buffer_size = ( the_message_queue->maximum_message_size + align_mask )
+    & ~align_mask;
+  buffer_size += sizeof( CORE_message_queue_Buffer_control );
+
+  if (
+    (uintptr_t) the_message < begin
+      || offset % buffer_size != 0
+      || offset / buffer_size >= the_message_queue->maximum_pending_messages
+      || !_Chain_Is_node_off_chain( &the_message->Node )
+  ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
 /**
  * @brief Gets message priority.
  *
@@ -538,6 +969,95 @@ RTEMS_INLINE_ROUTINE
     do { } while ( 0 )
 #endif
 
+/**
+ * @brief Gets the first thread waiting to receive a loaned message buffer and
+ *   dequeues it.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param the_message The message buffer to hand over.  In case it is NULL,
+ *   then a message buffer is allocated.
+ * @param buffer The message content to copy to the message buffer.  In case
+ *   it is NULL, then the message buffer is already filled.
+ * @param size The size of the message content.
+ * @param submit_type The message submit type.
+ * @param queue_context The thread queue context.
+ *
+ * @retval thread The dequeued thread.  The message queue is released.
+ * @retval NULL No thread waits for a loaned message buffer or no message
+ *   buffer was available.  The message queue is still acquired.
+ */
+RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_loan_receiver(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  const void                        *buffer,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  ISR_lock_Context  lock_context;
+  Thread_Control   *the_thread;
+
+  _CORE_message_queue_Acquire_loan_receivers(
+    the_message_queue,
+    queue_context,
+    &lock_context
+  );
+
+  the_thread = _Thread_queue_First_locked(
+    &the_message_queue->Loan_wait_queue,
+    the_message_queue->operations
+  );
+  if ( the_thread == NULL ) {
+    _CORE_message_queue_Release_loan_receivers(
+      the_message_queue,
+      &lock_context
+    );
+    return NULL;
+  }
+
+  if ( the_message == NULL ) {
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      _CORE_message_queue_Release_loan_receivers(
+        the_message_queue,
+        &lock_context
+      );
+      return NULL;
+    }
+
+    _Chain_Set_off_chain( &the_message->Node );
+  }
+
+  if ( buffer != NULL ) {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_message->Contents.buffer,
+      size
+    );
+  }
+
+  the_message->Contents.size = size;
+  *(CORE_message_queue_Buffer_control **) the_thread->Wait.return_argument =
+    the_message;
+  the_thread->Wait.count = (uint32_t) submit_type;
+
+  _CORE_message_queue_Hand_over_to_loan_receivers(
+    the_message_queue,
+    queue_context,
+    &lock_context
+  );
+  _Thread_queue_Extract_critical(
+    &the_message_queue->Loan_wait_queue.Queue,
+    the_message_queue->operations,
+    the_thread,
+    queue_context
+  );
+
+  return the_thread;
+}
+
 /**
  * @brief Gets the first locked thread waiting to receive and dequeues it.
  *
@@ -577,14 +1097,25 @@ RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
 
   /*
    *  There must be no pending messages if there is a thread waiting to
-   *  receive a message.
+   *  receive a message.  Threads waiting to send a message have no return
+   *  argument.  They may wait with no pending messages while all message
+   *  buffers are loaned.  A receiver which would block in this state takes
+   *  the message of a waiting sender, see _CORE_message_queue_Seize(), so
+   *  the wait queue contains either only senders or only receivers.
    */
   the_thread = _Thread_queue_First_locked(
     &the_message_queue->Wait_queue,
     the_message_queue->operations
   );
-  if ( the_thread == NULL ) {
-    return NULL;
+  if ( the_thread == NULL || the_thread->Wait.return_argument == NULL ) {
+    return _CORE_message_queue_Dequeue_loan_receiver(
+      the_message_queue,
+      NULL,
+      buffer,
+      size,
+      submit_type,
+      queue_context
+    );
   }
 
    *(size_t *) the_thread->Wait.return_argument = size;
@@ -211,6 +211,9 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Seize_nested(
  * @param nested Returns the status of a recursive mutex.
  * @param queue_context The thread queue context.
  *
+ * On SMP configurations, the executing thread spins while the owner executes
+ * on another processor before it blocks, see _Thread_queue_Spin_on_owner().
+ *
  * @retval STATUS_SUCCESSFUL The owner of the mutex was NULL, successful
  *      seizing of the mutex.
  * @retval _Thread_Wait_get_status The status of the executing thread.
@@ -246,6 +249,23 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_recursive_mutex_Seize(
     return status;
   }
 
+#if defined(RTEMS_SMP)
+  if (
+    wait
+      && _Thread_queue_Spin_on_owner(
+        &the_mutex->Mutex.Wait_queue.Queue,
+        owner,
+        executing,
+        queue_context
+      )
+  ) {
+    _CORE_mutex_Set_owner( &the_mutex->Mutex, executing );
+    _Thread_Resource_count_increment( executing );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   return _CORE_mutex_Seize_slow(
     &the_mutex->Mutex,
     operations,
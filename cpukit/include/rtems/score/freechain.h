@@ -18,6 +18,7 @@
 
 #include <rtems/score/basedefs.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,30 @@ extern "C" {
  */
 typedef void *( *Freechain_Allocator )( size_t size );
 
+/**
+ * @brief A per-processor cache of free nodes.
+ *
+ * @see _Freechain_Initialize_caches().
+ */
+typedef struct {
+  /**
+   * @brief The lock to protect the cache.
+   *
+   * The lock is necessary to drain the cache of another processor.
+   */
+  ISR_LOCK_MEMBER( Lock )
+
+  /**
+   * @brief Chain of free nodes of this cache.
+   */
+  Chain_Control Free;
+
+  /**
+   * @brief The count of nodes on the free chain of this cache.
+   */
+  size_t count;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Freechain_Cache;
+
 /**
  * @brief The freechain control.
  */
@@ -50,6 +75,27 @@ typedef struct {
    * @brief Chain of free nodes.
    */
   Chain_Control Free;
+
+  /**
+   * @brief The per-processor caches.
+   *
+   * In case this member is @c NULL, then the freechain has no caches and the
+   * free chain is protected by the lock of the user, e.g. the allocator
+   * mutex.  Otherwise, the free chain is protected by the freechain lock.
+   */
+  Freechain_Cache *caches;
+
+  /**
+   * @brief The count of nodes moved between a cache and the free chain at
+   * once.
+   */
+  size_t batch_size;
+
+  /**
+   * @brief The lock to protect the free chain in case per-processor caches are
+   * used.
+   */
+  ISR_LOCK_MEMBER( Lock )
 } Freechain_Control;
 
 /**
@@ -77,8 +123,37 @@ RTEMS_INLINE_ROUTINE void _Freechain_Initialize(
     number_nodes,
     node_size
   );
+  freechain->caches = NULL;
 }
 
+/**
+ * @brief Initializes the per-processor caches of a freechain.
+ *
+ * Afterwards, _Freechain_Get() and _Freechain_Put() serve nodes from the cache
+ * of the current processor.  Only if a cache is empty or full, nodes are moved
+ * in batches between the cache and the free chain of the freechain.  These
+ * operations are protected by ISR locks, so they no longer depend on a lock
+ * of the user, except in case the freechain must be extended.
+ *
+ * @param[in, out] freechain The freechain control.  It must be initialized.
+ * @param[out] caches The per-processor caches.  There must be one cache for
+ *   each configured processor.
+ * @param batch_size The count of nodes to move between a cache and the free
+ *   chain at once.  It must be positive.
+ */
+void _Freechain_Initialize_caches(
+  Freechain_Control *freechain,
+  Freechain_Cache   *caches,
+  size_t             batch_size
+);
+
+/**
+ * @brief Moves all nodes of the per-processor caches back to the free chain.
+ *
+ * @param[in, out] freechain The freechain control.
+ */
+void _Freechain_Flush_caches( Freechain_Control *freechain );
+
 /**
  * @brief Return true if the freechain is empty, otherwise false
  *
@@ -130,6 +205,9 @@ void *_Freechain_Extend(
  *   necessary due to an empty freechain.
  * @param[in] node_size The node size.
  *
+ * In case the freechain has per-processor caches and is extended, then the
+ * caller must own the lock which protects the allocator function.
+ *
  * @retval NULL The freechain is empty and the extend operation failed.
  * @retval pointer Pointer to a node.  The node ownership passes to the
  * caller.
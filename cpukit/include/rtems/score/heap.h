@@ -42,6 +42,12 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally, a heap may be initialized with _Heap_Initialize_segregated().
+ * In this case the free list is ordered by block size classes and a two-level
+ * segregated fit index (TLSF) is maintained, see @ref Heap_Segregated_index.
+ * This bounds the allocation and free time independent of the heap
+ * fragmentation.  The block layout is the same for both methods.
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -312,11 +318,67 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief Shift to get the second level index count of the segregated fit free
+ * block index.
+ *
+ * Each power of two range of block sizes is divided into this many equally
+ * sized block size classes.
+ */
+#define HEAP_SEGREGATED_SECOND_LEVEL_SHIFT 4
+
+/**
+ * @brief Count of second level indices of the segregated fit free block index.
+ */
+#define HEAP_SEGREGATED_SECOND_LEVEL_COUNT \
+  (1U << HEAP_SEGREGATED_SECOND_LEVEL_SHIFT)
+
+/**
+ * @brief Count of first level indices of the segregated fit free block index.
+ *
+ * There is one first level index for each bit of a block size.
+ */
+#define HEAP_SEGREGATED_FIRST_LEVEL_COUNT (8 * sizeof(uintptr_t))
+
+/**
+ * @brief Two-level segregated fit index of the free blocks.
+ *
+ * The free blocks are still contained in the free list of the heap, however,
+ * the free list is ordered by block size classes.  A block size class is
+ * determined by the most significant bit of the block size (first level) and
+ * the next @ref HEAP_SEGREGATED_SECOND_LEVEL_SHIFT bits (second level).  The
+ * index provides the first free block of each non-empty block size class and
+ * bitmaps to find the next non-empty block size class in constant time.
+ *
+ * @see _Heap_Initialize_segregated().
+ */
+typedef struct {
+  /**
+   * @brief Bitmap of first level indices with at least one non-empty block
+   * size class.
+   */
+  uintptr_t first_level_map;
+
+  /**
+   * @brief Bitmaps of the non-empty block size classes for each first level
+   * index.
+   */
+  uint32_t second_level_map[ HEAP_SEGREGATED_FIRST_LEVEL_COUNT ];
+
+  /**
+   * @brief First free block of each block size class or NULL if the block size
+   * class is empty.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FIRST_LEVEL_COUNT ]
+    [ HEAP_SEGREGATED_SECOND_LEVEL_COUNT ];
+} Heap_Segregated_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+  Heap_Segregated_index *segregated_index;
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
@@ -20,6 +20,8 @@
 
 #include <rtems/score/heap.h>
 
+#include <strings.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -98,6 +100,38 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Initializes the heap control block for the two-level segregated fit
+ * allocation method.
+ *
+ * The @ref Heap_Segregated_index is placed at the begin of the area, the
+ * remaining area is initialized by _Heap_Initialize().  All heap operations
+ * are available for the heap.  The allocation and free time of the heap is
+ * bounded and independent of the count of free blocks.  An allocation looks
+ * only at the first free block of the smallest block size class which
+ * contains exclusively blocks of sufficient size.  For allocations with an
+ * alignment or boundary constraint, the searched size includes a margin which
+ * covers the worst case placement.  In contrast to the first fit method, an
+ * allocation may therefore fail if the heap is nearly exhausted, even if a
+ * free block of sufficient size exists.
+ *
+ * @param[out] heap The heap control block to manage the area.
+ * @param area_begin The starting address of the area.
+ * @param area_size The size of the area in bytes.
+ * @param page_size The page size for the calculation
+ *
+ * @retval some_value The maximum memory available.
+ * @retval 0 The initialization failed.
+ *
+ * @see Heap_Initialization_or_extend_handler.
+ */
+uintptr_t _Heap_Initialize_segregated(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
 /**
  * @brief Allocates an aligned memory area with boundary constraint.
  *
@@ -562,6 +596,178 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+/**
+ * @brief Checks if the heap uses the two-level segregated fit index.
+ *
+ * @param heap The heap to operate upon.
+ *
+ * @retval true The heap was initialized by _Heap_Initialize_segregated().
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Heap_Is_segregated( const Heap_Control *heap )
+{
+  return heap->segregated_index != NULL;
+}
+
+/**
+ * @brief Maps the block size to the first and second level indices of the
+ * segregated fit index.
+ *
+ * @param block_size The block size.  It must be greater than or equal to
+ *   2 to the power of @ref HEAP_SEGREGATED_SECOND_LEVEL_SHIFT.
+ * @param[out] first_level Stores the first level index.
+ * @param[out] second_level Stores the second level index.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_map(
+  uintptr_t     block_size,
+  unsigned int *first_level,
+  unsigned int *second_level
+)
+{
+  unsigned int fl;
+
+  fl = (unsigned int) flsl( (long) block_size ) - 1;
+  *first_level = fl;
+  *second_level = (unsigned int)
+    ( block_size >> ( fl - HEAP_SEGREGATED_SECOND_LEVEL_SHIFT ) )
+      - HEAP_SEGREGATED_SECOND_LEVEL_COUNT;
+}
+
+/**
+ * @brief Inserts the free block into the segregated fit index and the free
+ * list.
+ *
+ * The block size must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The free block to insert.
+ */
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block from the segregated fit index and the free
+ * list.
+ *
+ * The block size must be the size used to insert the block.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The free block to remove.
+ */
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Searches the first free block of the first non-empty block size
+ * class which contains blocks with a size greater than or equal to the
+ * specified size.
+ *
+ * In the free list, all subsequent blocks belong to the same or a greater
+ * block size class.
+ *
+ * @param heap The heap to operate upon.
+ * @param block_size The block size to search for.
+ * @param good_fit If true, then the search starts at the next block size
+ *   class if @a block_size is not the minimum size of its class.  All
+ *   blocks of the returned block size class are then big enough.
+ *
+ * @return The first free block of the block size class.  In case no
+ *   appropriate block size class exists, the free list tail is returned.
+ */
+Heap_Block *_Heap_Segregated_search(
+  Heap_Control *heap,
+  uintptr_t     block_size,
+  bool          good_fit
+);
+
+/**
+ * @brief Inserts a new free block into the free list of the heap.
+ *
+ * If the heap uses the segregated fit index, then the block is inserted
+ * according to its block size class and @a block_before is ignored,
+ * otherwise the block is inserted after @a block_before.  The block size
+ * must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block_before The block that is already in the free list.
+ * @param new_block The block to insert.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block   *block_before,
+  Heap_Block   *new_block
+)
+{
+  if ( _Heap_Is_segregated( heap ) ) {
+    _Heap_Segregated_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_insert_after( block_before, new_block );
+  }
+}
+
+/**
+ * @brief Removes the free block from the free list of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The block to remove.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block   *block
+)
+{
+  if ( _Heap_Is_segregated( heap ) ) {
+    _Heap_Segregated_remove( heap, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces one free block in the free list of the heap by another.
+ *
+ * The block size of both blocks must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param old_block The block in the free list to replace.
+ * @param new_block The block that should replace @a old_block.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block   *old_block,
+  Heap_Block   *new_block
+)
+{
+  if ( _Heap_Is_segregated( heap ) ) {
+    _Heap_Segregated_remove( heap, old_block );
+    _Heap_Segregated_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of a block in the free list of the heap.
+ *
+ * The previous block of a free block is always used.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param[in, out] block The block in the free list.
+ * @param size The new size of the block.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+)
+{
+  if ( _Heap_Is_segregated( heap ) ) {
+    _Heap_Segregated_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
 /**
  * @brief Checks if the value is aligned to the given alignment.
  *
@@ -203,7 +203,8 @@ typedef enum {
   INTERNAL_ERROR_LIBIO_STDERR_FD_OPEN_FAILED = 37,
   INTERNAL_ERROR_ILLEGAL_USE_OF_FLOATING_POINT_UNIT = 38,
   INTERNAL_ERROR_ARC4RANDOM_GETENTROPY_FAIL = 39,
-  INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA = 40
+  INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA = 40,
+  INTERNAL_ERROR_STACK_POOL_GUARD_CORRUPTED = 41
 } Internal_errors_Core_list;
 
 typedef CPU_Uint32ptr Internal_errors_t;
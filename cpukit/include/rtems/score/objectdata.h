@@ -74,7 +74,8 @@ typedef enum {
   OBJECTS_RTEMS_PORTS,
   OBJECTS_RTEMS_PERIODS,
   OBJECTS_RTEMS_EXTENSIONS,
-  OBJECTS_RTEMS_BARRIERS
+  OBJECTS_RTEMS_BARRIERS,
+  OBJECTS_RTEMS_RWLOCKS
 } Objects_Classic_API;
 
 /**
@@ -164,6 +165,39 @@ typedef void ( *Objects_Thread_queue_Extract_callout )(
 
 typedef struct Objects_Information Objects_Information;
 
+/**
+ * @brief The name hash index of the local objects of an API class.
+ *
+ * The index uses open addressing with linear probing.  Each slot contains
+ * the object index (see _Objects_Get_index()) of an active local object with
+ * a valid name or zero for an empty slot.  The slot count is two times the
+ * object maximum plus one, so there is always an empty slot which terminates
+ * a probe sequence.
+ *
+ * @see _Objects_Name_index_initialize().
+ */
+typedef struct {
+  /**
+   * @brief The count of slots.
+   */
+  uint32_t size;
+
+  /**
+   * @brief The slots.
+   */
+  Objects_Maximum slots[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Objects_Name_index;
+
+/**
+ * @brief Returns the size in bytes of a name hash index for the specified
+ * object maximum.
+ *
+ * @param maximum The object maximum.
+ */
+#define OBJECTS_NAME_INDEX_SIZE( maximum ) \
+  ( sizeof( Objects_Name_index ) \
+    + ( 2 * (size_t) ( maximum ) + 1 ) * sizeof( Objects_Maximum ) )
+
 /**
  * @brief The information structure used to manage each API class of objects.
  *
@@ -308,6 +342,16 @@ struct Objects_Information {
    */
   RBTree_Control Global_by_name;
 #endif
+
+  /**
+   * @brief The optional name hash index of the local objects.
+   *
+   * This member is statically initialized to NULL.  In case
+   * CONFIGURE_OBJECTS_NAME_INDEX is defined by the application configuration,
+   * then _Objects_Name_index_initialize() installs an index for API classes
+   * with name lookups.  _Objects_Extend_information() rebuilds the index.
+   */
+  Objects_Name_index *name_index;
 };
 
 /**
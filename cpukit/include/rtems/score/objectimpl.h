@@ -51,7 +51,7 @@ typedef bool    (*Objects_Name_comparators)(
 #define OBJECTS_INTERNAL_CLASSES_LAST OBJECTS_INTERNAL_THREADS
 
 /** This macro is used to generically specify the last API index. */
-#define OBJECTS_RTEMS_CLASSES_LAST OBJECTS_RTEMS_BARRIERS
+#define OBJECTS_RTEMS_CLASSES_LAST OBJECTS_RTEMS_RWLOCKS
 
 /** This macro is used to generically specify the last API index. */
 #define OBJECTS_POSIX_CLASSES_LAST OBJECTS_POSIX_SHMS
@@ -243,6 +243,99 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
   Objects_Id          *id
 );
 
+/**
+ * @brief Installs the name hash index for each API class with name lookups.
+ *
+ * The name hash index is installed for the Classic API classes and the POSIX
+ * API classes with string names which have a non-zero object maximum.  The
+ * index storage is allocated from the workspace.  In case the allocation
+ * fails, then the API class uses the linear search.
+ *
+ * This handler is registered by <rtems/confdefs.h> in case
+ * CONFIGURE_OBJECTS_NAME_INDEX is defined.
+ */
+void _Objects_Name_index_initialize( void );
+
+/**
+ * @brief Rebuilds the name hash index of the object information for the
+ * current object maximum.
+ *
+ * In case the index storage allocation fails, then the index is removed and
+ * the API class uses the linear search.
+ *
+ * @param[in, out] information The object information.
+ *
+ * @retval true The index was rebuilt.
+ * @retval false Otherwise.
+ */
+bool _Objects_Name_index_rebuild( Objects_Information *information );
+
+/**
+ * @brief Inserts the object into the name hash index of the object
+ * information.
+ *
+ * The object must be an active local object.  Objects with an invalid name
+ * are not inserted.
+ *
+ * @param information The object information with a name hash index.
+ * @param the_object The object to insert.
+ */
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Removes the object from the name hash index of the object
+ * information.
+ *
+ * This operation has no effect if the object is not in the index.
+ *
+ * @param information The object information with a name hash index.
+ * @param the_object The object to remove.  The object name must be the name
+ *   used for the insert operation.
+ */
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Finds the first object according to the object index associated
+ * with the 32-bit integer name.
+ *
+ * The object information must use 32-bit integer names.  The caller must own
+ * the object allocator lock.
+ *
+ * @param information The object information.
+ * @param name The object name.
+ *
+ * @retval NULL No object exists for this name.
+ * @retval object The object associated with this name.
+ */
+Objects_Control *_Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+);
+
+/**
+ * @brief Finds the first object according to the object index associated
+ * with the string name.
+ *
+ * The object information must use string names.  The caller must own the
+ * object allocator lock.
+ *
+ * @param information The object information.
+ * @param name The object name.
+ *
+ * @retval NULL No object exists for this name.
+ * @retval object The object associated with this name.
+ */
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name
+);
+
 typedef enum {
   OBJECTS_GET_BY_NAME_INVALID_NAME,
   OBJECTS_GET_BY_NAME_NAME_TOO_LONG,
@@ -485,6 +578,11 @@ RTEMS_INLINE_ROUTINE void _Objects_Namespace_remove_u32(
 )
 {
   _Assert( !_Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   the_object->name.name_u32 = 0;
 }
 
@@ -727,6 +825,10 @@ RTEMS_INLINE_ROUTINE void _Objects_Invalidate_Id(
   _Assert( information != NULL );
   _Assert( the_object != NULL );
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   _Objects_Set_local_object(
     information,
     _Objects_Get_index( the_object->id ),
@@ -760,6 +862,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
@@ -786,6 +891,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
@@ -812,6 +920,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
@@ -27,7 +27,9 @@
   #include <rtems/score/assert.h>
   #include <rtems/score/chain.h>
   #include <rtems/score/isrlock.h>
+  #include <rtems/score/processormask.h>
   #include <rtems/score/smp.h>
+  #include <rtems/score/smplockseq.h>
   #include <rtems/score/timestamp.h>
   #include <rtems/score/watchdog.h>
 #endif
@@ -39,7 +41,7 @@ extern "C" {
 #if defined(RTEMS_SMP)
   #if defined(RTEMS_PROFILING)
     #define PER_CPU_CONTROL_SIZE_APPROX \
-      ( 512 + CPU_PER_CPU_CONTROL_SIZE + CPU_INTERRUPT_FRAME_SIZE )
+      ( 1280 + CPU_PER_CPU_CONTROL_SIZE + CPU_INTERRUPT_FRAME_SIZE )
   #elif defined(RTEMS_DEBUG) || CPU_SIZEOF_POINTER > 4
     #define PER_CPU_CONTROL_SIZE_APPROX \
       ( 256 + CPU_PER_CPU_CONTROL_SIZE + CPU_INTERRUPT_FRAME_SIZE )
@@ -230,6 +232,70 @@ typedef struct Per_CPU_Job {
 
 #endif /* defined( RTEMS_SMP ) */
 
+/**
+ * @brief Per-CPU latency statistics index.
+ */
+typedef enum {
+  PER_CPU_LATENCY_SCHEDULER_BLOCK,
+  PER_CPU_LATENCY_SCHEDULER_UNBLOCK,
+  PER_CPU_LATENCY_SCHEDULER_UPDATE_PRIORITY,
+  PER_CPU_LATENCY_THREAD_DISPATCH,
+  PER_CPU_LATENCY_COUNT
+} Per_CPU_Latency_index;
+
+/**
+ * @brief Count of bins of the per-CPU latency histograms.
+ *
+ * The bin with index zero counts operations which took no CPU counter tick.
+ * The bin with index N greater than zero counts operations which took at
+ * least 2**(N - 1) and less than 2**N CPU counter ticks.  The last bin counts
+ * all longer operations.
+ */
+#define PER_CPU_LATENCY_HISTOGRAM_BINS 20
+
+#if defined( RTEMS_PROFILING )
+/**
+ * @brief Per-CPU latency statistics of an operation.
+ */
+typedef struct {
+#if defined( RTEMS_SMP )
+  /**
+   * @brief Protects the statistics against torn reads on other processors.
+   *
+   * The statistics are written only by the owning processor with interrupts
+   * disabled.
+   */
+  SMP_sequence_lock_Control Lock;
+#endif
+
+  /**
+   * @brief The maximum operation time in CPU counter ticks.
+   */
+  CPU_Counter_ticks max_time;
+
+  /**
+   * @brief Count of operations.
+   *
+   * This value may overflow.
+   */
+  uint64_t count;
+
+  /**
+   * @brief Total operation time in CPU counter ticks.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_time;
+
+  /**
+   * @brief The latency histogram.
+   *
+   * @see PER_CPU_LATENCY_HISTOGRAM_BINS.
+   */
+  uint64_t histogram[ PER_CPU_LATENCY_HISTOGRAM_BINS ];
+} Per_CPU_Latency_stats;
+#endif /* defined( RTEMS_PROFILING ) */
+
 /**
  * @brief Per-CPU statistics.
  */
@@ -299,6 +365,28 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+  /**
+   * @brief Count of contended mutex seize operations which obtained the mutex
+   * after spinning on the owner.
+   *
+   * This value may overflow.
+   */
+  uint64_t mutex_spin_acquire_count;
+
+  /**
+   * @brief Count of contended mutex seize operations which blocked with the
+   * adaptive spinning enabled.
+   *
+   * This value may overflow.
+   */
+  uint64_t mutex_block_count;
+
+  /**
+   * @brief Latency statistics of the scheduler operations and the thread
+   * dispatch carried out by this processor.
+   */
+  Per_CPU_Latency_stats Latency[ PER_CPU_LATENCY_COUNT ];
 #endif /* defined( RTEMS_PROFILING ) */
 } Per_CPU_Stats;
 
@@ -435,6 +523,21 @@ typedef struct Per_CPU_Control {
    */
   struct _Thread_Control *heir;
 
+#if ( CPU_HARDWARE_FP == TRUE || CPU_SOFTWARE_FP == TRUE ) \
+  && CPU_USE_DEFERRED_FP_SWITCH == TRUE
+  /**
+   * @brief This is the thread which owns the floating point context currently
+   * loaded in the floating point unit of this processor.
+   *
+   * The floating point context of the owner is saved only if another floating
+   * point thread executes on this processor.  It is NULL, if no floating
+   * point context is loaded.
+   *
+   * @see _Thread_Restore_fp() and _Thread_Deallocate_fp().
+   */
+  struct _Thread_Control *fp_owner;
+#endif
+
 #if defined(RTEMS_SMP)
   CPU_Interrupt_frame Interrupt_frame;
 #endif
@@ -504,6 +607,58 @@ typedef struct Per_CPU_Control {
      */
     Atomic_Ulong message;
 
+    /**
+     * @brief Count of RCU quiescent states of this processor.
+     *
+     * This member is only changed by the owner processor.  Atomic operations
+     * are used, since other processors read it to detect the end of a grace
+     * period.
+     *
+     * @see _RCU_Quiescent_state() and _RCU_Synchronize().
+     */
+    Atomic_Ulong rcu_quiescent_states;
+
+    /**
+     * @brief Batched thread dispatch requests issued by this processor.
+     *
+     * @see _Thread_Dispatch_request_batch_begin() and
+     *   _Thread_Dispatch_request_batch_end().
+     */
+    struct {
+      /**
+       * @brief The batch nesting level.
+       *
+       * This member is only changed by the owner processor.
+       */
+      uint32_t nest_level;
+
+      /**
+       * @brief The processors which need a thread dispatch request at the end
+       * of the batch.
+       *
+       * This member is only accessed by the owner processor with interrupts
+       * disabled.
+       */
+      Processor_mask targets;
+
+      /**
+       * @brief The count of thread dispatch requests deferred to the end of a
+       * batch.
+       *
+       * This member is only changed by the owner processor with interrupts
+       * disabled.
+       */
+      uint32_t deferred;
+
+      /**
+       * @brief The count of inter-processor interrupts sent at the end of a
+       * batch.
+       *
+       * This member is only changed by the owner processor.
+       */
+      uint32_t interrupts;
+    } Dispatch_requests;
+
     struct {
       /**
        * @brief The scheduler control of the scheduler owning this processor.
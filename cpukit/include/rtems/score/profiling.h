@@ -171,6 +171,59 @@ void _Profiling_Outer_most_interrupt_entry_and_exit(
   CPU_Counter_ticks interrupt_exit_instant
 );
 
+/**
+ * @brief Updates the latency statistics of an operation of the current
+ * processor.
+ *
+ * Use _Profiling_Latency_update() instead.
+ *
+ * @param index The latency statistics index of the operation.
+ * @param start_instant The operation start instant.
+ */
+void _Profiling_Do_latency_update(
+  Per_CPU_Latency_index index,
+  CPU_Counter_ticks     start_instant
+);
+
+/**
+ * @brief Gets the start instant of an operation for the latency statistics.
+ *
+ * @return The current CPU counter value if profiling is enabled, otherwise
+ *   zero.
+ */
+static inline CPU_Counter_ticks _Profiling_Latency_start( void )
+{
+#if defined( RTEMS_PROFILING )
+  return _CPU_Counter_read();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * @brief Updates the latency statistics of an operation of the current
+ * processor.
+ *
+ * Must be called with interrupts disabled or thread dispatching disabled on
+ * the processor which obtained the start instant.
+ *
+ * @param index The latency statistics index of the operation.
+ * @param start_instant The operation start instant obtained by
+ *   _Profiling_Latency_start().
+ */
+static inline void _Profiling_Latency_update(
+  Per_CPU_Latency_index index,
+  CPU_Counter_ticks     start_instant
+)
+{
+#if defined( RTEMS_PROFILING )
+  _Profiling_Do_latency_update( index, start_instant );
+#else
+  (void) index;
+  (void) start_instant;
+#endif
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,101 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief Read-Copy Update (RCU) Handler API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_RCU_H
+#define _RTEMS_SCORE_RCU_H
+
+#include <rtems/score/basedefs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreRCU Read-Copy Update (RCU) Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief Deferred reclamation for read-mostly data structures.
+ *
+ * Readers access the data structure in RCU read-side critical sections
+ * without acquiring a lock.  An RCU read-side critical section disables
+ * thread dispatching on the current processor, so it must not block.
+ * Updaters remove elements from the data structure under their own lock and
+ * reclaim them once all pre-existing read-side critical sections ended.  This
+ * interval is called a grace period.
+ *
+ * A processor passes through a quiescent state each time it executes
+ * _Thread_Do_dispatch(), since no read-side critical section can be active
+ * at this point.  A grace period ends once every other online processor
+ * passed through a quiescent state.  To speed this up, the processors are
+ * asked to carry out a thread dispatch via an SMP multicast action.
+ *
+ * @{
+ */
+
+struct RCU_Head;
+
+/**
+ * @brief RCU callback handler.
+ *
+ * @param head The RCU head passed to _RCU_Call().
+ */
+typedef void ( *RCU_Handler )( struct RCU_Head *head );
+
+/**
+ * @brief The RCU head to defer the reclamation of an element.
+ *
+ * Embed it into the elements of a data structure protected by RCU.
+ */
+typedef struct RCU_Head {
+  /**
+   * @brief The next pending RCU callback.
+   */
+  struct RCU_Head *next;
+
+  /**
+   * @brief The handler invoked after a grace period.
+   */
+  RCU_Handler handler;
+} RCU_Head;
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief Inlined Routines Associated with the Read-Copy Update (RCU) Handler
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_RCUIMPL_H
+#define _RTEMS_SCORE_RCUIMPL_H
+
+#include <rtems/score/rcu.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/threaddispatch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreRCU
+ *
+ * @{
+ */
+
+/**
+ * @brief Begins an RCU read-side critical section.
+ *
+ * Read-side critical sections may be nested and may be used in interrupt
+ * context.  They must not block.
+ *
+ * @return The current processor.
+ */
+RTEMS_INLINE_ROUTINE Per_CPU_Control *_RCU_Read_lock( void )
+{
+  return _Thread_Dispatch_disable();
+}
+
+/**
+ * @brief Ends an RCU read-side critical section.
+ *
+ * @param[in, out] cpu_self The current processor returned by
+ *   _RCU_Read_lock().
+ */
+RTEMS_INLINE_ROUTINE void _RCU_Read_unlock( Per_CPU_Control *cpu_self )
+{
+  _Thread_Dispatch_enable( cpu_self );
+}
+
+/**
+ * @brief Loads a pointer published via _RCU_Assign_pointer().
+ *
+ * Use this function in RCU read-side critical sections to fetch pointers to
+ * elements of a data structure protected by RCU.
+ *
+ * @param pointer The pointer to load.
+ *
+ * @return The current pointer value.
+ */
+RTEMS_INLINE_ROUTINE void *_RCU_Dereference( const Atomic_Uintptr *pointer )
+{
+  return (void *) _Atomic_Load_uintptr( pointer, ATOMIC_ORDER_ACQUIRE );
+}
+
+/**
+ * @brief Publishes a pointer to an initialized element.
+ *
+ * All previous stores to the element are visible to readers which load the
+ * pointer via _RCU_Dereference().
+ *
+ * @param[out] pointer The pointer to store.
+ * @param value The new pointer value.
+ */
+RTEMS_INLINE_ROUTINE void _RCU_Assign_pointer(
+  Atomic_Uintptr *pointer,
+  void           *value
+)
+{
+  _Atomic_Store_uintptr( pointer, (uintptr_t) value, ATOMIC_ORDER_RELEASE );
+}
+
+/**
+ * @brief Reports a quiescent state of the current processor.
+ *
+ * This function is called by _Thread_Do_dispatch().
+ *
+ * @param[in, out] cpu_self The current processor.
+ */
+RTEMS_INLINE_ROUTINE void _RCU_Quiescent_state( Per_CPU_Control *cpu_self )
+{
+#if defined(RTEMS_SMP)
+  unsigned long quiescent_states;
+
+  quiescent_states = _Atomic_Load_ulong(
+    &cpu_self->rcu_quiescent_states,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Store_ulong(
+    &cpu_self->rcu_quiescent_states,
+    quiescent_states + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+#else
+  (void) cpu_self;
+#endif
+}
+
+/**
+ * @brief Waits for a grace period and invokes the pending RCU callbacks.
+ *
+ * On return, all RCU read-side critical sections which were active at the
+ * time of the call ended.  The RCU callbacks registered via _RCU_Call()
+ * before the call are invoked by the caller after the grace period.
+ *
+ * This function must be called in thread context outside of RCU read-side
+ * critical sections with thread dispatching enabled.
+ */
+void _RCU_Synchronize( void );
+
+/**
+ * @brief Registers an RCU callback.
+ *
+ * The handler is invoked with the RCU head in thread context by the next
+ * _RCU_Synchronize() after a grace period.  Use it for example to free an
+ * element removed from a data structure protected by RCU.
+ *
+ * This function may be called in any context, including RCU read-side
+ * critical sections and interrupt context.
+ *
+ * @param[out] head The RCU head.
+ * @param handler The handler to invoke after a grace period.
+ */
+void _RCU_Call( RCU_Head *head, RCU_Handler handler );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
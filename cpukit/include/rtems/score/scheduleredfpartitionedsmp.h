@@ -0,0 +1,403 @@
+/**
+ * @file
+ *
+ * @brief Partitioned EDF SMP Scheduler API
+ *
+ * @ingroup RTEMSScoreSchedulerSMPEDFPartitioned
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULEREDFPARTITIONEDSMP_H
+#define _RTEMS_SCORE_SCHEDULEREDFPARTITIONEDSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/scheduleredf.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreSchedulerSMPEDFPartitioned Partitioned EDF SMP Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief Partitioned EDF SMP Scheduler
+ *
+ * This is an EDF scheduler for SMP configurations with one ready queue for
+ * each processor.  Each thread has a home processor.  A ready thread is
+ * enqueued in the ready queue of its home processor.  A processor selects the
+ * next thread to execute from its own ready queue.
+ *
+ * A thread which becomes ready preempts the thread scheduled on its home
+ * processor if this thread has a later deadline.  Otherwise, the thread is
+ * pushed to the processor with the latest deadline thread if it has an
+ * earlier deadline than this thread.  In this case, the processor becomes the
+ * new home processor of the thread.
+ *
+ * A processor with an empty ready queue steals the earliest deadline thread
+ * from the heads of the ready queues of the other processors before it
+ * executes an idle thread.  Pinned threads are not stolen.
+ *
+ * In contrast to the EDF SMP scheduler, the ready queue operations are
+ * bounded by the count of ready threads of a processor.  The scheduled set is
+ * not necessarily the global set of the earliest deadline threads.
+ *
+ * A partition is a scheduler instance.  Each partition has its own lock, so
+ * operations in different partitions do not contend.  The push and steal
+ * migrations are confined to the processors of a partition.  Use
+ * RTEMS_SCHEDULER_EDF_PARTITIONED_SMP() and
+ * RTEMS_SCHEDULER_TABLE_EDF_PARTITIONED_SMP() once for each partition and
+ * assign the processors to the partitions.  Threads are moved to another
+ * partition with rtems_task_set_scheduler().
+ *
+ * The thread processor affinity may be all online processors or one
+ * processor.  In case the affinity is a proper subset of the online
+ * processors, then the thread is bound to the highest processor of this
+ * subset in its partition.  Threads bound to one processor are neither pushed
+ * nor stolen.
+ *
+ * @{
+ */
+
+typedef struct {
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief Generation number to ensure FIFO/LIFO order for threads of the same
+   * priority across different ready queues.
+   */
+  int64_t generation;
+
+  /**
+   * @brief The home processor index plus one.
+   *
+   * The value zero indicates that no home processor is assigned.
+   */
+  uint32_t home_index;
+
+  /**
+   * @brief The pinning processor index plus one.
+   *
+   * The value zero indicates that the thread is not pinned.
+   */
+  uint32_t pinning_index;
+
+  /**
+   * @brief The affinity processor index plus one.
+   *
+   * The value zero indicates that the affinity contains all online
+   * processors.
+   */
+  uint32_t affinity_index;
+
+  /**
+   * @brief The index of the ready queue containing this node if it is ready.
+   */
+  uint32_t ready_queue_index;
+} Scheduler_EDF_partitioned_SMP_Node;
+
+typedef struct {
+  /**
+   * @brief The ready threads of the corresponding processor.
+   */
+  RBTree_Control Queue;
+
+  /**
+   * @brief The scheduled node of the corresponding processor.
+   */
+  Scheduler_EDF_partitioned_SMP_Node *scheduled;
+} Scheduler_EDF_partitioned_SMP_Ready_queue;
+
+typedef struct {
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief Current generation for LIFO (index 0) and FIFO (index 1) ordering.
+   */
+  int64_t generations[ 2 ];
+
+  /**
+   * @brief A table with ready queues.
+   *
+   * The index zero queue is used for the idle threads.  Index one corresponds
+   * to processor index zero, and so on.
+   */
+  Scheduler_EDF_partitioned_SMP_Ready_queue Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_EDF_partitioned_SMP_Context;
+
+#define SCHEDULER_EDF_PARTITIONED_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_EDF_partitioned_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_EDF_partitioned_SMP_Yield, \
+    _Scheduler_EDF_partitioned_SMP_Block, \
+    _Scheduler_EDF_partitioned_SMP_Unblock, \
+    _Scheduler_EDF_partitioned_SMP_Update_priority, \
+    _Scheduler_EDF_Map_priority, \
+    _Scheduler_EDF_Unmap_priority, \
+    _Scheduler_EDF_partitioned_SMP_Ask_for_help, \
+    _Scheduler_EDF_partitioned_SMP_Reconsider_help_request, \
+    _Scheduler_EDF_partitioned_SMP_Withdraw_node, \
+    _Scheduler_EDF_partitioned_SMP_Pin, \
+    _Scheduler_EDF_partitioned_SMP_Unpin, \
+    _Scheduler_EDF_partitioned_SMP_Add_processor, \
+    _Scheduler_EDF_partitioned_SMP_Remove_processor, \
+    _Scheduler_EDF_partitioned_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_EDF_Release_job, \
+    _Scheduler_EDF_Cancel_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_EDF_partitioned_SMP_Start_idle, \
+    _Scheduler_EDF_partitioned_SMP_Set_affinity \
+  }
+
+/**
+ * @brief Initializes the context of the scheduler control.
+ *
+ * @param scheduler The scheduler control.
+ */
+void _Scheduler_EDF_partitioned_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the scheduler node.
+ * @param priority The priority for the initialization.
+ */
+void _Scheduler_EDF_partitioned_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_EDF_partitioned_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_EDF_partitioned_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler instance.
+ * @param the_thread The thread for the operation.
+ * @param node The thread's scheduler node.
+ */
+void _Scheduler_EDF_partitioned_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help operation.
+ *
+ * @param scheduler The scheduler instance to ask for help.
+ * @param the_thread The thread needing help.
+ * @param node The scheduler node.
+ *
+ * @retval true Ask for help was successful.
+ * @retval false Ask for help was not successful.
+ */
+bool _Scheduler_EDF_partitioned_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help operation.
+ *
+ * @param scheduler The scheduler instance to reconsider the help
+ *   request.
+ * @param the_thread The thread reconsidering a help request.
+ * @param node The scheduler node.
+ */
+void _Scheduler_EDF_partitioned_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws node operation.
+ *
+ * @param scheduler The scheduler instance to withdraw the node.
+ * @param the_thread The thread using the node.
+ * @param node The scheduler node to withdraw.
+ * @param next_state The next thread scheduler state in case the node is
+ *   scheduled.
+ */
+void _Scheduler_EDF_partitioned_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Pin thread operation.
+ *
+ * The processor becomes the home processor of the thread.
+ *
+ * @param scheduler The scheduler instance of the specified processor.
+ * @param the_thread The thread to pin.
+ * @param node The scheduler node of the thread.
+ * @param cpu The processor to pin the thread.
+ */
+void _Scheduler_EDF_partitioned_SMP_Pin(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Unpin thread operation.
+ *
+ * @param scheduler The scheduler instance of the specified processor.
+ * @param the_thread The thread to unpin.
+ * @param node The scheduler node of the thread.
+ * @param cpu The processor to unpin the thread.
+ */
+void _Scheduler_EDF_partitioned_SMP_Unpin(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Adds processor.
+ *
+ * @param[in, out] scheduler The scheduler instance to add the processor to.
+ * @param idle The idle thread of the processor to add.
+ */
+void _Scheduler_EDF_partitioned_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * The ready threads with this processor as home processor are moved to
+ * another processor of the scheduler instance.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_EDF_partitioned_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs the yield of a thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread that performed the yield operation.
+ * @param node The scheduler node of @a the_thread.
+ */
+void _Scheduler_EDF_partitioned_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Starts an idle thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread An idle thread.
+ * @param cpu The cpu for the operation.
+ */
+void _Scheduler_EDF_partitioned_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Sets the affinity of the node.
+ *
+ * The highest processor of the affinity set becomes the home processor of
+ * the thread unless the affinity contains all online processors.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] thread The thread to set the affinity of.
+ * @param[in, out] node The scheduler node of @a thread.
+ * @param affinity The new processor affinity.
+ *
+ * @retval true The operation succeeded.
+ * @retval false The affinity has no processor of the scheduler instance.
+ */
+bool _Scheduler_EDF_partitioned_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_SCHEDULEREDFPARTITIONEDSMP_H */
@@ -25,6 +25,7 @@
 #include <rtems/score/scheduler.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/priorityimpl.h>
+#include <rtems/score/profiling.h>
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/status.h>
 #include <rtems/score/threadimpl.h>
@@ -242,6 +243,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Yield( Thread_Control *the_thread )
  */
 RTEMS_INLINE_ROUTINE void _Scheduler_Block( Thread_Control *the_thread )
 {
+  CPU_Counter_ticks        start_instant;
 #if defined(RTEMS_SMP)
   Chain_Node              *node;
   const Chain_Node        *tail;
@@ -249,6 +251,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Block( Thread_Control *the_thread )
   const Scheduler_Control *scheduler;
   ISR_lock_Context         lock_context;
 
+  start_instant = _Profiling_Latency_start();
   node = _Chain_First( &the_thread->Scheduler.Scheduler_nodes );
   tail = _Chain_Immutable_tail( &the_thread->Scheduler.Scheduler_nodes );
 
@@ -283,6 +286,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Block( Thread_Control *the_thread )
 #else
   const Scheduler_Control *scheduler;
 
+  start_instant = _Profiling_Latency_start();
   scheduler = _Thread_Scheduler_get_home( the_thread );
   ( *scheduler->Operations.block )(
     scheduler,
@@ -290,6 +294,8 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Block( Thread_Control *the_thread )
     _Thread_Scheduler_get_home_node( the_thread )
   );
 #endif
+
+  _Profiling_Latency_update( PER_CPU_LATENCY_SCHEDULER_BLOCK, start_instant );
 }
 
 /**
@@ -304,10 +310,13 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Block( Thread_Control *the_thread )
  */
 RTEMS_INLINE_ROUTINE void _Scheduler_Unblock( Thread_Control *the_thread )
 {
+  CPU_Counter_ticks        start_instant;
   Scheduler_Node          *scheduler_node;
   const Scheduler_Control *scheduler;
   ISR_lock_Context         lock_context;
 
+  start_instant = _Profiling_Latency_start();
+
 #if defined(RTEMS_SMP)
   scheduler_node = SCHEDULER_NODE_OF_THREAD_SCHEDULER_NODE(
     _Chain_First( &the_thread->Scheduler.Scheduler_nodes )
@@ -321,6 +330,11 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Unblock( Thread_Control *the_thread )
   _Scheduler_Acquire_critical( scheduler, &lock_context );
   ( *scheduler->Operations.unblock )( scheduler, the_thread, scheduler_node );
   _Scheduler_Release_critical( scheduler, &lock_context );
+
+  _Profiling_Latency_update(
+    PER_CPU_LATENCY_SCHEDULER_UNBLOCK,
+    start_instant
+  );
 }
 
 /**
@@ -339,10 +353,12 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Unblock( Thread_Control *the_thread )
  */
 RTEMS_INLINE_ROUTINE void _Scheduler_Update_priority( Thread_Control *the_thread )
 {
+  CPU_Counter_ticks start_instant;
 #if defined(RTEMS_SMP)
   Chain_Node       *node;
   const Chain_Node *tail;
 
+  start_instant = _Profiling_Latency_start();
   _Thread_Scheduler_process_requests( the_thread );
 
   node = _Chain_First( &the_thread->Scheduler.Scheduler_nodes );
@@ -369,6 +385,7 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Update_priority( Thread_Control *the_thread
 #else
   const Scheduler_Control *scheduler;
 
+  start_instant = _Profiling_Latency_start();
   scheduler = _Thread_Scheduler_get_home( the_thread );
   ( *scheduler->Operations.update_priority )(
     scheduler,
@@ -376,6 +393,11 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Update_priority( Thread_Control *the_thread
     _Thread_Scheduler_get_home_node( the_thread )
   );
 #endif
+
+  _Profiling_Latency_update(
+    PER_CPU_LATENCY_SCHEDULER_UPDATE_PRIORITY,
+    start_instant
+  );
 }
 
 #if defined(RTEMS_SMP)
@@ -1292,7 +1314,7 @@ RTEMS_INLINE_ROUTINE Status_Control _Scheduler_Set(
   new_scheduler_node = old_scheduler_node;
 #endif
 
-  the_thread->Start.initial_priority = priority;
+  the_thread->Cold->Start.initial_priority = priority;
   _Priority_Node_set_priority( &the_thread->Real_priority, priority );
   _Priority_Initialize_one(
     &new_scheduler_node->Wait.Priority,
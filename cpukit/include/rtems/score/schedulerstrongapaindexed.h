@@ -0,0 +1,367 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerStrongAPAIndexed
+ *
+ * @brief Indexed Strong APA Scheduler API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERSTRONGAPAINDEXED_H
+#define _RTEMS_SCORE_SCHEDULERSTRONGAPAINDEXED_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerStrongAPAIndexed Indexed Strong APA Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief Indexed Strong APA Scheduler
+ *
+ * This is an implementation of a fixed priority scheduler with arbitrary
+ * processor affinities (APA).  It uses one ready chain per priority and in
+ * addition to the priority bit map of all ready nodes one priority bit map
+ * per processor.  The priority bit map of a processor indicates the
+ * priorities with at least one ready node which has this processor in its
+ * affinity set.  So, the highest priority ready node eligible for a
+ * processor is found with a bit map lookup and a search in one ready chain
+ * instead of a search through all ready chains.
+ *
+ * After each scheduling operation the scheduler searches for displacement
+ * chains.  For each processor of the scheduler instance the highest priority
+ * ready node eligible for this processor is determined.  Starting at this
+ * processor, a breadth-first search through the affinity sets of the
+ * scheduled nodes finds the lowest priority scheduled node reachable from the
+ * processor.  If this node has a lower priority than the ready node, then
+ * the ready node is scheduled on the processor, each scheduled node along the
+ * path migrates to the next processor of the path, and the lowest priority
+ * node is preempted.  For example, if a ready node with affinity to processor
+ * 0 waits for a node with affinity to processors 0 and 1 which executes on
+ * processor 0 and processor 1 becomes idle, then the scheduled node migrates
+ * to processor 1 and the ready node is scheduled on processor 0.
+ *
+ * The the_thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief Scheduler node specialization for indexed Strong APA schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready queue of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief The processor affinity set of this node.
+   */
+  Processor_mask Affinity;
+
+  /**
+   * @brief The index of the last processor of the affinity set plus one.
+   *
+   * This is used to bound the processor bit map updates.
+   */
+  uint32_t affinity_end;
+} Scheduler_strong_APA_indexed_Node;
+
+/**
+ * @brief Per-processor state of the displacement chain search.
+ */
+typedef struct {
+  /**
+   * @brief The node scheduled on this processor.
+   */
+  Scheduler_Node *scheduled;
+
+  /**
+   * @brief The index of the processor from which this processor was reached
+   * by the search.
+   */
+  uint32_t predecessor;
+
+  /**
+   * @brief Indicates if this processor was already visited by the search.
+   */
+  bool visited;
+} Scheduler_strong_APA_indexed_CPU;
+
+/**
+ * @brief Scheduler context specialization for indexed Strong APA schedulers.
+ */
+typedef struct {
+  /**
+   * @brief Basic SMP scheduler context.
+   */
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief The priority bit map of all ready nodes.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The priority bit map of the ready nodes eligible for a processor
+   * indexed by the processor index.
+   */
+  Priority_bit_map_Control Processor_bit_map[ CPU_MAXIMUM_PROCESSORS ];
+
+  /**
+   * @brief The displacement chain search state indexed by the processor
+   * index.
+   */
+  Scheduler_strong_APA_indexed_CPU CPU[ CPU_MAXIMUM_PROCESSORS ];
+
+  /**
+   * @brief The queue of processor indices of the breadth-first displacement
+   * chain search.
+   */
+  uint32_t Search_queue[ CPU_MAXIMUM_PROCESSORS ];
+
+  /**
+   * @brief One ready chain per priority.
+   */
+  Chain_Control Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_strong_APA_indexed_Context;
+
+/**
+ * @brief Entry points for the indexed Strong APA Scheduler.
+ */
+#define SCHEDULER_STRONG_APA_INDEXED_ENTRY_POINTS \
+  { \
+    _Scheduler_strong_APA_indexed_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_strong_APA_indexed_Yield, \
+    _Scheduler_strong_APA_indexed_Block, \
+    _Scheduler_strong_APA_indexed_Unblock, \
+    _Scheduler_strong_APA_indexed_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_strong_APA_indexed_Ask_for_help, \
+    _Scheduler_strong_APA_indexed_Reconsider_help_request, \
+    _Scheduler_strong_APA_indexed_Withdraw_node, \
+    _Scheduler_default_Pin_or_unpin, \
+    _Scheduler_default_Pin_or_unpin, \
+    _Scheduler_strong_APA_indexed_Add_processor, \
+    _Scheduler_strong_APA_indexed_Remove_processor, \
+    _Scheduler_strong_APA_indexed_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_SMP_Start_idle, \
+    _Scheduler_strong_APA_indexed_Set_affinity \
+  }
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * @param scheduler The scheduler to initialize.
+ */
+void _Scheduler_strong_APA_indexed_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * The affinity set of the node is initialized to the online processors.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the node to initialize.
+ * @param priority The priority for @a node.
+ */
+void _Scheduler_strong_APA_indexed_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The node of the thread to block.
+ */
+void _Scheduler_strong_APA_indexed_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The node of the thread to unblock.
+ */
+void _Scheduler_strong_APA_indexed_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread for the operation.
+ * @param[in, out] node The node to update the priority of.
+ */
+void _Scheduler_strong_APA_indexed_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help.
+ *
+ * @param  scheduler The scheduler control instance.
+ * @param the_thread The thread that asks for help.
+ * @param node The node of @a the_thread.
+ *
+ * @retval true The request for help was successful.
+ * @retval false The request for help was not successful.
+ */
+bool _Scheduler_strong_APA_indexed_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help request.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread to reconsider the help request of.
+ * @param[in, out] node The node of @a the_thread
+ */
+void _Scheduler_strong_APA_indexed_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] the_thread The thread to change the state to @a next_state.
+ * @param[in, out] node The node to withdraw.
+ * @param next_state The next state for @a the_thread.
+ */
+void _Scheduler_strong_APA_indexed_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Adds the idle thread to a processor.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] The idle thread to add to the processor.
+ */
+void _Scheduler_strong_APA_indexed_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_strong_APA_indexed_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs a yield operation.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread to yield.
+ * @param[in, out] node The node of @a the_thread.
+ */
+void _Scheduler_strong_APA_indexed_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Sets the processor affinity of the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param the_thread The thread of the node.
+ * @param[in, out] node The node to set the affinity of.
+ * @param affinity The new processor affinity set.
+ *
+ * @retval true The processor affinity set was changed.
+ * @retval false The processor affinity set has no processor owned by the
+ *   scheduler instance.
+ */
+bool _Scheduler_strong_APA_indexed_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERSTRONGAPAINDEXED_H */
@@ -30,12 +30,21 @@
  * @brief The SMP lock provides mutual exclusion for SMP systems at the lowest
  * level.
  *
- * The SMP lock is implemented as a ticket lock.  This provides fairness in
- * case of concurrent lock attempts.
+ * The SMP lock is implemented as a ticket lock by default.  This provides
+ * fairness in case of concurrent lock attempts.  Alternatively, the
+ * Mellor-Crummey and Scott (MCS) lock can be selected at configure time via
+ * the --enable-smp-lock=mcs option.  The MCS lock provides fairness as well,
+ * however, each waiting processor spins on its own lock context.  This
+ * reduces the cache line traffic under contention at the expense of a
+ * slightly more expensive uncontended release.
  *
- * This SMP lock API uses a local context for acquire and release pairs.  Such
- * a context may be used to implement for example the Mellor-Crummey and Scott
- * (MCS) locks in the future.
+ * This SMP lock API uses a local context for acquire and release pairs.  The
+ * MCS lock uses this context as its queue node, so the context must stay at
+ * the same address until the lock is released.
+ *
+ * The thread queue locks and the POSIX spinlocks are always ticket locks,
+ * since their layout is defined by the Newlib <sys/lock.h> and
+ * pthread_spinlock_t structures.
  *
  * @{
  */
@@ -44,6 +53,9 @@
 
 #include <rtems/score/smplockstats.h>
 #include <rtems/score/smplockticket.h>
+#if defined(RTEMS_SMP_LOCK_MCS)
+#include <rtems/score/smplockmcs.h>
+#endif
 #include <rtems/score/isrlevel.h>
 
 #if defined(RTEMS_DEBUG)
@@ -59,11 +71,24 @@ extern "C" {
 #define RTEMS_SMP_LOCK_DO_NOT_INLINE
 #endif
 
+/**
+ * @brief The name of the SMP lock algorithm selected at configure time.
+ */
+#if defined(RTEMS_SMP_LOCK_MCS)
+  #define SMP_LOCK_ALGORITHM_NAME "MCS"
+#else
+  #define SMP_LOCK_ALGORITHM_NAME "ticket"
+#endif
+
 /**
  * @brief SMP lock control.
  */
 typedef struct {
+#if defined(RTEMS_SMP_LOCK_MCS)
+  SMP_MCS_lock_Control MCS_lock;
+#else
   SMP_ticket_lock_Control Ticket_lock;
+#endif
 #if defined(RTEMS_DEBUG)
   /**
    * @brief The index of the owning processor of this lock.
@@ -95,30 +120,45 @@ typedef struct {
 #if defined(RTEMS_PROFILING)
   SMP_lock_Stats_context Stats_context;
 #endif
+#if defined(RTEMS_SMP_LOCK_MCS)
+  /**
+   * @brief The MCS lock queue node of this acquire and release pair.
+   */
+  SMP_MCS_lock_Context MCS_context;
+#endif
 } SMP_lock_Context;
 
 #if defined(RTEMS_DEBUG)
 #define SMP_LOCK_NO_OWNER 0
 #endif
 
+/**
+ * @brief Initializer for the algorithm specific part of the SMP lock control.
+ */
+#if defined(RTEMS_SMP_LOCK_MCS)
+  #define SMP_LOCK_ALGORITHM_INITIALIZER SMP_MCS_LOCK_INITIALIZER
+#else
+  #define SMP_LOCK_ALGORITHM_INITIALIZER SMP_TICKET_LOCK_INITIALIZER
+#endif
+
 /**
  * @brief SMP lock control initializer for static initialization.
  */
 #if defined(RTEMS_DEBUG) && defined(RTEMS_PROFILING)
   #define SMP_LOCK_INITIALIZER( name ) \
     { \
-      SMP_TICKET_LOCK_INITIALIZER, \
+      SMP_LOCK_ALGORITHM_INITIALIZER, \
       SMP_LOCK_NO_OWNER, \
       SMP_LOCK_STATS_INITIALIZER( name ) \
     }
 #elif defined(RTEMS_DEBUG)
   #define SMP_LOCK_INITIALIZER( name ) \
-    { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_NO_OWNER }
+    { SMP_LOCK_ALGORITHM_INITIALIZER, SMP_LOCK_NO_OWNER }
 #elif defined(RTEMS_PROFILING)
   #define SMP_LOCK_INITIALIZER( name ) \
-    { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
+    { SMP_LOCK_ALGORITHM_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
 #else
-  #define SMP_LOCK_INITIALIZER( name ) { SMP_TICKET_LOCK_INITIALIZER }
+  #define SMP_LOCK_INITIALIZER( name ) { SMP_LOCK_ALGORITHM_INITIALIZER }
 #endif
 
 /**
@@ -131,7 +171,11 @@ static inline void _SMP_lock_Initialize_inline(
   const char       *name
 )
 {
+#if defined(RTEMS_SMP_LOCK_MCS)
+  _SMP_MCS_lock_Initialize( &lock->MCS_lock );
+#else
   _SMP_ticket_lock_Initialize( &lock->Ticket_lock );
+#endif
 #if defined(RTEMS_DEBUG)
   lock->owner = SMP_LOCK_NO_OWNER;
 #endif
@@ -168,7 +212,11 @@ void _SMP_lock_Initialize(
  */
 static inline void _SMP_lock_Destroy_inline( SMP_lock_Control *lock )
 {
+#if defined(RTEMS_SMP_LOCK_MCS)
+  _SMP_MCS_lock_Destroy( &lock->MCS_lock );
+#else
   _SMP_ticket_lock_Destroy( &lock->Ticket_lock );
+#endif
   _SMP_lock_Stats_destroy( &lock->Stats );
 }
 
@@ -237,11 +285,19 @@ static inline void _SMP_lock_Acquire_inline(
 #else
   (void) context;
 #endif
+#if defined(RTEMS_SMP_LOCK_MCS)
+  _SMP_MCS_lock_Acquire(
+    &lock->MCS_lock,
+    &context->MCS_context,
+    &lock->Stats
+  );
+#else
   _SMP_ticket_lock_Acquire(
     &lock->Ticket_lock,
     &lock->Stats,
     &context->Stats_context
   );
+#endif
 #if defined(RTEMS_DEBUG)
   lock->owner = _SMP_lock_Who_am_I();
 #endif
@@ -282,10 +338,14 @@ static inline void _SMP_lock_Release_inline(
 #else
   (void) context;
 #endif
+#if defined(RTEMS_SMP_LOCK_MCS)
+  _SMP_MCS_lock_Release( &lock->MCS_lock, &context->MCS_context );
+#else
   _SMP_ticket_lock_Release(
     &lock->Ticket_lock,
     &context->Stats_context
   );
+#endif
 }
 
 /**
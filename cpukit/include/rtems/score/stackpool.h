@@ -0,0 +1,218 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief Stack Pool Allocator API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_STACKPOOL_H
+#define _RTEMS_SCORE_STACKPOOL_H
+
+#include <rtems/score/stack.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreStack
+ *
+ * @{
+ */
+
+/**
+ * @brief The stack pool configuration.
+ *
+ * The stack pool recycles fixed-size stack slabs.  Each slab is large enough
+ * for a stack of the configured size plus the floating-point context and the
+ * thread-local storage (TLS) area which are placed in the stack area.
+ * Optionally, each slab has a guard region which is filled with a pattern
+ * and checked when the stack is freed.
+ */
+typedef struct {
+  /**
+   * @brief The maximum count of free slabs kept in the pool.
+   *
+   * A value of zero disables the stack pool.
+   */
+  size_t maximum;
+
+  /**
+   * @brief The stack size of a slab in bytes.
+   *
+   * The floating-point context and the TLS area are added to this size.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief The size of the guard region of each slab in bytes.
+   */
+  size_t guard_size;
+} Stack_Pool_Configuration;
+
+/**
+ * @brief The stack pool configuration.
+ *
+ * Application provided via <rtems/confdefs.h>.
+ */
+extern const Stack_Pool_Configuration _Stack_Pool_Configuration;
+
+/**
+ * @brief Marks an allocation which is a slab of the stack pool.
+ */
+#define STACK_POOL_KIND_SLAB 0x5ab5ab5a
+
+/**
+ * @brief Marks an allocation which is too large for a slab of the stack
+ * pool.
+ */
+#define STACK_POOL_KIND_OVERSIZED 0x0e50e50e
+
+/**
+ * @brief The header at the begin of each allocation of the stack pool.
+ *
+ * On processors with a stack growing down, the guard region follows the
+ * header and the stack area follows the guard region.  On processors with a
+ * stack growing up, the stack area follows the header and the guard region
+ * follows the stack area.  In both cases, a stack overflow hits the guard
+ * region before it hits the header.
+ */
+typedef struct {
+  /**
+   * @brief The kind of the allocation.
+   *
+   * It is either STACK_POOL_KIND_SLAB or STACK_POOL_KIND_OVERSIZED.
+   */
+  uint32_t kind;
+
+  /**
+   * @brief The size of the stack area in bytes.
+   */
+  size_t stack_size;
+} Stack_Pool_Header;
+
+/**
+ * @brief The stack pool statistics.
+ */
+typedef struct {
+  /**
+   * @brief The size of a slab in bytes including the header and the guard
+   * region.
+   */
+  size_t slab_size;
+
+  /**
+   * @brief The size of the stack area of a slab in bytes.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief The maximum count of free slabs kept in the pool.
+   */
+  uint32_t maximum_free_slabs;
+
+  /**
+   * @brief The current count of free slabs in the pool.
+   */
+  uint32_t free_slabs;
+
+  /**
+   * @brief The count of allocations satisfied by a free slab of the pool.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief The count of slab allocations from the workspace.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief The count of allocations too large for a slab.
+   */
+  uint32_t oversized;
+
+  /**
+   * @brief The count of slabs freed to the workspace since the pool was full.
+   */
+  uint32_t overflows;
+} Stack_Pool_Statistics;
+
+/**
+ * @brief Initializes the stack pool.
+ *
+ * Use it as the stack allocator initialization handler.
+ *
+ * @param stack_space_size The size of the stack space in bytes.
+ */
+void _Stack_Pool_Initialize( size_t stack_space_size );
+
+/**
+ * @brief Allocates a stack area from the stack pool.
+ *
+ * Use it as the stack allocator allocate handler.  Stack areas which fit
+ * into a slab are taken from the pool if possible, otherwise a new slab is
+ * allocated from the workspace.  Larger stack areas are allocated from the
+ * workspace directly.
+ *
+ * @param stack_size The size of the stack area to allocate in bytes.
+ *
+ * @retval NULL Not enough memory.
+ * @retval other Pointer to begin of stack area.
+ */
+void *_Stack_Pool_Allocate( size_t stack_size );
+
+/**
+ * @brief Frees a stack area allocated by _Stack_Pool_Allocate().
+ *
+ * Use it as the stack allocator free handler.  Slabs are put back into the
+ * pool until the maximum count of free slabs is reached.  A corrupt guard
+ * region or header results in an INTERNAL_ERROR_STACK_POOL_GUARD_CORRUPTED
+ * fatal error.
+ *
+ * @param addr A pointer to a previously allocated stack area or NULL.
+ */
+void _Stack_Pool_Free( void *addr );
+
+/**
+ * @brief Gets the stack pool statistics.
+ *
+ * @param[out] stats The stack pool statistics.
+ */
+void _Stack_Pool_Get_statistics( Stack_Pool_Statistics *stats );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -53,6 +53,8 @@ struct _Scheduler_Control;
 
 struct User_extensions_Iterator;
 
+struct CORE_BRWLock_Control;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -720,12 +722,70 @@ typedef struct  {
   void *        control;
 }Thread_Capture_control;
 
+/**
+ * @brief The cold part of the thread control block.
+ *
+ * This structure contains the thread state which is not used by the thread
+ * dispatch, the scheduler operations and the thread queue operations.  It is
+ * placed by <rtems/confdefs.h> behind the other thread control add-ons, so
+ * that the thread control block itself is more compact and its fields used
+ * on the hot paths share fewer cache lines.
+ *
+ * @see Thread_Control::Cold.
+ */
+typedef struct {
+  /** This field contains information about the starting state of
+   *  this thread.
+   */
+  Thread_Start_information Start;
+
+  /**
+   * @brief The POSIX Keys information.
+   */
+  Thread_Keys_information Keys;
+
+  /**
+   * @brief The capture engine control.
+   */
+  Thread_Capture_control Capture;
+
+  /**
+   * @brief Pointer to an optional thread-specific POSIX user environment.
+   */
+  struct rtems_user_env_t *user_environment;
+
+  /**
+   * @brief LIFO list of POSIX cleanup contexts.
+   */
+  struct _pthread_cleanup_context *last_cleanup_context;
+
+  /**
+   * @brief LIFO list of user extensions iterators.
+   */
+  struct User_extensions_Iterator *last_user_extensions_iterator;
+
+  /**
+   * @brief The big reader RWLocks owned by this thread for reading.
+   *
+   * This is a table with _Thread_BRWLock_read_maximum entries provided via
+   * <rtems/confdefs.h>.  Unused entries are NULL.  Only the thread itself
+   * accesses the entries, see _CORE_BRWLock_Seize_for_reading() and
+   * _CORE_BRWLock_Surrender().
+   */
+  struct CORE_BRWLock_Control **brwlocks_read;
+} Thread_Cold_control;
+
 /**
  *  This structure defines the Thread Control Block (TCB).
  *
  *  Uses a leading underscore in the structure name to allow forward
  *  declarations in standard header files provided by Newlib and GCC.
  *
+ *  The fields used by the scheduler and the thread queue operations are
+ *  grouped at the beginning, followed by the fields used by the thread
+ *  dispatch.  State used only during thread creation, restart and deletion
+ *  or by optional services is in the cold part, see Thread_Cold_control.
+ *
  *  In case the second member changes (currently Join_queue), then the memset()
  *  in _Thread_Initialize() must be adjusted.
  */
@@ -780,45 +840,28 @@ struct _Thread_Control {
 #endif
      /*================= end of common block =================*/
 
-#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
-  /**
-   * @brief Potpourri lock statistics.
-   *
-   * These SMP lock statistics are used for all lock objects that lack a
-   * storage space for the statistics.  Examples are lock objects used in
-   * external libraries which are independent of the actual RTEMS build
-   * configuration.
+  /*
+   * The following fields up to and including Registers are used by the
+   * thread dispatch and the clock tick.  Keep them together, so that a
+   * context switch touches as few cache lines of the thread control block as
+   * possible.
    */
-  SMP_lock_Stats Potpourri_stats;
-#endif
 
-  /** This field is true if the thread is an idle thread. */
-  bool                                  is_idle;
-#if defined(RTEMS_MULTIPROCESSING)
-  /** This field is true if the thread is offered globally */
-  bool                                  is_global;
-#endif
   /** This field is true if the thread is preemptible. */
   bool                                  is_preemptible;
   /** This field is true if the thread uses the floating point unit. */
   bool                                  is_fp;
 
-  /**
-   * @brief True, if the thread was created with an inherited scheduler
-   * (PTHREAD_INHERIT_SCHED), and false otherwise.
+  /** This field is the algorithm used to manage this thread's time
+   *  quantum.  The algorithm may be specified as none which case,
+   *  no limit is in place.
    */
-  bool was_created_with_inherited_scheduler;
-
+  Thread_CPU_budget_algorithms          budget_algorithm;
   /** This field is the length of the time quantum that this thread is
    *  allowed to consume.  The algorithm used to manage limits on CPU usage
    *  is specified by budget_algorithm.
    */
   uint32_t                              cpu_time_budget;
-  /** This field is the algorithm used to manage this thread's time
-   *  quantum.  The algorithm may be specified as none which case,
-   *  no limit is in place.
-   */
-  Thread_CPU_budget_algorithms          budget_algorithm;
   /** This field is the method invoked with the budgeted time is consumed. */
   Thread_CPU_budget_algorithm_callout   budget_callout;
   /** This field is the amount of CPU time consumed by this thread
@@ -826,30 +869,18 @@ struct _Thread_Control {
    */
   Timestamp_Control                     cpu_time_used;
 
-  /** This field contains information about the starting state of
-   *  this thread.
-   */
-  Thread_Start_information              Start;
-
   Thread_Action_control                 Post_switch_actions;
 
-  /** This field contains the context of this thread. */
-  Context_Control                       Registers;
+  /** This field points to the newlib reentrancy structure for this thread. */
+  struct _reent                        *libc_reent;
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
   /** This field points to the floating point context for this thread.
    *  If NULL, the thread is integer only.
    */
   Context_Control_fp                   *fp_context;
 #endif
-  /** This field points to the newlib reentrancy structure for this thread. */
-  struct _reent                        *libc_reent;
-  /** This array contains the API extension area pointers. */
-  void                                 *API_Extensions[ THREAD_API_LAST + 1 ];
-
-  /**
-   * @brief The POSIX Keys information.
-   */
-  Thread_Keys_information               Keys;
+  /** This field contains the context of this thread. */
+  Context_Control                       Registers;
 
   /**
    * @brief Thread life-cycle control.
@@ -858,22 +889,41 @@ struct _Thread_Control {
    */
   Thread_Life_control                   Life;
 
-  Thread_Capture_control                Capture;
+  /** This field is true if the thread is an idle thread. */
+  bool                                  is_idle;
+#if defined(RTEMS_MULTIPROCESSING)
+  /** This field is true if the thread is offered globally */
+  bool                                  is_global;
+#endif
 
   /**
-   * @brief Pointer to an optional thread-specific POSIX user environment.
+   * @brief True, if the thread was created with an inherited scheduler
+   * (PTHREAD_INHERIT_SCHED), and false otherwise.
    */
-  struct rtems_user_env_t *user_environment;
+  bool was_created_with_inherited_scheduler;
+
+  /** This array contains the API extension area pointers. */
+  void                                 *API_Extensions[ THREAD_API_LAST + 1 ];
 
   /**
-   * @brief LIFO list of POSIX cleanup contexts.
+   * @brief The cold part of the thread control block.
+   *
+   * It is set to the cold part in the thread control block add-ons during
+   * thread initialization and is valid for the lifetime of the thread object.
    */
-  struct _pthread_cleanup_context *last_cleanup_context;
+  Thread_Cold_control                  *Cold;
 
+#if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
   /**
-   * @brief LIFO list of user extensions iterators.
+   * @brief Potpourri lock statistics.
+   *
+   * These SMP lock statistics are used for all lock objects that lack a
+   * storage space for the statistics.  Examples are lock objects used in
+   * external libraries which are independent of the actual RTEMS build
+   * configuration.
    */
-  struct User_extensions_Iterator *last_user_extensions_iterator;
+  SMP_lock_Stats Potpourri_stats;
+#endif
 
   /**
    * @brief Variable length array of user extension pointers.
@@ -917,9 +967,10 @@ typedef struct {
  *
  * The thread control block contains fields that point to application
  * configuration dependent memory areas, like the scheduler information, the
- * API control blocks, the user extension context table, and the Newlib
- * re-entrancy support.  Account for these areas in the configuration and
- * avoid extra workspace allocations for these areas.
+ * API control blocks, the user extension context table, the Newlib
+ * re-entrancy support, and the cold part of the thread control block.
+ * Account for these areas in the configuration and avoid extra workspace
+ * allocations for these areas.
  *
  * This array is provided via <rtems/confdefs.h>.
  *
@@ -952,6 +1003,25 @@ extern const size_t _Thread_Initial_thread_count;
  */
 #define THREAD_DEFAULT_MAXIMUM_NAME_SIZE 16
 
+/**
+ * @brief The default maximum count of big reader RWLocks a thread may own
+ * for reading at the same time.
+ *
+ * This is the default value for the application configuration option
+ * CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD.
+ */
+#define THREAD_DEFAULT_BRWLOCK_READ_MAXIMUM 4
+
+/**
+ * @brief The maximum count of big reader RWLocks a thread may own for
+ * reading at the same time.
+ *
+ * This value is provided via <rtems/confdefs.h>.
+ *
+ * @see Thread_Cold_control::brwlocks_read.
+ */
+extern const size_t _Thread_BRWLock_read_maximum;
+
 /**
  * @brief Maximum size of a thread name in characters (including the
  * terminating '\0' character).
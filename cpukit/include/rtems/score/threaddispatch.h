@@ -229,8 +229,14 @@ RTEMS_INLINE_ROUTINE void _Thread_Dispatch_unnest( Per_CPU_Control *cpu_self )
 /**
  * @brief Requests a thread dispatch on the target processor.
  *
+ * In case a batch of thread dispatch requests is active on the current
+ * processor, then the inter-processor interrupt is deferred to the end of the
+ * batch.  This function must be called with interrupts disabled.
+ *
  * @param[in, out] cpu_self The current processor.
  * @param[in, out] cpu_target The target processor to request a thread dispatch.
+ *
+ * @see _Thread_Dispatch_request_batch_begin().
  */
 RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request(
   Per_CPU_Control *cpu_self,
@@ -240,6 +246,12 @@ RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request(
 #if defined( RTEMS_SMP )
   if ( cpu_self == cpu_target ) {
     cpu_self->dispatch_necessary = true;
+  } else if ( cpu_self->Dispatch_requests.nest_level > 0 ) {
+    _Processor_mask_Set(
+      &cpu_self->Dispatch_requests.targets,
+      _Per_CPU_Get_index( cpu_target )
+    );
+    ++cpu_self->Dispatch_requests.deferred;
   } else {
     _Atomic_Fetch_or_ulong( &cpu_target->message, 0, ATOMIC_ORDER_RELEASE );
     _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu_target ) );
@@ -250,6 +262,68 @@ RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request(
 #endif
 }
 
+/**
+ * @brief Begins a batch of thread dispatch requests.
+ *
+ * While the batch is active, the thread dispatch requests issued by the
+ * current processor for other processors are collected.  At the end of the
+ * batch, at most one inter-processor interrupt is sent to each target
+ * processor.  Batches may be nested.
+ *
+ * Thread dispatching must be disabled during the batch.
+ *
+ * @param[in, out] cpu_self The current processor.
+ *
+ * @see _Thread_Dispatch_request_batch_end().
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request_batch_begin(
+  Per_CPU_Control *cpu_self
+)
+{
+#if defined( RTEMS_SMP )
+  _Assert( cpu_self->thread_dispatch_disable_level > 0 );
+  ++cpu_self->Dispatch_requests.nest_level;
+#else
+  (void) cpu_self;
+#endif
+}
+
+#if defined( RTEMS_SMP )
+/**
+ * @brief Sends the collected thread dispatch requests.
+ *
+ * @param[in, out] cpu_self The current processor.
+ */
+void _Thread_Dispatch_request_batch_flush( Per_CPU_Control *cpu_self );
+#endif
+
+/**
+ * @brief Ends a batch of thread dispatch requests.
+ *
+ * In case this ends the outermost batch, then the collected thread dispatch
+ * requests are sent to the target processors.
+ *
+ * @param[in, out] cpu_self The current processor.
+ *
+ * @see _Thread_Dispatch_request_batch_begin().
+ */
+RTEMS_INLINE_ROUTINE void _Thread_Dispatch_request_batch_end(
+  Per_CPU_Control *cpu_self
+)
+{
+#if defined( RTEMS_SMP )
+  _Assert( cpu_self->Dispatch_requests.nest_level > 0 );
+
+  if ( cpu_self->Dispatch_requests.nest_level == 1 ) {
+    _Thread_Dispatch_request_batch_flush( cpu_self );
+  } else {
+    --cpu_self->Dispatch_requests.nest_level;
+  }
+#else
+  (void) cpu_self;
+#endif
+}
+
 /** @} */
 
 #ifdef __cplusplus
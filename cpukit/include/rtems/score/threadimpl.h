@@ -64,14 +64,6 @@ extern void *rtems_ada_self;
  */
 extern Objects_Id _Thread_Global_constructor;
 
-/**
- *  The following points to the thread whose floating point
- *  context is currently loaded.
- */
-#if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-extern Thread_Control *_Thread_Allocated_fp;
-#endif
-
 #if defined(RTEMS_SMP)
 #define THREAD_OF_SCHEDULER_HELP_NODE( node ) \
   RTEMS_CONTAINER_OF( node, Thread_Control, Scheduler.Help_node )
@@ -945,25 +937,24 @@ RTEMS_INLINE_ROUTINE void _Thread_Unblock (
 
 /**
  * @brief Checks if the floating point context of the thread is currently
- *      loaded in the floating point unit.
- *
- * This function returns true if the floating point context of
- * the_thread is currently loaded in the floating point unit, and
- * false otherwise.
+ *      loaded in the floating point unit of the processor.
  *
+ * @param cpu The processor to check.
  * @param the_thread The thread for the verification.
  *
  * @retval true The floating point context of @a the_thread is currently
- *      loaded in the floating point unit.
+ *      loaded in the floating point unit of @a cpu.
  * @retval false The floating point context of @a the_thread is currently not
- *      loaded in the floating point unit.
+ *      loaded in the floating point unit of @a cpu.
  */
-#if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-RTEMS_INLINE_ROUTINE bool _Thread_Is_allocated_fp (
-  const Thread_Control *the_thread
+#if ( CPU_HARDWARE_FP == TRUE || CPU_SOFTWARE_FP == TRUE ) \
+  && CPU_USE_DEFERRED_FP_SWITCH == TRUE
+RTEMS_INLINE_ROUTINE bool _Thread_Is_allocated_fp(
+  const Per_CPU_Control *cpu,
+  const Thread_Control  *the_thread
 )
 {
-  return ( the_thread == _Thread_Allocated_fp );
+  return ( the_thread == cpu->fp_owner );
 }
 #endif
 
@@ -978,6 +969,9 @@ RTEMS_INLINE_ROUTINE bool _Thread_Is_allocated_fp (
  * operations.  However, this algorithm can not be used on all CPUs due
  * to unpredictable use of FP registers by some compilers for integer
  * operations.
+ *
+ * The owner of the floating point context is tracked per processor, see
+ * Per_CPU_Control::fp_owner.
  */
 
 /**
@@ -998,18 +992,31 @@ RTEMS_INLINE_ROUTINE void _Thread_Save_fp( Thread_Control *executing )
 /**
  * @brief Restores the executing thread's floating point area.
  *
+ * In case of the deferred floating point switch, the floating point context
+ * of the previous owner is saved and the executing thread becomes the new
+ * owner of the floating point unit of the current processor.
+ *
  * @param executing The currently executing thread.
  */
 RTEMS_INLINE_ROUTINE void _Thread_Restore_fp( Thread_Control *executing )
 {
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
 #if ( CPU_USE_DEFERRED_FP_SWITCH == TRUE )
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Per_CPU_Get();
+
   if ( (executing->fp_context != NULL) &&
-       !_Thread_Is_allocated_fp( executing ) ) {
-    if ( _Thread_Allocated_fp != NULL )
-      _Context_Save_fp( &_Thread_Allocated_fp->fp_context );
+       !_Thread_Is_allocated_fp( cpu_self, executing ) ) {
+    Thread_Control *fp_owner;
+
+    fp_owner = cpu_self->fp_owner;
+
+    if ( fp_owner != NULL )
+      _Context_Save_fp( &fp_owner->fp_context );
+
     _Context_Restore_fp( &executing->fp_context );
-    _Thread_Allocated_fp = executing;
+    cpu_self->fp_owner = executing;
   }
 #else
   if ( executing->fp_context != NULL )
@@ -1019,15 +1026,27 @@ RTEMS_INLINE_ROUTINE void _Thread_Restore_fp( Thread_Control *executing )
 }
 
 /**
- * @brief Deallocates the currently loaded floating point context.
+ * @brief Deallocates the floating point context of the thread.
+ *
+ * This routine is invoked when the floating point context loaded in the
+ * floating point unit of the current processor is no longer associated with
+ * an active thread.
  *
- * This routine is invoked when the currently loaded floating
- * point context is now longer associated with an active thread.
+ * @param the_thread The thread which is no longer active.
  */
-#if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-RTEMS_INLINE_ROUTINE void _Thread_Deallocate_fp( void )
+#if ( CPU_HARDWARE_FP == TRUE || CPU_SOFTWARE_FP == TRUE ) \
+  && CPU_USE_DEFERRED_FP_SWITCH == TRUE
+RTEMS_INLINE_ROUTINE void _Thread_Deallocate_fp(
+  const Thread_Control *the_thread
+)
 {
-  _Thread_Allocated_fp = NULL;
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Per_CPU_Get();
+
+  if ( _Thread_Is_allocated_fp( cpu_self, the_thread ) ) {
+    cpu_self->fp_owner = NULL;
+  }
 }
 #endif
 
@@ -650,6 +650,49 @@ size_t _Thread_queue_Queue_get_name_and_id(
   Objects_Id               *id
 );
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief The maximum count of owner checks carried out by
+ * _Thread_queue_Spin_on_owner().
+ *
+ * A value of zero disables the adaptive spinning of mutex seize operations.
+ * This constant is provided by the application configuration via
+ * CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT.
+ */
+extern const uint32_t _Thread_queue_Spin_limit;
+
+/**
+ * @brief Spins while the owner of the thread queue executes on another
+ * processor.
+ *
+ * This function is used by mutex seize operations to avoid the overhead of a
+ * blocking operation in case the owner will release the mutex soon.  The
+ * thread queue lock is released during the spinning and acquired again
+ * afterwards.  The spinning stops if the owner of the thread queue changed,
+ * if the owner no longer executes on its processor or if the spin limit is
+ * reached.  The delay between two owner checks increases exponentially up to
+ * a fixed maximum.
+ *
+ * @param[in, out] queue The thread queue queue.  The caller must own the
+ *   thread queue lock.
+ * @param owner The owner of the thread queue.
+ * @param executing The executing thread.
+ * @param[in, out] queue_context The thread queue context.  The ISR level
+ *   must be set in the lock context, see
+ *   _Thread_queue_Context_set_ISR_level().
+ *
+ * @retval true The thread queue has no owner.  The caller may take the
+ *   ownership.
+ * @retval false Otherwise.  The caller should enqueue the executing thread.
+ */
+bool _Thread_queue_Spin_on_owner(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *owner,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+);
+#endif
+
 /**
  * @brief Acquires the thread queue control in a critical section.
  *
@@ -506,7 +506,7 @@ static inline void _User_extensions_Destroy_iterators(
 
   _User_extensions_Acquire( &lock_context );
 
-  iter = the_thread->last_user_extensions_iterator;
+  iter = the_thread->Cold->last_user_extensions_iterator;
 
   while ( iter != NULL ) {
     _Chain_Iterator_destroy( &iter->Iterator );
@@ -65,6 +65,56 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of bits of the expiration time used to select a slot on
+ * one level of the watchdog timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief The count of slots on one level of the watchdog timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1U << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief The count of levels of the watchdog timing wheel.
+ *
+ * Watchdogs which expire more than
+ * 2**( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) ticks in the
+ * future are kept on the overflow chain of the timing wheel.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief The hierarchical timing wheel to manage scheduled watchdogs with a
+ * ticks based expiration time.
+ *
+ * The insert and remove operations have a constant time complexity.  The
+ * watchdogs of a slot on a higher level are moved to the lower levels once
+ * the ticks reach the slot.
+ *
+ * @see _Watchdog_Header_initialize_wheel().
+ */
+typedef struct {
+  /**
+   * @brief The ticks value processed by the last tick.
+   */
+  uint64_t now;
+
+  /**
+   * @brief The slots of the levels with the scheduled watchdogs.
+   *
+   * The watchdogs of a slot on level zero expire all at the same tick.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+
+  /**
+   * @brief Watchdogs which expire too far in the future to be placed on a
+   * level.
+   */
+  Chain_Control Overflow;
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -79,6 +129,14 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel of this header.
+   *
+   * In case this member is not NULL, then the scheduled watchdogs are managed
+   * by this timing wheel and not by the red-black tree.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -24,6 +24,7 @@
 #include <rtems/score/watchdog.h>
 #include <rtems/score/watchdogticks.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/rbtreeimpl.h>
@@ -103,11 +104,47 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
+/**
+ * @brief Initializes the watchdog header to use a timing wheel.
+ *
+ * The header must have no scheduled watchdogs.
+ *
+ * @param[out] header The header to initialize.
+ * @param[out] wheel The timing wheel for the header.
+ * @param now The current ticks value.
+ */
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+);
+
+/**
+ * @brief The per-processor timing wheels.
+ *
+ * This array is provided via <rtems/confdefs.h> in case
+ * CONFIGURE_WATCHDOG_TIMING_WHEEL is defined.  There must be one timing wheel
+ * for each configured processor.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Uses the per-processor timing wheels for the ticks based watchdog
+ * header of each processor.
+ *
+ * This function is registered as a system initialization handler via
+ * <rtems/confdefs.h> in case CONFIGURE_WATCHDOG_TIMING_WHEEL is defined.
+ */
+void _Watchdog_Wheel_initialize( void );
+
 /**
  * @brief Returns the first of the watchdog header.
  *
+ * This function must not be used for watchdog headers with a timing wheel.
+ *
  * @param header The watchdog header to remove the first of.
  *
  * @return The first of @a header.
@@ -139,6 +176,34 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Calls the routine of each expired watchdog of the monotonic and
+ * realtime watchdog headers of the processor.
+ *
+ * In contrast to _Watchdog_Tick(), the watchdog ticks are not incremented.
+ * This function may be used by clock drivers with a one-shot clock event to
+ * service the nanoseconds based watchdogs in between two ticks.
+ *
+ * @param cpu The processor of the watchdog headers.
+ */
+void _Watchdog_Tickle_clocks( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Gets the expiration time of the next watchdog to expire.
+ *
+ * The caller must own the lock which protects the watchdog header.  For a
+ * watchdog header with a timing wheel, the returned value may be less than
+ * the actual expiration time of the next watchdog, since the watchdogs on the
+ * higher levels are only taken into account with the ticks value at which
+ * they move to the lower levels.
+ *
+ * @param header The watchdog header.
+ *
+ * @retval WATCHDOG_MAXIMUM_TICKS No watchdog is scheduled.
+ * @retval other The expiration time of the next watchdog to expire.
+ */
+uint64_t _Watchdog_Header_next_expiration( const Watchdog_Header *header );
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -271,6 +336,83 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+/**
+ * @brief Advances the timing wheel of the watchdog header to the ticks value
+ * and calls the routine of each expired watchdog.
+ *
+ * @param header The watchdog header with a timing wheel.
+ * @param now The current ticks value.  It must be the ticks value of the
+ *      previous call plus one.
+ * @param lock The lock that is released before calling the routine and then
+ *      acquired after the call.
+ * @param lock_context The lock context for the release before calling the
+ *      routine and for the acquire after.
+ */
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock, lock_context )
+#else
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock_context )
+#endif
+
+/**
+ * @brief Places the watchdog on the timing wheel according to its expiration
+ * time.
+ *
+ * @param[in, out] wheel The timing wheel.
+ * @param[in, out] the_watchdog The watchdog to place.
+ * @param next The next ticks value to process.  Watchdogs with an expiration
+ *   time before this value are placed to expire at this ticks value.
+ */
+RTEMS_INLINE_ROUTINE void _Watchdog_Wheel_place(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          next
+)
+{
+  uint64_t      key;
+  uint64_t      delta;
+  unsigned int  level;
+  Chain_Control *slot;
+
+  key = the_watchdog->expire;
+
+  if ( key < next ) {
+    key = next;
+  }
+
+  delta = key - next;
+  level = 0;
+
+  while (
+    level < WATCHDOG_WHEEL_LEVEL_COUNT
+      && ( delta >> ( WATCHDOG_WHEEL_SLOT_BITS * ( level + 1 ) ) ) != 0
+  ) {
+    ++level;
+  }
+
+  if ( level < WATCHDOG_WHEEL_LEVEL_COUNT ) {
+    slot = &wheel->Slots[ level ][
+      ( key >> ( WATCHDOG_WHEEL_SLOT_BITS * level ) )
+        & ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+    ];
+  } else {
+    slot = &wheel->Overflow;
+  }
+
+  _Chain_Append_unprotected( slot, &the_watchdog->Node.Chain );
+}
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
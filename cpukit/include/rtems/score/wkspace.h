@@ -74,6 +74,21 @@ void _Workspace_Handler_initialization(
  */
 void *_Workspace_Allocate( size_t size );
 
+/**
+ * @brief Allocates a memory block of the specified size and alignment from
+ * the workspace.
+ *
+ * @param size The size of the memory block.
+ * @param alignment The alignment of the memory block.  It must be a power of
+ *   two.
+ *
+ * @retval pointer The pointer to the memory block.  The pointer is aligned by
+ *   the specified alignment and at least by CPU_HEAP_ALIGNMENT.
+ * @retval NULL No memory block with the requested size and alignment is
+ *   available in the workspace.
+ */
+void *_Workspace_Allocate_aligned( size_t size, size_t alignment );
+
 /**
  * @brief Frees memory to the workspace.
  *
@@ -37,7 +37,7 @@
 #ifndef _RTEMS_SCORE_WKSPACEDATA_H
 #define _RTEMS_SCORE_WKSPACEDATA_H
 
-#include <rtems/score/basedefs.h>
+#include <rtems/score/heap.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,6 +65,16 @@ extern const uintptr_t _Workspace_Size;
  */
 extern const bool _Workspace_Is_unified;
 
+/**
+ * @brief The handler to initialize the workspace and the C program heap.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>.  The default is _Heap_Initialize().  In case
+ * CONFIGURE_SEGREGATED_FIT_HEAPS is defined, then it is
+ * _Heap_Initialize_segregated().
+ */
+extern const Heap_Initialization_or_extend_handler _Workspace_Heap_initialize;
+
 /** @} */
 
 #ifdef __cplusplus
@@ -58,6 +58,7 @@ extern "C" {
 #define RTEMS_SYSINIT_CLASSIC_DUAL_PORTED_MEMORY 001200
 #define RTEMS_SYSINIT_CLASSIC_RATE_MONOTONIC     001300
 #define RTEMS_SYSINIT_CLASSIC_BARRIER            001400
+#define RTEMS_SYSINIT_CLASSIC_RWLOCK             001480
 #define RTEMS_SYSINIT_POSIX_SIGNALS              001500
 #define RTEMS_SYSINIT_POSIX_THREADS              001600
 #define RTEMS_SYSINIT_POSIX_MESSAGE_QUEUE        001700
@@ -66,6 +67,7 @@ extern "C" {
 #define RTEMS_SYSINIT_POSIX_SHM                  001a00
 #define RTEMS_SYSINIT_POSIX_KEYS                 001b00
 #define RTEMS_SYSINIT_POSIX_CLEANUP              001c00
+#define RTEMS_SYSINIT_OBJECTS_NAME_INDEX         001c80
 #define RTEMS_SYSINIT_IDLE_THREADS               001d00
 #define RTEMS_SYSINIT_LIBIO                      001e00
 #define RTEMS_SYSINIT_USER_ENVIRONMENT           001e80
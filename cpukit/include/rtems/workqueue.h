@@ -0,0 +1,194 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSWorkQueue
+ *
+ * @brief Per-Processor Work Queue API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_WORKQUEUE_H
+#define _RTEMS_WORKQUEUE_H
+
+#include <rtems.h>
+
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSWorkQueue Work Queue
+ *
+ * @ingroup RTEMSAPIClassic
+ *
+ * @brief Per-processor work queue to defer work to thread context.
+ *
+ * The work queue provides one worker task for each processor with a
+ * scheduler.  Work items may be submitted to the work queue of a processor
+ * from interrupt and thread context on any processor.  The work item handler
+ * is invoked by the worker task of the selected processor.  Use it for
+ * example to move the bottom half processing of device drivers out of
+ * interrupt context to a particular processor.
+ *
+ * The submission of work items is lock-free.  The worker task is only woken
+ * up if the work queue was empty, so submissions to a busy work queue need no
+ * inter-processor interrupt.
+ *
+ * @{
+ */
+
+struct rtems_work_item;
+
+/**
+ * @brief Work item handler.
+ *
+ * @param item The work item.
+ */
+typedef void ( *rtems_work_handler )( struct rtems_work_item *item );
+
+/**
+ * @brief A work item.
+ *
+ * The members are private and should not be accessed directly.  Use
+ * rtems_work_item_initialize() to initialize a work item.
+ */
+typedef struct rtems_work_item {
+  /**
+   * @brief The next work item in the list of pending work items.
+   */
+  struct rtems_work_item *next;
+
+  /**
+   * @brief The work item handler.
+   */
+  rtems_work_handler handler;
+
+  /**
+   * @brief Indicates if the work item is pending.
+   */
+#ifdef __cplusplus
+  std::atomic_uint pending;
+#else
+  atomic_uint pending;
+#endif
+} rtems_work_item;
+
+/**
+ * @brief Initializes the work queue.
+ *
+ * Creates and starts a worker task for each processor with a scheduler.  The
+ * worker tasks use the scheduler of their processor and have an affinity to
+ * their processor.  In case of an error, all worker tasks created so far are
+ * deleted.
+ *
+ * @param priority The worker task priority.
+ * @param stack_size The worker task stack size.
+ * @param modes The worker task modes.
+ * @param attributes The worker task attributes.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The work queue is already initialized.
+ * @retval RTEMS_TOO_MANY No free task available to create a worker task.
+ * @retval RTEMS_UNSATISFIED Not enough memory to create a worker task.
+ * @retval RTEMS_INVALID_PRIORITY Invalid worker task priority.
+ * @retval RTEMS_INVALID_NUMBER The scheduler of a processor does not support
+ *   the affinity of a worker task to its processor.
+ */
+rtems_status_code rtems_work_queue_initialize(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_mode          modes,
+  rtems_attribute     attributes
+);
+
+/**
+ * @brief Initializes the work item.
+ *
+ * @param[out] item The work item to initialize.
+ * @param handler The work item handler.
+ */
+void rtems_work_item_initialize(
+  rtems_work_item    *item,
+  rtems_work_handler  handler
+);
+
+/**
+ * @brief Submits the work item to the work queue of the processor.
+ *
+ * The work item handler is invoked once by the worker task of the processor.
+ * A work item which is already pending is not submitted again.  The work item
+ * is no longer pending once its handler is invoked, so the handler may
+ * submit it again.
+ *
+ * This function may be called from interrupt context.
+ *
+ * @param[in, out] item The work item to submit.
+ * @param cpu_index The index of the processor to perform the work.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The work queue is not initialized.
+ * @retval RTEMS_RESOURCE_IN_USE The work item is already pending.
+ * @retval RTEMS_INVALID_NUMBER The processor index is invalid or there is no
+ *   worker task for this processor.
+ */
+rtems_status_code rtems_work_item_submit(
+  rtems_work_item *item,
+  uint32_t         cpu_index
+);
+
+/**
+ * @brief Submits the work item to the work queue of the current processor.
+ *
+ * This function may be called from interrupt context.
+ *
+ * @param[in, out] item The work item to submit.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE The work queue is not initialized.
+ * @retval RTEMS_RESOURCE_IN_USE The work item is already pending.
+ * @retval RTEMS_INVALID_NUMBER There is no worker task for the current
+ *   processor.
+ *
+ * @see rtems_work_item_submit().
+ */
+rtems_status_code rtems_work_item_submit_local( rtems_work_item *item );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_WORKQUEUE_H */
@@ -79,6 +79,20 @@ typedef struct rtems_bdbuf_swapout_worker
                                           * thread. */
 } rtems_bdbuf_swapout_worker;
 
+/**
+ * Asynchronous read-ahead request. The read-ahead task submits these requests
+ * to the device drivers and collects them on a chain once the driver
+ * signalled the completion.
+ */
+typedef struct rtems_bdbuf_read_ahead_request
+{
+  rtems_chain_node     link;     /**< The requests sit on the free chain when
+                                  * idle and on the done chain when
+                                  * completed. */
+  rtems_disk_device   *dd;       /**< The device the request is for. */
+  rtems_blkdev_request read_req; /**< The read request. */
+} rtems_bdbuf_read_ahead_request;
+
 /**
  * Buffer waiters synchronization.
  */
@@ -87,6 +101,57 @@ typedef struct rtems_bdbuf_waiters {
   rtems_condition_variable cond_var;
 } rtems_bdbuf_waiters;
 
+/**
+ * A partition of the BD buffer cache. Each disk device uses exactly one
+ * partition. A partition has its own buffers, lists and lock, so accesses to
+ * disk devices of different partitions do not contend with each other.
+ */
+typedef struct rtems_bdbuf_partition
+{
+  rtems_mutex         lock;              /**< The partition lock. It locks all
+                                          * partition data, BD and lists. */
+  bool                sync_active;       /**< True if a sync is active. */
+  rtems_id            sync_requester;    /**< The sync requester. */
+  rtems_disk_device  *sync_device;       /**< The device to sync and
+                                          * BDBUF_INVALID_DEV not a device
+                                          * sync. */
+
+  rtems_bdbuf_buffer* bds;               /**< First buffer descriptor of the
+                                          * partition. */
+  size_t              bd_count;          /**< Number of buffer descriptors of
+                                          * the partition. */
+  size_t              group_count;       /**< The number of groups. */
+  rtems_bdbuf_group*  groups;            /**< The groups. */
+
+  rtems_bdbuf_buffer** hash_table;       /**< Buffer descriptor lookup hash
+                                          * table. */
+  size_t              hash_mask;         /**< The hash table size minus one. */
+  rtems_chain_control lru;               /**< Least recently used list */
+  rtems_chain_control probation;         /**< Probation list of the 2Q
+                                          * replacement policy */
+  size_t              probation_count;   /**< Count of BDs on the probation
+                                          * list. */
+  size_t              probation_limit;   /**< Buffers are recycled from the
+                                          * probation list first, if it
+                                          * holds more BDs than this
+                                          * limit. */
+  rtems_chain_control modified;          /**< Modified buffers list */
+  rtems_chain_control sync;              /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
+                                          * available. */
+
+  rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
+  uint32_t            read_ahead_stamp;  /**< Stamp for the read-ahead stream
+                                          * replacement */
+} rtems_bdbuf_partition;
+
 /**
  * The BD buffer cache.
  */
@@ -108,37 +173,27 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_mutex         lock;              /**< The cache lock. It locks the
+                                          * free swapout workers and the
+                                          * partition assignment. */
   rtems_mutex         sync_lock;         /**< Sync calls block writes. */
-  bool                sync_active;       /**< True if a sync is active. */
-  rtems_id            sync_requester;    /**< The sync requester. */
-  rtems_disk_device  *sync_device;       /**< The device to sync and
-                                          * BDBUF_INVALID_DEV not a device
-                                          * sync. */
-
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
 
   size_t              group_count;       /**< The number of groups. */
   rtems_bdbuf_group*  groups;            /**< The groups. */
+  size_t              partition_count;   /**< The number of partitions. */
+  rtems_bdbuf_partition* partitions;     /**< The partitions. */
+  size_t              next_partition;    /**< The partition assigned to the
+                                          * next disk device. */
   rtems_id            read_ahead_task;   /**< Read-ahead task */
-  rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
+  rtems_bdbuf_read_ahead_request *read_ahead_requests; /**< The read-ahead
+                                                        * requests. */
+  rtems_chain_control read_ahead_free;   /**< Free read-ahead requests, only
+                                          * used by the read-ahead task */
+  rtems_chain_control read_ahead_done;   /**< Completed read-ahead requests,
+                                          * protected by interrupt disable */
   bool                read_ahead_enabled; /**< Read-ahead enabled */
   rtems_status_code   init_status;       /**< The initialization status */
   pthread_once_t      once;
@@ -176,22 +231,26 @@ typedef enum {
  */
 #define RTEMS_BDBUF_SWAPOUT_SYNC   RTEMS_EVENT_2
 #define RTEMS_BDBUF_READ_AHEAD_WAKE_UP RTEMS_EVENT_1
+#define RTEMS_BDBUF_READ_AHEAD_DONE RTEMS_EVENT_3
+
+/**
+ * The count of read-ahead requests which may be in flight at the same time
+ * for all devices.
+ */
+#define RTEMS_BDBUF_READ_AHEAD_REQUESTS 8
 
 static rtems_task rtems_bdbuf_swapout_task(rtems_task_argument arg);
 
 static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
 
+static void rtems_bdbuf_start_read_ahead_of_miss(rtems_blkdev_read_ahead *ra);
+
 /**
  * The Buffer Descriptor cache.
  */
 static rtems_bdbuf_cache bdbuf_cache = {
   .lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .sync_lock = RTEMS_MUTEX_INITIALIZER(NULL),
-  .access_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
-  .transfer_waiters = {
-    .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL)
-  },
-  .buffer_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
   .once = PTHREAD_ONCE_INIT
 };
 
@@ -226,23 +285,32 @@ rtems_bdbuf_list_count (rtems_chain_control* list)
 void
 rtems_bdbuf_show_usage (void)
 {
-  uint32_t group;
-  uint32_t total = 0;
-  uint32_t val;
-
-  for (group = 0; group < bdbuf_cache.group_count; group++)
-    total += bdbuf_cache.groups[group].users;
-  printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
-  printf (", total=%lu\n", total);
+  size_t i;
+
+  for (i = 0; i < bdbuf_cache.partition_count; i++)
+  {
+    rtems_bdbuf_partition* p = &bdbuf_cache.partitions[i];
+    uint32_t               group;
+    uint32_t               total = 0;
+    uint32_t               val;
+
+    for (group = 0; group < p->group_count; group++)
+      total += p->groups[group].users;
+    printf ("bdbuf:partition %zu: group users=%lu", i, total);
+    val = rtems_bdbuf_list_count (&p->lru);
+    printf (", lru=%lu", val);
+    total = val;
+    val = rtems_bdbuf_list_count (&p->probation);
+    printf (", probation=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&p->modified);
+    printf (", mod=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&p->sync);
+    printf (", sync=%lu", val);
+    total += val;
+    printf (", total=%lu\n", total);
+  }
 }
 
 /**
@@ -271,15 +339,6 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define rtems_bdbuf_show_users(_w, _b) ((void) 0)
 #endif
 
-/**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
- */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
-#endif
-
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -293,493 +352,123 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
   rtems_bdbuf_fatal ((((uint32_t) state) << 16) | error);
 }
 
+/**
+ * Returns the hash table bucket for the specified dd/block.
+ *
+ * Consecutive blocks of a device map to consecutive buckets.  The device
+ * pointer is scrambled with a multiplicative hash to place the blocks of
+ * different devices at different bucket offsets.
+ *
+ * @param p partition of the disk device
+ * @param dd disk device key
+ * @param block block key
+ * @return pointer to the bucket head
+ */
+static rtems_bdbuf_buffer **
+rtems_bdbuf_hash_bucket (const rtems_bdbuf_partition *p,
+                         const rtems_disk_device     *dd,
+                         rtems_blkdev_bnum            block)
+{
+  uint32_t h = (uint32_t) ((uintptr_t) dd >> 4) * UINT32_C (0x9e3779b1);
+
+  return &p->hash_table[(h + block) & p->hash_mask];
+}
+
 /**
  * Searches for the node with specified dd/block.
  *
- * @param root pointer to the root node of the AVL-Tree
+ * @param p partition of the disk device
  * @param dd disk device search key
  * @param block block search key
  * @retval NULL node with the specified dd/block is not found
  * @return pointer to the node with specified dd/block
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+rtems_bdbuf_hash_search (const rtems_bdbuf_partition *p,
+                         const rtems_disk_device     *dd,
+                         rtems_blkdev_bnum            block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  rtems_bdbuf_buffer* bd = *rtems_bdbuf_hash_bucket (p, dd, block);
 
-  while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
+  while ((bd != NULL) && ((bd->dd != dd) || (bd->block != block)))
+    bd = bd->hash_next;
 
-  return p;
+  return bd;
 }
 
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Inserts the specified node to the hash table.
  *
- * @param root pointer to the root node of the AVL-Tree
+ * @param p The partition of the node.
  * @param node Pointer to the node to add.
  * @retval 0 The node added successfully
- * @retval -1 An error occured
+ * @retval -1 A node with the same dd/block is already in the hash table
  */
 static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+rtems_bdbuf_hash_insert (rtems_bdbuf_partition* p, rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+  rtems_bdbuf_buffer** bucket = rtems_bdbuf_hash_bucket (p, node->dd,
+                                                         node->block);
+  rtems_bdbuf_buffer*  bd = *bucket;
 
-  while (p != NULL)
+  while (bd != NULL)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
+    if ((bd->dd == node->dd) && (bd->block == node->block))
       return -1;
-    }
 
-    p = q;
+    bd = bd->hash_next;
   }
 
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
+  node->hash_next = *bucket;
+  *bucket = node;
 
   return 0;
 }
 
-
 /**
- * Removes the node from the tree.
+ * Removes the node from the hash table.
  *
- * @param root Pointer to pointer to the root node
+ * @param p The partition of the node.
  * @param node Pointer to the node to remove
  * @retval 0 Item removed
  * @retval -1 No such item found
  */
 static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+rtems_bdbuf_hash_remove (rtems_bdbuf_partition*    p,
+                         const rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
+  rtems_bdbuf_buffer** prev = rtems_bdbuf_hash_bucket (p, node->dd,
+                                                       node->block);
 
-  memset (buf_stack, 0, sizeof(buf_stack));
-
-  while (p != NULL)
+  while (*prev != NULL)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
+    if (*prev == node)
     {
-      p->avl.cache = -1;
-      p = p->avl.left;
+      *prev = node->hash_next;
+      return 0;
     }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
-
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
-
-  q = p;
 
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
-  {
-    p = NULL;
-  }
-
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
+    prev = &(*prev)->hash_next;
   }
-  else
-  {
-    rtems_bdbuf_buffer **t;
-
-    r = q->avl.right;
-
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
-
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
 
-      *t = q = s;
-    }
-  }
-
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
-  }
-
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
+  return -1;
+}
 
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
+/**
+ * Returns the hash table size for the specified count of buffer descriptors.
+ *
+ * The size is a power of two greater than or equal to the buffer descriptor
+ * count, so that the average bucket length is at most one.
+ */
+static size_t
+rtems_bdbuf_hash_table_size (size_t bd_count)
+{
+  size_t size = 1;
 
-  }
+  while (size < bd_count)
+    size <<= 1;
 
-  return 0;
+  return size;
 }
 
 static void
@@ -842,6 +531,28 @@ rtems_bdbuf_unlock_cache (void)
   rtems_bdbuf_unlock (&bdbuf_cache.lock);
 }
 
+/**
+ * Lock the partition.
+ *
+ * @param p The partition to lock.
+ */
+static void
+rtems_bdbuf_lock_partition (rtems_bdbuf_partition *p)
+{
+  rtems_bdbuf_lock (&p->lock);
+}
+
+/**
+ * Unlock the partition.
+ *
+ * @param p The partition to unlock.
+ */
+static void
+rtems_bdbuf_unlock_partition (rtems_bdbuf_partition *p)
+{
+  rtems_bdbuf_unlock (&p->lock);
+}
+
 /**
  * Lock the cache's sync. A single task can nest calls.
  */
@@ -878,34 +589,38 @@ rtems_bdbuf_group_release (rtems_bdbuf_buffer *bd)
  * be woken and this would require storage and we do not know the number of
  * tasks that could be waiting.
  *
- * While we have the cache locked we can try and claim the semaphore and
- * therefore know when we release the lock to the cache we will block until the
- * semaphore is released. This may even happen before we get to block.
+ * While we have the partition locked we can try and claim the semaphore and
+ * therefore know when we release the lock to the partition we will block
+ * until the semaphore is released. This may even happen before we get to
+ * block.
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
- * exit.
+ * The function assumes the partition is locked on entry and it will be locked
+ * on exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_partition *p,
+                            rtems_bdbuf_waiters   *waiters)
 {
   /*
    * Indicate we are waiting.
    */
   ++waiters->count;
 
-  rtems_condition_variable_wait (&waiters->cond_var, &bdbuf_cache.lock);
+  rtems_condition_variable_wait (&waiters->cond_var, &p->lock);
 
   --waiters->count;
 }
 
 static void
-rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_wait (rtems_bdbuf_partition *p,
+                  rtems_bdbuf_buffer    *bd,
+                  rtems_bdbuf_waiters   *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (p, waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -933,40 +648,69 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_partition *p)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return p->buffer_waiters.count;
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash_table (rtems_bdbuf_partition *p,
+                                    rtems_bdbuf_buffer    *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_remove (p, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+/**
+ * Returns true if the buffer belongs on the probation list of the 2Q
+ * replacement policy, otherwise false.  The access count of a buffer changes
+ * only while it is on no list.
+ */
+static bool
+rtems_bdbuf_is_on_probation (const rtems_bdbuf_buffer *bd)
+{
+  return bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_POLICY_2Q
+    && bd->accesses < 2;
+}
+
+/**
+ * Extracts the buffer from the list it is on.
+ */
+static void
+rtems_bdbuf_extract_from_list (rtems_bdbuf_partition *p,
+                               rtems_bdbuf_buffer    *bd)
+{
+  if (bd->state == RTEMS_BDBUF_STATE_CACHED && rtems_bdbuf_is_on_probation (bd))
+    --p->probation_count;
+
+  rtems_chain_extract_unprotected (&bd->link);
+}
+
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash_table_and_lru_list (rtems_bdbuf_partition *p,
+                                                 rtems_bdbuf_buffer    *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      ++bd->dd->stats.evictions;
+      rtems_bdbuf_remove_from_hash_table (p, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
   }
 
-  rtems_chain_extract_unprotected (&bd->link);
+  rtems_bdbuf_extract_from_list (p, bd);
 }
 
 static void
-rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_partition *p,
+                                           rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&p->lru, &bd->link);
 }
 
 static void
@@ -976,30 +720,39 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_partition *p,
+                                             rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+
+  if (rtems_bdbuf_is_on_probation (bd))
+  {
+    ++p->probation_count;
+    rtems_chain_append_unprotected (&p->probation, &bd->link);
+  }
+  else
+    rtems_chain_append_unprotected (&p->lru, &bd->link);
 }
 
 static void
-rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer (rtems_bdbuf_partition *p, rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_make_empty (bd);
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_remove_from_hash_table (p, bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (p, bd);
   }
 }
 
 static void
-rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_partition *p,
+                                               rtems_bdbuf_buffer    *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  if (p->sync_active && p->sync_device == bd->dd)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_partition (p);
 
     /*
      * Wait for the sync lock.
@@ -1007,7 +760,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_partition (p);
   }
 
   /*
@@ -1026,24 +779,25 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&p->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&p->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (p))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
-rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_partition *p,
+                                          rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+  rtems_bdbuf_make_cached_and_add_to_lru_list (p, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&p->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
 }
 
 /**
@@ -1071,28 +825,32 @@ rtems_bdbuf_bds_per_group (size_t size)
 }
 
 static void
-rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_partition *p,
+                                         rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_discard_buffer (bd);
+  rtems_bdbuf_discard_buffer (p, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&p->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
- * list of the cache.
+ * from the hash table and any lists then the new BD's are prepended to the
+ * ready list of the partition.
  *
+ * @param p The partition of the group.
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
  * @return A buffer of this group.
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
+rtems_bdbuf_group_realloc (rtems_bdbuf_partition* p,
+                           rtems_bdbuf_group*     group,
+                           size_t                 new_bds_per_group)
 {
   rtems_bdbuf_buffer* bd;
   size_t              b;
@@ -1108,7 +866,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_hash_table_and_lru_list (p, bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1116,38 +874,41 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 1, bd = group->bdbuf + bufs_per_bd;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (p, bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
 
   return group->bdbuf;
 }
 
 static void
-rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
-                                rtems_disk_device  *dd,
-                                rtems_blkdev_bnum   block)
+rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_partition *p,
+                                rtems_bdbuf_buffer    *bd,
+                                rtems_disk_device     *dd,
+                                rtems_blkdev_bnum      block)
 {
   bd->dd        = dd ;
   bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
+  bd->hash_next = NULL;
   bd->waiters   = 0;
+  bd->accesses  = 0;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (p, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_from_list (rtems_bdbuf_partition *p,
+                                  rtems_chain_control   *list,
+                                  rtems_disk_device     *dd,
+                                  rtems_blkdev_bnum      block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (list);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (list, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1165,17 +926,18 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_hash_table_and_lru_list (p, bd);
 
         empty_bd = bd;
       }
       else if (bd->group->users == 0)
-        empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
+        empty_bd = rtems_bdbuf_group_realloc (p, bd->group,
+                                              dd->bds_per_group);
     }
 
     if (empty_bd != NULL)
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+      rtems_bdbuf_setup_empty_buffer (p, empty_bd, dd, block);
 
       return empty_bd;
     }
@@ -1186,6 +948,44 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
   return NULL;
 }
 
+/**
+ * Returns true if buffers should be recycled from the probation list before
+ * the LRU list, otherwise false.  Free buffers are at the head of the LRU
+ * list and are always used first.
+ */
+static bool
+rtems_bdbuf_recycle_probation_first (const rtems_bdbuf_partition *p)
+{
+  const rtems_chain_node *node;
+
+  if (p->probation_count <= p->probation_limit)
+    return false;
+
+  node = rtems_chain_immutable_first (&p->lru);
+
+  return rtems_chain_is_tail (&p->lru, node)
+    || ((const rtems_bdbuf_buffer *) node)->state != RTEMS_BDBUF_STATE_FREE;
+}
+
+static rtems_bdbuf_buffer *
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_partition *p,
+                                      rtems_disk_device     *dd,
+                                      rtems_blkdev_bnum      block)
+{
+  rtems_bdbuf_buffer *bd = NULL;
+
+  if (rtems_bdbuf_recycle_probation_first (p))
+    bd = rtems_bdbuf_get_buffer_from_list (p, &p->probation, dd, block);
+
+  if (bd == NULL)
+    bd = rtems_bdbuf_get_buffer_from_list (p, &p->lru, dd, block);
+
+  if (bd == NULL)
+    bd = rtems_bdbuf_get_buffer_from_list (p, &p->probation, dd, block);
+
+  return bd;
+}
+
 static rtems_status_code
 rtems_bdbuf_create_task(
   rtems_name name,
@@ -1296,6 +1096,49 @@ rtems_bdbuf_read_request_size (uint32_t transfer_count)
     + sizeof (rtems_blkdev_sg_buffer) * transfer_count;
 }
 
+static void
+rtems_bdbuf_read_ahead_done (rtems_blkdev_request *req,
+                             rtems_status_code     status);
+
+static size_t
+rtems_bdbuf_read_ahead_request_size (void)
+{
+  return sizeof (rtems_bdbuf_read_ahead_request)
+    + (bdbuf_config.max_read_ahead_blocks * sizeof (rtems_blkdev_sg_buffer));
+}
+
+static rtems_status_code
+rtems_bdbuf_read_ahead_requests_create (void)
+{
+  size_t  r;
+  size_t  request_size;
+  char   *request_current;
+
+  request_size = rtems_bdbuf_read_ahead_request_size ();
+  request_current = calloc (RTEMS_BDBUF_READ_AHEAD_REQUESTS, request_size);
+  if (request_current == NULL)
+    return RTEMS_NO_MEMORY;
+
+  bdbuf_cache.read_ahead_requests =
+    (rtems_bdbuf_read_ahead_request *) request_current;
+
+  for (r = 0;
+       r < RTEMS_BDBUF_READ_AHEAD_REQUESTS;
+       r++, request_current += request_size)
+  {
+    rtems_bdbuf_read_ahead_request *rar =
+      (rtems_bdbuf_read_ahead_request *) request_current;
+
+    rar->read_req.req = RTEMS_BLKDEV_REQ_READ;
+    rar->read_req.done = rtems_bdbuf_read_ahead_done;
+    rar->read_req.io_task = bdbuf_cache.read_ahead_task;
+
+    rtems_chain_append_unprotected (&bdbuf_cache.read_ahead_free, &rar->link);
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
 static rtems_status_code
 rtems_bdbuf_do_init (void)
 {
@@ -1322,22 +1165,16 @@ rtems_bdbuf_do_init (void)
       > RTEMS_MINIMUM_STACK_SIZE / 8U)
     return RTEMS_INVALID_NUMBER;
 
-  bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
+  if (bdbuf_config.partitions == 0
+      || bdbuf_config.size / bdbuf_config.buffer_max < bdbuf_config.partitions)
+    return RTEMS_INVALID_NUMBER;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
-  rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
+  rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_free);
+  rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_done);
 
   rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
   rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
-  rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
-                                     "bdbuf access");
-  rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
-                                     "bdbuf transfer");
-  rtems_condition_variable_set_name (&bdbuf_cache.buffer_waiters.cond_var,
-                                     "bdbuf buffer");
 
   rtems_bdbuf_lock_cache ();
 
@@ -1350,6 +1187,7 @@ rtems_bdbuf_do_init (void)
     bdbuf_config.buffer_max / bdbuf_config.buffer_min;
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
+  bdbuf_cache.partition_count = bdbuf_config.partitions;
 
   /*
    * Allocate the memory for the buffer descriptors.
@@ -1367,6 +1205,14 @@ rtems_bdbuf_do_init (void)
   if (!bdbuf_cache.groups)
     goto error;
 
+  /*
+   * Allocate the memory for the partitions.
+   */
+  bdbuf_cache.partitions = calloc (sizeof (rtems_bdbuf_partition),
+                                   bdbuf_cache.partition_count);
+  if (!bdbuf_cache.partitions)
+    goto error;
+
   /*
    * Allocate memory for buffer memory. The buffer memory will be cache
    * aligned. It is possible to free the memory allocated by
@@ -1378,8 +1224,8 @@ rtems_bdbuf_do_init (void)
     goto error;
 
   /*
-   * The cache is empty after opening so we need to add all the buffers to it
-   * and initialise the groups.
+   * The cache is empty after opening so we need to initialise the buffers and
+   * the groups.
    */
   for (b = 0, group = bdbuf_cache.groups,
          bd = bdbuf_cache.bds, buffer = bdbuf_cache.buffers;
@@ -1390,8 +1236,6 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
-
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
       group++;
@@ -1409,6 +1253,55 @@ rtems_bdbuf_do_init (void)
     group->bdbuf = bd;
   }
 
+  /*
+   * Distribute the groups evenly to the partitions and add the buffers of each
+   * partition to its LRU list.
+   */
+  for (b = 0, group = bdbuf_cache.groups;
+       b < bdbuf_cache.partition_count;
+       b++)
+  {
+    rtems_bdbuf_partition* p = &bdbuf_cache.partitions[b];
+    size_t                 i;
+
+    p->group_count = bdbuf_cache.group_count / bdbuf_cache.partition_count;
+    if (b < bdbuf_cache.group_count % bdbuf_cache.partition_count)
+      ++p->group_count;
+
+    p->groups = group;
+    p->bds = group->bdbuf;
+    p->bd_count = p->group_count * bdbuf_cache.max_bds_per_group;
+    p->probation_limit = p->bd_count / 4;
+    p->sync_device = BDBUF_INVALID_DEV;
+
+    rtems_mutex_init (&p->lock, "bdbuf partition");
+    rtems_condition_variable_init (&p->access_waiters.cond_var,
+                                   "bdbuf access");
+    rtems_condition_variable_init (&p->transfer_waiters.cond_var,
+                                   "bdbuf transfer");
+    rtems_condition_variable_init (&p->buffer_waiters.cond_var,
+                                   "bdbuf buffer");
+
+    rtems_chain_initialize_empty (&p->lru);
+    rtems_chain_initialize_empty (&p->probation);
+    rtems_chain_initialize_empty (&p->modified);
+    rtems_chain_initialize_empty (&p->sync);
+    rtems_chain_initialize_empty (&p->read_ahead_chain);
+
+    /*
+     * Allocate the buffer descriptor lookup hash table.
+     */
+    p->hash_mask = rtems_bdbuf_hash_table_size (p->bd_count) - 1;
+    p->hash_table = calloc (sizeof (rtems_bdbuf_buffer*), p->hash_mask + 1);
+    if (!p->hash_table)
+      goto error;
+
+    for (i = 0; i < p->bd_count; i++)
+      rtems_chain_append_unprotected (&p->lru, &p->bds[i].link);
+
+    group += p->group_count;
+  }
+
   /*
    * Create and start swapout task.
    */
@@ -1451,6 +1344,10 @@ rtems_bdbuf_do_init (void)
     if (sc != RTEMS_SUCCESSFUL)
       goto error;
 
+    sc = rtems_bdbuf_read_ahead_requests_create ();
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
     sc = rtems_task_start (bdbuf_cache.read_ahead_task,
                            rtems_bdbuf_read_ahead_task,
                            0);
@@ -1488,11 +1385,19 @@ error:
     }
   }
 
+  if (bdbuf_cache.partitions)
+  {
+    for (b = 0; b < bdbuf_cache.partition_count; b++)
+      free (bdbuf_cache.partitions[b].hash_table);
+  }
+
   free (bdbuf_cache.buffers);
+  free (bdbuf_cache.partitions);
   free (bdbuf_cache.groups);
   free (bdbuf_cache.bds);
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
+  free (bdbuf_cache.read_ahead_requests);
 
   rtems_bdbuf_unlock_cache ();
 
@@ -1532,6 +1437,21 @@ rtems_bdbuf_wait_for_event (rtems_event_set event)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_WAIT_EVNT);
 }
 
+static void
+rtems_bdbuf_wait_for_any_event (rtems_event_set events)
+{
+  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_event_set   out = 0;
+
+  sc = rtems_event_receive (events,
+                            RTEMS_EVENT_ANY | RTEMS_WAIT,
+                            RTEMS_NO_TIMEOUT,
+                            &out);
+
+  if (sc != RTEMS_SUCCESSFUL)
+    rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_WAIT_EVNT);
+}
+
 static void
 rtems_bdbuf_wait_for_transient_event (void)
 {
@@ -1543,7 +1463,8 @@ rtems_bdbuf_wait_for_transient_event (void)
 }
 
 static void
-rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_access (rtems_bdbuf_partition *p,
+                             rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1553,7 +1474,7 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
         rtems_bdbuf_group_release (bd);
         /* Fall through */
       case RTEMS_BDBUF_STATE_CACHED:
-        rtems_chain_extract_unprotected (&bd->link);
+        rtems_bdbuf_extract_from_list (p, bd);
         /* Fall through */
       case RTEMS_BDBUF_STATE_EMPTY:
         return;
@@ -1561,12 +1482,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (p, bd, &p->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (p, bd, &p->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1575,11 +1496,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_partition *p,
+                                              rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&p->sync, &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1590,7 +1512,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
  * @retval @c false Buffer is invalid and has to searched again.
  */
 static bool
-rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_recycle (rtems_bdbuf_partition *p,
+                              rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1599,7 +1522,7 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_FREE:
         return true;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        rtems_bdbuf_request_sync_for_modified_buffer (bd);
+        rtems_bdbuf_request_sync_for_modified_buffer (p, bd);
         break;
       case RTEMS_BDBUF_STATE_CACHED:
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -1613,19 +1536,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (p, &p->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (p, bd, &p->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (p, bd, &p->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1634,7 +1557,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_partition *p,
+                                rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1651,7 +1575,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (p, bd, &p->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1660,26 +1584,27 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_partition *p)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&p->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (p, &p->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_sync_after_access (rtems_bdbuf_partition *p,
+                               rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&p->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&p->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_wait_for_sync_done (bd);
+  rtems_bdbuf_wait_for_sync_done (p, bd);
 
   /*
    * We may have created a cached or empty buffer which may be recycled.
@@ -1690,24 +1615,25 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
-      rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+      rtems_bdbuf_remove_from_hash_table (p, bd);
+      rtems_bdbuf_make_free_and_add_to_lru_list (p, bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
-                                       rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_partition *p,
+                                       rtems_disk_device     *dd,
+                                       rtems_blkdev_bnum      block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (p, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (p, dd, block);
 
     if (bd != NULL)
       rtems_bdbuf_group_obtain (bd);
@@ -1723,41 +1649,55 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
-                                   rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_partition *p,
+                                   rtems_disk_device     *dd,
+                                   rtems_blkdev_bnum      block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (p, dd, block);
 
     if (bd != NULL)
     {
       if (bd->group->bds_per_group != dd->bds_per_group)
       {
-        if (rtems_bdbuf_wait_for_recycle (bd))
+        if (rtems_bdbuf_wait_for_recycle (p, bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
-          rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_remove_from_hash_table_and_lru_list (p, bd);
+          rtems_bdbuf_make_free_and_add_to_lru_list (p, bd);
+          rtems_bdbuf_wake (&p->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (p, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (p);
     }
   }
   while (bd == NULL);
 
-  rtems_bdbuf_wait_for_access (bd);
+  rtems_bdbuf_wait_for_access (p, bd);
   rtems_bdbuf_group_obtain (bd);
 
+  /*
+   * Only the 2Q replacement policy promotes buffers, see
+   * rtems_bdbuf_is_on_probation().
+   */
+  if (bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_POLICY_2Q
+      && bd->accesses < 2)
+  {
+    ++bd->accesses;
+
+    if (bd->accesses == 2)
+      ++dd->stats.promotions;
+  }
+
   return bd;
 }
 
@@ -1790,11 +1730,12 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
                  rtems_blkdev_bnum    block,
                  rtems_bdbuf_buffer **bd_ptr)
 {
-  rtems_status_code   sc = RTEMS_SUCCESSFUL;
-  rtems_bdbuf_buffer *bd = NULL;
-  rtems_blkdev_bnum   media_block;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p = dd->cache_partition;
+  rtems_bdbuf_buffer    *bd = NULL;
+  rtems_blkdev_bnum      media_block;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_partition (p);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -1806,7 +1747,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (p, dd, media_block);
 
     switch (bd->state)
     {
@@ -1838,7 +1779,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
     }
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   *bd_ptr = bd;
 
@@ -1862,28 +1803,47 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
+/**
+ * Call back handler called by the low level driver when an asynchronous
+ * read-ahead transfer has completed. This function may be invoked from
+ * interrupt handler.
+ *
+ * @param req The read request of the read-ahead request.
+ * @param status I/O completion status
+ */
+static void
+rtems_bdbuf_read_ahead_done (rtems_blkdev_request *req,
+                             rtems_status_code     status)
+{
+  rtems_bdbuf_read_ahead_request *rar =
+    RTEMS_CONTAINER_OF (req, rtems_bdbuf_read_ahead_request, read_req);
+
+  req->status = status;
+
+  rtems_chain_append_with_notification (&bdbuf_cache.read_ahead_done,
+                                        &rar->link,
+                                        req->io_task,
+                                        RTEMS_BDBUF_READ_AHEAD_DONE);
+}
+
+/**
+ * Update the statistics and the buffers of a completed transfer request. The
+ * partition of the device must be locked.
+ *
+ * @param dd The device of the transfer request.
+ * @param req The completed transfer request.
+ * @return The completion status of the transfer request.
+ */
 static rtems_status_code
-rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
-                                      rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+rtems_bdbuf_finish_transfer_request (rtems_disk_device    *dd,
+                                     rtems_blkdev_request *req)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p = dd->cache_partition;
+  rtems_status_code sc = req->status;
   uint32_t transfer_index = 0;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
-
-  /* The return value will be ignored for transfer requests */
-  dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
-
-  /* Wait for transfer request completion */
-  rtems_bdbuf_wait_for_transient_event ();
-  sc = req->status;
-
-  rtems_bdbuf_lock_cache ();
-
   /* Statistics */
   if (req->req == RTEMS_BLKDEV_REQ_READ)
   {
@@ -1912,22 +1872,70 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     rtems_bdbuf_group_release (bd);
 
     if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
-      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+      rtems_bdbuf_make_cached_and_add_to_lru_list (p, bd);
     else
-      rtems_bdbuf_discard_buffer (bd);
+      rtems_bdbuf_discard_buffer (p, bd);
 
     if (rtems_bdbuf_tracer)
       rtems_bdbuf_show_users ("transfer", bd);
   }
 
   if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+    rtems_bdbuf_wake (&p->transfer_waiters);
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
 
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  return sc;
+}
+
+/**
+ * Execute the transfer request and wait for its completion.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param partition_locked If true, then the partition of the device is locked
+ * on entry and exit, otherwise it is unlocked.
+ * @param ra The read-ahead stream triggered by the read miss this request
+ * reads, otherwise NULL.  If the device has a queue depth greater than one,
+ * then the read-ahead of the stream starts after the submission of the
+ * request.
+ */
+static rtems_status_code
+rtems_bdbuf_execute_transfer_request (rtems_disk_device       *dd,
+                                      rtems_blkdev_request    *req,
+                                      bool                     partition_locked,
+                                      rtems_blkdev_read_ahead *ra)
+{
+  rtems_bdbuf_partition *p = dd->cache_partition;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+
+  if (partition_locked)
+    rtems_bdbuf_unlock_partition (p);
+
+  /* The return value will be ignored for transfer requests */
+  dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
+
+  /*
+   * The device reads the missed block in the background, so it can read ahead
+   * in the meantime.
+   */
+  if (ra != NULL && dd->phys_dev->queue_depth > 1)
+  {
+    rtems_bdbuf_lock_partition (p);
+    rtems_bdbuf_start_read_ahead_of_miss (ra);
+    rtems_bdbuf_unlock_partition (p);
+  }
+
+  /* Wait for transfer request completion */
+  rtems_bdbuf_wait_for_transient_event ();
+
+  rtems_bdbuf_lock_partition (p);
+
+  sc = rtems_bdbuf_finish_transfer_request (dd, req);
+
+  if (!partition_locked)
+    rtems_bdbuf_unlock_partition (p);
 
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
@@ -1935,27 +1943,23 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     return RTEMS_IO_ERROR;
 }
 
-static rtems_status_code
-rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
-                                  rtems_bdbuf_buffer *bd,
-                                  uint32_t            transfer_count)
+/**
+ * Fill in the buffers of a read request starting with the buffer. The
+ * following buffers are obtained for read-ahead up to the transfer count. The
+ * caller must set the done handler and the I/O task of the request.
+ */
+static void
+rtems_bdbuf_setup_read_request (rtems_disk_device    *dd,
+                                rtems_bdbuf_buffer   *bd,
+                                uint32_t              transfer_count,
+                                rtems_blkdev_request *req)
 {
-  rtems_blkdev_request *req = NULL;
   rtems_blkdev_bnum media_block = bd->block;
   uint32_t media_blocks_per_block = dd->media_blocks_per_block;
   uint32_t block_size = dd->block_size;
   uint32_t transfer_index = 1;
 
-  /*
-   * TODO: This type of request structure is wrong and should be removed.
-   */
-#define bdbuf_alloc(size) __builtin_alloca (size)
-
-  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
-
   req->req = RTEMS_BLKDEV_REQ_READ;
-  req->done = rtems_bdbuf_transfer_done;
-  req->io_task = rtems_task_self ();
   req->bufnum = 0;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
@@ -1972,7 +1976,8 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd->cache_partition, dd,
+                                                media_block);
 
     if (bd == NULL)
       break;
@@ -1987,69 +1992,210 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
     if (rtems_bdbuf_tracer)
       rtems_bdbuf_show_users ("read", bd);
 
-    ++transfer_index;
+    ++transfer_index;
+  }
+
+  req->bufnum = transfer_index;
+}
+
+static rtems_status_code
+rtems_bdbuf_execute_read_request (rtems_disk_device       *dd,
+                                  rtems_bdbuf_buffer      *bd,
+                                  uint32_t                 transfer_count,
+                                  rtems_blkdev_read_ahead *ra)
+{
+  rtems_blkdev_request *req = NULL;
+
+  /*
+   * TODO: This type of request structure is wrong and should be removed.
+   */
+#define bdbuf_alloc(size) __builtin_alloca (size)
+
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
+
+  req->done = rtems_bdbuf_transfer_done;
+  req->io_task = rtems_task_self ();
+
+  rtems_bdbuf_setup_read_request (dd, bd, transfer_count, req);
+
+  return rtems_bdbuf_execute_transfer_request (dd, req, true, ra);
+}
+
+static bool
+rtems_bdbuf_is_read_ahead_active (const rtems_blkdev_read_ahead *ra)
+{
+  return !rtems_chain_is_node_off_chain (&ra->node);
+}
+
+static void
+rtems_bdbuf_read_ahead_cancel (rtems_blkdev_read_ahead *ra)
+{
+  if (rtems_bdbuf_is_read_ahead_active (ra))
+  {
+    rtems_chain_extract_unprotected (&ra->node);
+    rtems_chain_set_off_chain (&ra->node);
   }
+}
 
-  req->bufnum = transfer_index;
+static void
+rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead *ra = &dd->read_ahead [i];
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+    rtems_bdbuf_read_ahead_cancel (ra);
+    ra->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    ra->window_begin = ra->next;
+  }
 }
 
-static bool
-rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
+static void
+rtems_bdbuf_read_ahead_touch (rtems_blkdev_read_ahead *ra)
 {
-  return !rtems_chain_is_node_off_chain (&dd->read_ahead.node);
+  ra->stamp = ++ra->dd->cache_partition->read_ahead_stamp;
 }
 
-static void
-rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
+static rtems_blkdev_read_ahead *
+rtems_bdbuf_find_read_ahead_stream (rtems_disk_device *dd,
+                                    rtems_blkdev_bnum  block)
 {
-  if (rtems_bdbuf_is_read_ahead_active (dd))
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
   {
-    rtems_chain_extract_unprotected (&dd->read_ahead.node);
-    rtems_chain_set_off_chain (&dd->read_ahead.node);
+    rtems_blkdev_read_ahead *ra = &dd->read_ahead [i];
+
+    if (ra->trigger == block)
+      return ra;
   }
+
+  return NULL;
 }
 
 static void
-rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
+rtems_bdbuf_queue_read_ahead (rtems_blkdev_read_ahead *ra)
 {
-  rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  rtems_chain_control *chain = &ra->dd->cache_partition->read_ahead_chain;
+
+  rtems_bdbuf_read_ahead_touch (ra);
+
+  if (rtems_chain_is_empty (chain))
+  {
+    rtems_status_code sc = rtems_event_send (bdbuf_cache.read_ahead_task,
+                                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+    if (sc != RTEMS_SUCCESSFUL)
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+  }
+
+  rtems_chain_append_unprotected (chain, &ra->node);
 }
 
 static void
 rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
-  {
-    rtems_status_code sc;
-    rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_blkdev_read_ahead *ra;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  ra = rtems_bdbuf_find_read_ahead_stream (dd, block);
 
-    if (rtems_chain_is_empty (chain))
+  if (ra != NULL && !rtems_bdbuf_is_read_ahead_active (ra))
+  {
+    /*
+     * The stream consumed the blocks of the previous read-ahead request, so
+     * enlarge the window.  A trigger set by a read miss follows no read-ahead
+     * request, so a shrunk window stays as it is.
+     */
+    if (ra->window_begin != ra->next)
     {
-      sc = rtems_event_send (bdbuf_cache.read_ahead_task,
-                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-      if (sc != RTEMS_SUCCESSFUL)
-        rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+      if (ra->window < bdbuf_config.max_read_ahead_blocks / 2)
+        ra->window *= 2;
+      else
+        ra->window = bdbuf_config.max_read_ahead_blocks;
     }
 
-    rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+    rtems_bdbuf_queue_read_ahead (ra);
   }
 }
 
-static void
+/**
+ * Set the read-ahead trigger for a read miss of the block.
+ *
+ * @return The stream which got a new trigger, otherwise NULL if the block is
+ * the trigger of a stream.
+ */
+static rtems_blkdev_read_ahead *
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
-  if (dd->read_ahead.trigger != block)
+  rtems_blkdev_read_ahead *ra;
+  size_t                   i;
+
+  ra = rtems_bdbuf_find_read_ahead_stream (dd, block);
+
+  if (ra != NULL)
+  {
+    rtems_bdbuf_read_ahead_touch (ra);
+    return NULL;
+  }
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead *other = &dd->read_ahead [i];
+
+    if (other->window_begin <= block && block < other->next)
+    {
+      /*
+       * The read-ahead blocks of this stream were recycled before they were
+       * used, so shrink the window.
+       */
+      ra = other;
+
+      if (ra->window > 1)
+        ra->window /= 2;
+
+      break;
+    }
+
+    if (ra == NULL || (int32_t) (other->stamp - ra->stamp) < 0)
+      ra = other;
+  }
+
+  if (i == RTEMS_DISK_READ_AHEAD_STREAMS)
+    ra->window = bdbuf_config.max_read_ahead_blocks;
+
+  rtems_bdbuf_read_ahead_cancel (ra);
+  ra->trigger = block + 1;
+  ra->next = block + 2;
+  ra->window_begin = ra->next;
+  rtems_bdbuf_read_ahead_touch (ra);
+
+  return ra;
+}
+
+/**
+ * Start the read-ahead of a stream triggered by a read miss right away.  The
+ * read-ahead window begins with the trigger block after the missed block.
+ * Nothing happens if the stream was started or reset in the meantime.  The
+ * partition of the device must be locked.
+ */
+static void
+rtems_bdbuf_start_read_ahead_of_miss (rtems_blkdev_read_ahead *ra)
+{
+  if (bdbuf_cache.read_ahead_task != 0
+      && !rtems_bdbuf_is_read_ahead_active (ra)
+      && ra->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+      && ra->window_begin == ra->next
+      && ra->trigger + 1 == ra->next)
   {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+    ra->next = ra->trigger;
+    ra->window_begin = ra->next;
+    rtems_bdbuf_queue_read_ahead (ra);
   }
 }
 
@@ -2058,11 +2204,13 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
                   rtems_blkdev_bnum    block,
                   rtems_bdbuf_buffer **bd_ptr)
 {
-  rtems_status_code     sc = RTEMS_SUCCESSFUL;
-  rtems_bdbuf_buffer   *bd = NULL;
-  rtems_blkdev_bnum     media_block;
+  rtems_status_code        sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition   *p = dd->cache_partition;
+  rtems_bdbuf_buffer      *bd = NULL;
+  rtems_blkdev_read_ahead *ra;
+  rtems_blkdev_bnum        media_block;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_partition (p);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -2071,7 +2219,7 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (p, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
@@ -2084,12 +2232,12 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
         ++dd->stats.read_misses;
-        rtems_bdbuf_set_read_ahead_trigger (dd, block);
-        sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
+        ra = rtems_bdbuf_set_read_ahead_trigger (dd, block);
+        sc = rtems_bdbuf_execute_read_request (dd, bd, 1, ra);
         if (sc == RTEMS_SUCCESSFUL)
         {
+          rtems_bdbuf_extract_from_list (p, bd);
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
-          rtems_chain_extract_unprotected (&bd->link);
           rtems_bdbuf_group_obtain (bd);
         }
         else
@@ -2105,7 +2253,7 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
     rtems_bdbuf_check_read_ahead_trigger (dd, block);
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   *bd_ptr = bd;
 
@@ -2113,7 +2261,8 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_partition (rtems_bdbuf_buffer *bd,
+                                         const char         *kind)
 {
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
@@ -2122,7 +2271,7 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_partition (bd->dd->cache_partition);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2130,23 +2279,26 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
 rtems_status_code
 rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "release");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
+  p = bd->dd->cache_partition;
+
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-      rtems_bdbuf_add_to_lru_list_after_access (bd);
+      rtems_bdbuf_add_to_lru_list_after_access (p, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (p, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (p, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_0);
@@ -2156,7 +2308,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2164,21 +2316,24 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "release modified");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
+  p = bd->dd->cache_partition;
+
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (p, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (p, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_6);
@@ -2188,7 +2343,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2196,21 +2351,24 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "sync");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
+  p = bd->dd->cache_partition;
+
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      rtems_bdbuf_sync_after_access (p, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (p, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_5);
@@ -2220,7 +2378,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2228,31 +2386,34 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_syncdev (rtems_disk_device *dd)
 {
+  rtems_bdbuf_partition *p = dd->cache_partition;
+
   if (rtems_bdbuf_tracer)
     printf ("bdbuf:syncdev: %08x\n", (unsigned) dd->dev);
 
   /*
-   * Take the sync lock before locking the cache. Once we have the sync lock we
-   * can lock the cache. If another thread has the sync lock it will cause this
-   * thread to block until it owns the sync lock then it can own the cache. The
-   * sync lock can only be obtained with the cache unlocked.
+   * Take the sync lock before locking the partition. Once we have the sync
+   * lock we can lock the partition. If another thread has the sync lock it
+   * will cause this thread to block until it owns the sync lock then it can
+   * own the partition. The sync lock can only be obtained with the partition
+   * unlocked.
    */
   rtems_bdbuf_lock_sync ();
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_partition (p);
 
   /*
-   * Set the cache to have a sync active for a specific device and let the swap
-   * out task know the id of the requester to wake when done.
+   * Set the partition to have a sync active for a specific device and let the
+   * swap out task know the id of the requester to wake when done.
    *
    * The swap out task will negate the sync active flag when no more buffers
    * for the device are held on the "modified for sync" queues.
    */
-  bdbuf_cache.sync_active    = true;
-  bdbuf_cache.sync_requester = rtems_task_self ();
-  bdbuf_cache.sync_device    = dd;
+  p->sync_active    = true;
+  p->sync_requester = rtems_task_self ();
+  p->sync_device    = dd;
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
   rtems_bdbuf_wait_for_transient_event ();
   rtems_bdbuf_unlock_sync ();
 
@@ -2348,7 +2509,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false,
+                                              NULL);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2372,6 +2534,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param p The partition of the modified list.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2383,12 +2546,13 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
-                                         rtems_chain_control* chain,
-                                         rtems_chain_control* transfer,
-                                         bool                 sync_active,
-                                         bool                 update_timers,
-                                         uint32_t             timer_delta)
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_partition* p,
+                                         rtems_disk_device    **dd_ptr,
+                                         rtems_chain_control*   chain,
+                                         rtems_chain_control*   transfer,
+                                         bool                   sync_active,
+                                         bool                   update_timers,
+                                         uint32_t               timer_delta)
 {
   if (!rtems_chain_is_empty (chain))
   {
@@ -2417,7 +2581,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (p))
         bd->hold_timer = 0;
 
       if (bd->hold_timer)
@@ -2490,13 +2654,162 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
 }
 
 /**
- * Process the cache's modified buffers. Check the sync list first then the
- * modified list extracting the buffers suitable to be written to disk. We have
- * a device at a time. The task level loop will repeat this operation while
- * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * Take the modified buffer of the device and block for the transfer if it
+ * exists and is aged. A buffer is aged if it waited for at least one half of
+ * the hold time. Younger buffers stay on the modified list, so that
+ * successive modifications of a block still coalesce.
+ *
+ * @param p The partition of the device.
+ * @param dd The device.
+ * @param block The media block.
+ * @return The buffer in TRANSFER state or NULL.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_swapout_take_modified (rtems_bdbuf_partition *p,
+                                   rtems_disk_device     *dd,
+                                   rtems_blkdev_bnum      block)
+{
+  rtems_bdbuf_buffer *bd = rtems_bdbuf_hash_search (p, dd, block);
+
+  if (bd == NULL || bd->state != RTEMS_BDBUF_STATE_MODIFIED
+      || bd->hold_timer > bdbuf_config.swap_block_hold / 2)
+    return NULL;
+
+  rtems_chain_extract_unprotected (&bd->link);
+  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+
+  return bd;
+}
+
+/**
+ * Merge aged modified buffers which are adjacent to the runs of consecutive
+ * blocks on the transfer list into the transfer. The hold timer of these
+ * buffers has not expired yet, however, writing them together with their
+ * neighbours costs almost nothing compared to a separate transfer later. A run
+ * grows up to the maximum count of blocks per write request or until a
+ * neighbour is missing or too young. The transfer list stays sorted in block
+ * order.
+ *
+ * @param p The partition of the device.
+ * @param dd The device of the transfer.
+ * @param transfer The sorted transfer list.
+ */
+static void
+rtems_bdbuf_swapout_merge_adjacent (rtems_bdbuf_partition *p,
+                                    rtems_disk_device     *dd,
+                                    rtems_chain_control   *transfer)
+{
+  uint32_t          media_blocks_per_block = dd->media_blocks_per_block;
+  uint32_t          max_run = bdbuf_config.max_write_blocks;
+  rtems_chain_node* node = rtems_chain_first (transfer);
+
+  while (!rtems_chain_is_tail (transfer, node))
+  {
+    rtems_bdbuf_buffer* first = (rtems_bdbuf_buffer*) node;
+    rtems_bdbuf_buffer* last = first;
+    rtems_bdbuf_buffer* bd;
+    uint32_t            run = 1;
+
+    /*
+     * Find the end of the run already on the transfer list.
+     */
+    node = rtems_chain_next (node);
+    while (!rtems_chain_is_tail (transfer, node)
+           && ((rtems_bdbuf_buffer*) node)->block
+                == last->block + media_blocks_per_block)
+    {
+      last = (rtems_bdbuf_buffer*) node;
+      ++run;
+      node = rtems_chain_next (node);
+    }
+
+    while (run < max_run && first->block >= media_blocks_per_block
+           && (bd = rtems_bdbuf_swapout_take_modified (
+                      p, dd, first->block - media_blocks_per_block)) != NULL)
+    {
+      rtems_chain_insert_unprotected (rtems_chain_previous (&first->link),
+                                      &bd->link);
+      first = bd;
+      ++run;
+    }
+
+    while (run < max_run
+           && (bd = rtems_bdbuf_swapout_take_modified (
+                      p, dd, last->block + media_blocks_per_block)) != NULL)
+    {
+      rtems_chain_insert_unprotected (&last->link, &bd->link);
+      last = bd;
+      ++run;
+    }
+  }
+}
+
+/**
+ * Spread the transfer of a swapout worker over free workers. Each additional
+ * worker takes the buffers after the first maximum count of blocks per write
+ * request from the previous worker. The count of workers is limited by the
+ * queue depth of the device. The partition of the device and the cache must
+ * be locked.
+ *
+ * @param busy_workers The chain of workers to wake up. The first worker on
+ * this chain holds the transfer to spread.
+ */
+static void
+rtems_bdbuf_swapout_spread (rtems_chain_control *busy_workers)
+{
+  rtems_bdbuf_swapout_worker* worker =
+    (rtems_bdbuf_swapout_worker*) rtems_chain_first (busy_workers);
+  uint32_t queue_depth = worker->transfer.dd->phys_dev->queue_depth;
+  uint32_t worker_count = 1;
+
+  while (worker_count < queue_depth
+         && !rtems_chain_is_empty (&bdbuf_cache.swapout_free_workers))
+  {
+    rtems_chain_control*        bds = &worker->transfer.bds;
+    rtems_chain_node*           node = rtems_chain_first (bds);
+    rtems_bdbuf_swapout_worker* next_worker;
+    uint32_t                    count = 0;
+
+    while (count < bdbuf_config.max_write_blocks
+           && !rtems_chain_is_tail (bds, node))
+    {
+      node = rtems_chain_next (node);
+      ++count;
+    }
+
+    if (rtems_chain_is_tail (bds, node))
+      break;
+
+    next_worker = (rtems_bdbuf_swapout_worker*)
+      rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+    rtems_chain_initialize_empty (&next_worker->transfer.bds);
+    next_worker->transfer.dd = worker->transfer.dd;
+    next_worker->transfer.syncing = false;
+
+    while (!rtems_chain_is_tail (bds, node))
+    {
+      rtems_chain_node* next_node = rtems_chain_next (node);
+
+      rtems_chain_extract_unprotected (node);
+      rtems_chain_append_unprotected (&next_worker->transfer.bds, node);
+      node = next_node;
+    }
+
+    rtems_chain_append_unprotected (busy_workers, &next_worker->link);
+    worker = next_worker;
+    ++worker_count;
+  }
+}
+
+/**
+ * Process the modified buffers of a partition. Check the sync list first then
+ * the modified list extracting the buffers suitable to be written to disk. We
+ * have a device at a time. The task level loop will repeat this operation
+ * while there are buffers to be written. If the transfer fails place the
+ * buffers back on the modified list and try again later. The partition is
+ * unlocked while the buffers are being written to disk.
  *
+ * @param p The partition.
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
  * @param update_timers If true update the timers.
@@ -2506,20 +2819,22 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
  * @retval false No buffers where written to disk.
  */
 static bool
-rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
+rtems_bdbuf_swapout_processing (rtems_bdbuf_partition*        p,
+                                unsigned long                 timer_delta,
                                 bool                          update_timers,
                                 rtems_bdbuf_swapout_transfer* transfer)
 {
   rtems_bdbuf_swapout_worker* worker;
+  rtems_chain_control         busy_workers;
   bool                        transfered_buffers = false;
   bool                        sync_active;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_partition (p);
 
   /*
-   * To set this to true you need the cache and the sync lock.
+   * To set this to true you need the partition and the sync lock.
    */
-  sync_active = bdbuf_cache.sync_active;
+  sync_active = p->sync_active;
 
   /*
    * If a sync is active do not use a worker because the current code does not
@@ -2534,8 +2849,10 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
     worker = NULL;
   else
   {
+    rtems_bdbuf_lock_cache ();
     worker = (rtems_bdbuf_swapout_worker*)
       rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+    rtems_bdbuf_unlock_cache ();
     if (worker)
       transfer = &worker->transfer;
   }
@@ -2550,34 +2867,59 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
    * list. This means the dev is BDBUF_INVALID_DEV.
    */
   if (sync_active)
-    transfer->dd = bdbuf_cache.sync_device;
+    transfer->dd = p->sync_device;
 
   /*
    * If we have any buffers in the sync queue move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
+  rtems_bdbuf_swapout_modified_processing (p, &transfer->dd,
+                                           &p->sync,
                                            &transfer->bds,
                                            true, false,
                                            timer_delta);
 
   /*
-   * Process the cache's modified list.
+   * Process the partition's modified list.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
+  rtems_bdbuf_swapout_modified_processing (p, &transfer->dd,
+                                           &p->modified,
                                            &transfer->bds,
                                            sync_active,
                                            update_timers,
                                            timer_delta);
 
+  rtems_chain_initialize_empty (&busy_workers);
+
+  if (!rtems_chain_is_empty (&transfer->bds))
+  {
+    rtems_bdbuf_swapout_merge_adjacent (p, transfer->dd, &transfer->bds);
+
+    if (worker)
+    {
+      rtems_chain_append_unprotected (&busy_workers, &worker->link);
+      rtems_bdbuf_lock_cache ();
+      rtems_bdbuf_swapout_spread (&busy_workers);
+      rtems_bdbuf_unlock_cache ();
+    }
+  }
+  else if (worker)
+  {
+    /*
+     * Nothing to write, so give the worker back.
+     */
+    rtems_bdbuf_lock_cache ();
+    rtems_chain_prepend_unprotected (&bdbuf_cache.swapout_free_workers,
+                                     &worker->link);
+    rtems_bdbuf_unlock_cache ();
+  }
+
   /*
    * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
+   * partition can be unlocked because the state of each buffer has been set
+   * to TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2586,10 +2928,17 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   {
     if (worker)
     {
-      rtems_status_code sc = rtems_event_send (worker->id,
-                                               RTEMS_BDBUF_SWAPOUT_SYNC);
-      if (sc != RTEMS_SUCCESSFUL)
-        rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_SO_WAKE_2);
+      rtems_chain_node* node;
+
+      while ((node = rtems_chain_get_unprotected (&busy_workers)) != NULL)
+      {
+        rtems_bdbuf_swapout_worker* busy_worker =
+          (rtems_bdbuf_swapout_worker*) node;
+        rtems_status_code sc = rtems_event_send (busy_worker->id,
+                                                 RTEMS_BDBUF_SWAPOUT_SYNC);
+        if (sc != RTEMS_SUCCESSFUL)
+          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_SO_WAKE_2);
+      }
     }
     else
     {
@@ -2602,11 +2951,11 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   if (sync_active && !transfered_buffers)
   {
     rtems_id sync_requester;
-    rtems_bdbuf_lock_cache ();
-    sync_requester = bdbuf_cache.sync_requester;
-    bdbuf_cache.sync_active = false;
-    bdbuf_cache.sync_requester = 0;
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_lock_partition (p);
+    sync_requester = p->sync_requester;
+    p->sync_active = false;
+    p->sync_requester = 0;
+    rtems_bdbuf_unlock_partition (p);
     if (sync_requester)
       rtems_event_transient_send (sync_requester);
   }
@@ -2705,25 +3054,31 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 
     /*
      * If we write buffers to any disk perform a check again. We only write a
-     * single device at a time and the cache may have more than one device's
-     * buffers modified waiting to be written.
+     * single device per partition at a time and a partition may have more
+     * than one device's buffers modified waiting to be written.
      */
     bool transfered_buffers;
 
     do
     {
+      size_t i;
+
       transfered_buffers = false;
 
       /*
-       * Extact all the buffers we find for a specific device. The device is
-       * the first one we find on a modified list. Process the sync queue of
-       * buffers first.
+       * Extact all the buffers we find for a specific device of each
+       * partition. The device is the first one we find on a modified list.
+       * Process the sync queue of buffers first.
        */
-      if (rtems_bdbuf_swapout_processing (timer_delta,
-                                          update_timers,
-                                          transfer))
+      for (i = 0; i < bdbuf_cache.partition_count; ++i)
       {
-        transfered_buffers = true;
+        if (rtems_bdbuf_swapout_processing (&bdbuf_cache.partitions[i],
+                                            timer_delta,
+                                            update_timers,
+                                            transfer))
+        {
+          transfered_buffers = true;
+        }
       }
 
       /*
@@ -2750,7 +3105,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_partition *p,
+                        rtems_chain_control   *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -2762,107 +3118,105 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
     if (bd->waiters == 0)
       wake_buffer_waiters = true;
 
-    rtems_bdbuf_discard_buffer (bd);
+    rtems_bdbuf_discard_buffer (p, bd);
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&p->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_partition   *p,
+                              rtems_chain_control     *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  size_t b;
 
-  *prev = NULL;
-
-  while (cur != NULL)
+  for (b = 0; b <= p->hash_mask; ++b)
   {
-    if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+    rtems_bdbuf_buffer *cur = p->hash_table[b];
 
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
+    while (cur != NULL)
     {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
+      if (cur->dd == dd)
       {
-        /* Up */
-        cur = *prev;
-        --prev;
+        switch (cur->state)
+        {
+          case RTEMS_BDBUF_STATE_FREE:
+          case RTEMS_BDBUF_STATE_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+          case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+            break;
+          case RTEMS_BDBUF_STATE_SYNC:
+            rtems_bdbuf_wake (&p->transfer_waiters);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_MODIFIED:
+            rtems_bdbuf_group_release (cur);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_CACHED:
+            rtems_bdbuf_extract_from_list (p, cur);
+            rtems_chain_append_unprotected (purge_list, &cur->link);
+            break;
+          case RTEMS_BDBUF_STATE_TRANSFER:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+            break;
+          case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+          case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+            break;
+          default:
+            rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+        }
       }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
+
+      cur = cur->hash_next;
     }
   }
 }
 
 static void
-rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
+rtems_bdbuf_do_purge_dev (rtems_bdbuf_partition *p, rtems_disk_device *dd)
 {
   rtems_chain_control purge_list;
 
   rtems_chain_initialize_empty (&purge_list);
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+  rtems_bdbuf_gather_for_purge (p, &purge_list, dd);
+  rtems_bdbuf_purge_list (p, &purge_list);
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
-  rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_partition *p = dd->cache_partition;
+
+  rtems_bdbuf_lock_partition (p);
+  rtems_bdbuf_do_purge_dev (p, dd);
+  rtems_bdbuf_unlock_partition (p);
+}
+
+/**
+ * Returns the partition of the disk device. The first call for a disk device
+ * assigns the partitions to the disk devices in a round-robin order.
+ */
+static rtems_bdbuf_partition *
+rtems_bdbuf_get_partition (rtems_disk_device *dd)
+{
+  rtems_bdbuf_partition *p = dd->cache_partition;
+
+  if (p == NULL)
+  {
+    rtems_bdbuf_lock_cache ();
+    p = &bdbuf_cache.partitions[bdbuf_cache.next_partition];
+    bdbuf_cache.next_partition =
+      (bdbuf_cache.next_partition + 1) % bdbuf_cache.partition_count;
+    rtems_bdbuf_unlock_cache ();
+
+    dd->cache_partition = p;
+  }
+
+  return p;
 }
 
 rtems_status_code
@@ -2870,7 +3224,8 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
                             uint32_t           block_size,
                             bool               sync)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code      sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *p = rtems_bdbuf_get_partition (dd);
 
   /*
    * We do not care about the synchronization status since we will purge the
@@ -2879,7 +3234,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_partition (p);
 
   if (block_size > 0)
   {
@@ -2905,7 +3260,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
       dd->block_to_media_block_shift = block_to_media_block_shift;
       dd->bds_per_group = bds_per_group;
 
-      rtems_bdbuf_do_purge_dev (dd);
+      rtems_bdbuf_do_purge_dev (p, dd);
     }
     else
     {
@@ -2917,66 +3272,144 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 
   return sc;
 }
 
+/**
+ * Prepare the read request for the read-ahead stream and append it to the
+ * submit chain. The partition of the device must be locked and a free
+ * read-ahead request must be available.
+ */
+static void
+rtems_bdbuf_prepare_read_ahead (rtems_blkdev_read_ahead *ra,
+                                rtems_chain_control     *submit)
+{
+  rtems_disk_device *dd = ra->dd;
+  rtems_blkdev_bnum block = ra->next;
+  rtems_blkdev_bnum media_block = 0;
+  rtems_status_code sc =
+    rtems_bdbuf_get_media_block (dd, block, &media_block);
+
+  if (sc == RTEMS_SUCCESSFUL)
+  {
+    rtems_bdbuf_buffer *bd =
+      rtems_bdbuf_get_buffer_for_read_ahead (dd->cache_partition, dd,
+                                             media_block);
+
+    if (bd != NULL)
+    {
+      uint32_t transfer_count = dd->block_count - block;
+      uint32_t max_transfer_count = ra->window;
+      rtems_bdbuf_read_ahead_request *rar;
+
+      if (transfer_count >= max_transfer_count)
+      {
+        transfer_count = max_transfer_count;
+        ra->trigger = block + transfer_count / 2;
+        ra->next = block + transfer_count;
+      }
+      else
+      {
+        ra->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+      }
+
+      ra->window_begin = block;
+      ++dd->stats.read_ahead_transfers;
+
+      rar = (rtems_bdbuf_read_ahead_request *)
+        rtems_chain_get_unprotected (&bdbuf_cache.read_ahead_free);
+      rar->dd = dd;
+      rtems_bdbuf_setup_read_request (dd, bd, transfer_count, &rar->read_req);
+
+      ++dd->phys_dev->read_ahead_in_flight;
+      rtems_chain_append_unprotected (submit, &rar->link);
+    }
+  }
+  else
+  {
+    ra->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
+}
+
 static rtems_task
 rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 {
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
-
   while (bdbuf_cache.read_ahead_enabled)
   {
+    rtems_chain_control submit;
     rtems_chain_node *node;
+    size_t i;
 
-    rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_wait_for_any_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP
+                                    | RTEMS_BDBUF_READ_AHEAD_DONE);
+    rtems_chain_initialize_empty (&submit);
 
-    while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+    /*
+     * Finish the completed requests first, this makes room in the device
+     * queues for the pending read-ahead streams.  Only this task uses the
+     * free requests and the in flight counters.
+     */
+    while ((node = rtems_chain_get (&bdbuf_cache.read_ahead_done)) != NULL)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      rtems_bdbuf_read_ahead_request *rar =
+        (rtems_bdbuf_read_ahead_request *) node;
+      rtems_disk_device *dd = rar->dd;
+      rtems_bdbuf_partition *p = dd->cache_partition;
+
+      --dd->phys_dev->read_ahead_in_flight;
+      rtems_bdbuf_lock_partition (p);
+      rtems_bdbuf_finish_transfer_request (dd, &rar->read_req);
+      rtems_bdbuf_unlock_partition (p);
+      rtems_chain_append_unprotected (&bdbuf_cache.read_ahead_free, node);
+    }
 
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+    for (i = 0;
+         i < bdbuf_cache.partition_count
+           && !rtems_chain_is_empty (&bdbuf_cache.read_ahead_free);
+         ++i)
+    {
+      rtems_bdbuf_partition *p = &bdbuf_cache.partitions[i];
+      rtems_chain_control *chain = &p->read_ahead_chain;
 
-      if (sc == RTEMS_SUCCESSFUL)
-      {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+      rtems_bdbuf_lock_partition (p);
 
-        if (bd != NULL)
-        {
-          uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+      /*
+       * Streams of devices with a full queue stay on the chain. They are
+       * submitted once a request of their device completed.
+       */
+      node = rtems_chain_first (chain);
 
-          if (transfer_count >= max_transfer_count)
-          {
-            transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
-          }
-          else
-          {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-          }
+      while (!rtems_chain_is_tail (chain, node)
+             && !rtems_chain_is_empty (&bdbuf_cache.read_ahead_free))
+      {
+        rtems_blkdev_read_ahead *ra =
+          RTEMS_CONTAINER_OF (node, rtems_blkdev_read_ahead, node);
+        rtems_disk_device *phys_dd = ra->dd->phys_dev;
 
-          ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
+        node = rtems_chain_next (node);
+
+        if (phys_dd->read_ahead_in_flight < phys_dd->queue_depth)
+        {
+          rtems_chain_extract_unprotected (&ra->node);
+          rtems_chain_set_off_chain (&ra->node);
+          rtems_bdbuf_prepare_read_ahead (ra, &submit);
         }
       }
-      else
-      {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-      }
+
+      rtems_bdbuf_unlock_partition (p);
     }
 
-    rtems_bdbuf_unlock_cache ();
+    while ((node = rtems_chain_get_unprotected (&submit)) != NULL)
+    {
+      rtems_bdbuf_read_ahead_request *rar =
+        (rtems_bdbuf_read_ahead_request *) node;
+      rtems_disk_device *dd = rar->dd;
+
+      /* The return value will be ignored for transfer requests */
+      dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, &rar->read_req);
+    }
   }
 
   rtems_task_exit();
@@ -2985,14 +3418,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_partition *p = dd->cache_partition;
+
+  rtems_bdbuf_lock_partition (p);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_partition *p = dd->cache_partition;
+
+  rtems_bdbuf_lock_partition (p);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (p);
 }
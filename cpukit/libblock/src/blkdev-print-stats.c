@@ -52,6 +52,8 @@ void rtems_blkdev_print_stats(
      " WRITE TRANSFERS      | %" PRIu32 "\n"
      " WRITE BLOCKS         | %" PRIu32 "\n"
      " WRITE ERRORS         | %" PRIu32 "\n"
+     " EVICTIONS            | %" PRIu32 "\n"
+     " PROMOTIONS           | %" PRIu32 "\n"
      "----------------------+--------------------------------------------------------\n",
      media_block_size,
      media_block_count,
@@ -63,6 +65,8 @@ void rtems_blkdev_print_stats(
      stats->read_errors,
      stats->write_transfers,
      stats->write_blocks,
-     stats->write_errors
+     stats->write_errors,
+     stats->evictions,
+     stats->promotions
   );
 }
@@ -127,6 +127,14 @@ ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             }
             break;
 
+        case RTEMS_BLKIO_GETQUEUEDEPTH:
+            /*
+             * Requests are processed in the context of the caller, so at
+             * most one request per processor is in progress.
+             */
+            *(uint32_t *) argp = rtems_scheduler_get_processor_maximum();
+            return 0;
+
         default:
             return rtems_blkdev_ioctl (dd, req, argp);
             break;
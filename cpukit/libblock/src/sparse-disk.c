@@ -283,6 +283,14 @@ static int sparse_disk_ioctl( rtems_disk_device *dd, uint32_t req, void *argp )
       default:
         break;
     }
+  } else if ( RTEMS_BLKIO_GETQUEUEDEPTH == req ) {
+    /*
+     * Requests are processed in the context of the caller and serialized by
+     * the mutex of the sparse disk, so only one request is in progress.
+     */
+    *(uint32_t *) argp = 1;
+
+    return 0;
   } else if ( RTEMS_BLKIO_DELETED == req ) {
     rtems_mutex_destroy( &sd->mutex );
 
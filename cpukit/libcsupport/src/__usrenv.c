@@ -254,7 +254,7 @@ rtems_user_env_t rtems_global_user_env = {
 rtems_user_env_t *rtems_current_user_env_get(void)
 {
   Thread_Control *executing = _Thread_Get_executing();
-  rtems_user_env_t *env = executing->user_environment;
+  rtems_user_env_t *env = executing->Cold->user_environment;
 
   if (env == NULL) {
     return &rtems_global_user_env;
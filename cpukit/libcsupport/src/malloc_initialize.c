@@ -54,7 +54,7 @@ void RTEMS_Malloc_Initialize(
 
     heap = &_Malloc_Heap;
     RTEMS_Malloc_Heap = heap;
-    init_or_extend = _Heap_Initialize;
+    init_or_extend = _Workspace_Heap_initialize;
     page_size = CPU_HEAP_ALIGNMENT;
 
     for (i = 0; i < _Memory_Get_count( mem ); ++i) {
@@ -75,7 +75,7 @@ void RTEMS_Malloc_Initialize(
       }
     }
 
-    if ( init_or_extend == _Heap_Initialize ) {
+    if ( init_or_extend == _Workspace_Heap_initialize ) {
       _Internal_error( INTERNAL_ERROR_NO_MEMORY_FOR_HEAP );
     }
   }
@@ -29,6 +29,17 @@ void _Malloc_Deferred_free( void * );
 
 void _Malloc_Process_deferred_frees( void );
 
+void *_Malloc_Cache_allocate( size_t size );
+
+bool _Malloc_Cache_free( void *ptr );
+
+bool _Malloc_Cache_size_of_alloc_area( void *ptr, uintptr_t *alloc_size );
+
+static inline bool _Malloc_Cache_is_enabled( void )
+{
+  return _Malloc_Cache_configuration.magazine_size != 0;
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,556 @@
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief Per-Processor malloc() Cache
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "malloc_p.h"
+
+#include <string.h>
+
+#include <rtems/score/assert.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+
+/*
+ * Each block obtained from the cache is preceded by a prefix of one heap page.
+ * The last word of the prefix contains a tag.  The tag identifies the block
+ * as a block of the cache, it encodes the size class and it indicates if the
+ * block is currently held by a cache.  The tag has the marker bit set.  For
+ * all other blocks of the heap, the word before a page aligned allocation area
+ * is the size and flag field of the heap block.  Since the block sizes are
+ * multiples of the page size, this field never has the marker bit set.  So,
+ * free() identifies the blocks of the cache without the allocator lock and
+ * without a search through the magazines.
+ */
+#define MALLOC_CACHE_TAG_CACHED ( (uintptr_t) 0x1 )
+
+#define MALLOC_CACHE_TAG_MARKER ( (uintptr_t) 0x2 )
+
+#define MALLOC_CACHE_TAG_CLASS_SHIFT 2
+
+#define MALLOC_CACHE_TAG_CLASS_MASK ( (uintptr_t) 0x1c )
+
+#define MALLOC_CACHE_TAG_CHECK ( (uintptr_t) 0x6d616c63UL )
+
+RTEMS_STATIC_ASSERT(
+  CPU_ALIGNMENT % ( 2 * MALLOC_CACHE_TAG_MARKER ) == 0,
+  MALLOC_CACHE_TAG_MARKER
+);
+
+RTEMS_STATIC_ASSERT(
+  ( ( RTEMS_MALLOC_CACHE_CLASS_COUNT - 1 ) << MALLOC_CACHE_TAG_CLASS_SHIFT )
+    <= MALLOC_CACHE_TAG_CLASS_MASK,
+  MALLOC_CACHE_TAG_CLASS_MASK
+);
+
+static size_t _Malloc_Cache_class_size( size_t index )
+{
+  return (size_t) RTEMS_MALLOC_CACHE_MINIMUM_SIZE << index;
+}
+
+static size_t _Malloc_Cache_alloc_class( size_t size )
+{
+  size_t index;
+
+  index = 0;
+
+  while ( _Malloc_Cache_class_size( index ) < size ) {
+    ++index;
+  }
+
+  return index;
+}
+
+static Malloc_Cache *_Malloc_Cache_get( void )
+{
+  _Assert( _ISR_Get_level() != 0 );
+
+  return &_Malloc_Cache_configuration.caches[
+    _Per_CPU_Get_index( _Per_CPU_Get() )
+  ];
+}
+
+static uintptr_t _Malloc_Cache_make_tag( const void *block, size_t index )
+{
+  return ( ( (uintptr_t) block ^ MALLOC_CACHE_TAG_CHECK )
+    & ~( MALLOC_CACHE_TAG_CLASS_MASK | MALLOC_CACHE_TAG_MARKER
+      | MALLOC_CACHE_TAG_CACHED ) )
+    | ( (uintptr_t) index << MALLOC_CACHE_TAG_CLASS_SHIFT )
+    | MALLOC_CACHE_TAG_MARKER;
+}
+
+static Atomic_Uintptr *_Malloc_Cache_tag( void *block )
+{
+  return (Atomic_Uintptr *) block - 1;
+}
+
+static void _Malloc_Cache_set_tag( void *block, uintptr_t tag )
+{
+  _Atomic_Store_uintptr( _Malloc_Cache_tag( block ), tag, ATOMIC_ORDER_RELAXED );
+}
+
+/*
+ * Returns true, if the block was obtained from the cache, otherwise false.  In
+ * case the block was obtained from the cache, the current tag is returned.
+ */
+static bool _Malloc_Cache_get_tag(
+  const Heap_Control *heap,
+  void               *block,
+  size_t             *index,
+  uintptr_t          *tag
+)
+{
+  uintptr_t alloc_begin;
+  uintptr_t current;
+
+  alloc_begin = (uintptr_t) block;
+
+  if (
+    alloc_begin <= heap->area_begin
+      || alloc_begin >= heap->area_end
+      || !_Heap_Is_aligned( alloc_begin, heap->page_size )
+  ) {
+    return false;
+  }
+
+  current = _Atomic_Load_uintptr(
+    _Malloc_Cache_tag( block ),
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( ( current & MALLOC_CACHE_TAG_MARKER ) == 0 ) {
+    return false;
+  }
+
+  *index = ( current & MALLOC_CACHE_TAG_CLASS_MASK )
+    >> MALLOC_CACHE_TAG_CLASS_SHIFT;
+
+  if (
+    *index >= RTEMS_MALLOC_CACHE_CLASS_COUNT
+      || ( current & ~MALLOC_CACHE_TAG_CACHED )
+        != _Malloc_Cache_make_tag( block, *index )
+  ) {
+    return false;
+  }
+
+  *tag = current;
+  return true;
+}
+
+static void *_Malloc_Cache_next( void *block )
+{
+  return *(void **) block;
+}
+
+static void _Malloc_Cache_set_next( void *block, void *next )
+{
+  *(void **) block = next;
+}
+
+static uintptr_t *_Malloc_Cache_size( void *block )
+{
+  return (uintptr_t *) block + 1;
+}
+
+/*
+ * The size of the heap block does not change while the block is allocated.
+ * Concurrent heap operations may only change the flag in the size and flag
+ * field, so we do not need the allocator lock here.
+ */
+static uintptr_t _Malloc_Cache_block_size( Heap_Control *heap, void *block )
+{
+  return _Heap_Block_size(
+    _Heap_Block_of_alloc_area(
+      (uintptr_t) block - heap->page_size,
+      heap->page_size
+    )
+  );
+}
+
+static void _Malloc_Cache_heap_free_chain( Heap_Control *heap, void *block )
+{
+  _Assert( _RTEMS_Allocator_is_owner() );
+
+  while ( block != NULL ) {
+    void *next;
+
+    next = _Malloc_Cache_next( block );
+    _Malloc_Cache_set_tag( block, 0 );
+    _Heap_Free( heap, (char *) block - heap->page_size );
+    block = next;
+  }
+}
+
+static void _Malloc_Cache_free_chain( Heap_Control *heap, void *block )
+{
+  if ( block != NULL ) {
+    _RTEMS_Lock_allocator();
+    _Malloc_Cache_heap_free_chain( heap, block );
+    _RTEMS_Unlock_allocator();
+  }
+}
+
+static void *_Malloc_Cache_refill( Heap_Control *heap, size_t index )
+{
+  Malloc_Cache          *cache;
+  Malloc_Cache_magazine *magazine;
+  ISR_Level              level;
+  uintptr_t              alloc_size;
+  uint32_t               batch;
+  uint32_t               count;
+  uintptr_t              size;
+  void                  *head;
+  void                  *tail;
+  void                  *block;
+
+  alloc_size = _Malloc_Cache_class_size( index ) + heap->page_size;
+  batch = _Malloc_Cache_configuration.magazine_size / 2 + 1;
+  count = 0;
+  size = 0;
+  head = NULL;
+  tail = NULL;
+  block = NULL;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  while ( count < batch ) {
+    void      *next;
+    uintptr_t  block_size;
+
+    next = _Heap_Allocate( heap, alloc_size );
+
+    if ( next == NULL ) {
+      break;
+    }
+
+    block_size = _Heap_Block_size(
+      _Heap_Block_of_alloc_area( (uintptr_t) next, heap->page_size )
+    );
+    next = (char *) next + heap->page_size;
+    ++count;
+
+    /* The first allocated block is returned to the caller */
+    if ( block == NULL ) {
+      block = next;
+      _Malloc_Cache_set_tag( block, _Malloc_Cache_make_tag( block, index ) );
+      continue;
+    }
+
+    if ( head == NULL ) {
+      tail = next;
+    }
+
+    _Malloc_Cache_set_next( next, head );
+    *_Malloc_Cache_size( next ) = block_size;
+    _Malloc_Cache_set_tag(
+      next,
+      _Malloc_Cache_make_tag( next, index ) | MALLOC_CACHE_TAG_CACHED
+    );
+    head = next;
+    size += block_size;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( head == NULL ) {
+    return block;
+  }
+
+  --count;
+
+  /* The thread may execute on another processor now */
+  _ISR_Local_disable( level );
+  cache = _Malloc_Cache_get();
+  magazine = &cache->Magazines[ index ];
+  _Malloc_Cache_set_next( tail, magazine->head );
+  magazine->head = head;
+  magazine->count += count;
+  magazine->size += size;
+  ++cache->Stats.refills;
+  cache->Stats.cached_blocks += count;
+  cache->Stats.cached_size += size;
+  _ISR_Local_enable( level );
+
+  return block;
+}
+
+void *_Malloc_Cache_allocate( size_t size )
+{
+  Malloc_Cache          *cache;
+  Malloc_Cache_magazine *magazine;
+  ISR_Level              level;
+  size_t                 index;
+  void                  *block;
+  uintptr_t              block_size;
+
+  index = _Malloc_Cache_alloc_class( size );
+  _ISR_Local_disable( level );
+  cache = _Malloc_Cache_get();
+  magazine = &cache->Magazines[ index ];
+  block = magazine->head;
+
+  if ( RTEMS_PREDICT_FALSE( block == NULL ) ) {
+    ++cache->Stats.misses;
+    _ISR_Local_enable( level );
+
+    return _Malloc_Cache_refill( RTEMS_Malloc_Heap, index );
+  }
+
+  block_size = *_Malloc_Cache_size( block );
+  magazine->head = _Malloc_Cache_next( block );
+  --magazine->count;
+  magazine->size -= block_size;
+  ++cache->Stats.hits;
+  --cache->Stats.cached_blocks;
+  cache->Stats.cached_size -= block_size;
+  _ISR_Local_enable( level );
+
+  _Malloc_Cache_set_tag( block, _Malloc_Cache_make_tag( block, index ) );
+
+  return block;
+}
+
+bool _Malloc_Cache_free( void *ptr )
+{
+  Heap_Control          *heap;
+  size_t                 index;
+  uintptr_t              tag;
+  uintptr_t              block_size;
+  Malloc_Cache          *cache;
+  Malloc_Cache_magazine *magazine;
+  ISR_Level              level;
+  void                  *flush;
+
+  heap = RTEMS_Malloc_Heap;
+
+  if ( !_Malloc_Cache_get_tag( heap, ptr, &index, &tag ) ) {
+    /* Let _Heap_Free() validate the pointer */
+    return false;
+  }
+
+  /*
+   * Mark the block as cached before it is visible in a magazine.  This
+   * detects also concurrent frees of the same block.
+   */
+  if (
+    RTEMS_PREDICT_FALSE(
+      ( tag & MALLOC_CACHE_TAG_CACHED ) != 0
+        || !_Atomic_Compare_exchange_uintptr(
+          _Malloc_Cache_tag( ptr ),
+          &tag,
+          tag | MALLOC_CACHE_TAG_CACHED,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+    )
+  ) {
+    rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
+  }
+
+  block_size = _Malloc_Cache_block_size( heap, ptr );
+  *_Malloc_Cache_size( ptr ) = block_size;
+
+  _ISR_Local_disable( level );
+  cache = _Malloc_Cache_get();
+  magazine = &cache->Magazines[ index ];
+
+  if ( magazine->count >= _Malloc_Cache_configuration.magazine_size ) {
+    flush = magazine->head;
+    ++cache->Stats.flushes;
+    cache->Stats.cached_blocks -= magazine->count;
+    cache->Stats.cached_size -= magazine->size;
+    magazine->head = NULL;
+    magazine->count = 0;
+    magazine->size = 0;
+  } else {
+    flush = NULL;
+  }
+
+  _Malloc_Cache_set_next( ptr, magazine->head );
+  magazine->head = ptr;
+  ++magazine->count;
+  magazine->size += block_size;
+  ++cache->Stats.frees;
+  ++cache->Stats.cached_blocks;
+  cache->Stats.cached_size += block_size;
+  _ISR_Local_enable( level );
+
+  _Malloc_Cache_free_chain( heap, flush );
+
+  return true;
+}
+
+bool _Malloc_Cache_size_of_alloc_area( void *ptr, uintptr_t *alloc_size )
+{
+  size_t    index;
+  uintptr_t tag;
+
+  if (
+    !_Malloc_Cache_get_tag( RTEMS_Malloc_Heap, ptr, &index, &tag )
+      || ( tag & MALLOC_CACHE_TAG_CACHED ) != 0
+  ) {
+    return false;
+  }
+
+  *alloc_size = _Malloc_Cache_class_size( index );
+  return true;
+}
+
+typedef struct {
+  void *flush[ CPU_MAXIMUM_PROCESSORS ];
+} Malloc_Cache_flush_context;
+
+static void _Malloc_Cache_do_flush( void *arg )
+{
+  Malloc_Cache_flush_context *ctx;
+  Malloc_Cache               *cache;
+  ISR_Level                   level;
+  uint32_t                    cpu_index;
+  size_t                      index;
+  void                       *flush;
+
+  ctx = arg;
+
+  _ISR_Local_disable( level );
+  cpu_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+  cache = &_Malloc_Cache_configuration.caches[ cpu_index ];
+  flush = ctx->flush[ cpu_index ];
+
+  for ( index = 0; index < RTEMS_MALLOC_CACHE_CLASS_COUNT; ++index ) {
+    Malloc_Cache_magazine *magazine;
+    void                  *tail;
+
+    magazine = &cache->Magazines[ index ];
+    tail = magazine->head;
+
+    if ( tail == NULL ) {
+      continue;
+    }
+
+    while ( _Malloc_Cache_next( tail ) != NULL ) {
+      tail = _Malloc_Cache_next( tail );
+    }
+
+    _Malloc_Cache_set_next( tail, flush );
+    flush = magazine->head;
+    magazine->head = NULL;
+    magazine->count = 0;
+    magazine->size = 0;
+  }
+
+  if ( flush != ctx->flush[ cpu_index ] ) {
+    ++cache->Stats.flushes;
+  }
+
+  cache->Stats.cached_blocks = 0;
+  cache->Stats.cached_size = 0;
+  ctx->flush[ cpu_index ] = flush;
+  _ISR_Local_enable( level );
+}
+
+void rtems_malloc_cache_flush( void )
+{
+  Malloc_Cache_flush_context ctx;
+  uint32_t                   cpu_max;
+  uint32_t                   cpu_index;
+
+  if ( _Malloc_Cache_configuration.magazine_size == 0 ) {
+    return;
+  }
+
+  memset( &ctx, 0, sizeof( ctx ) );
+
+#if defined(RTEMS_SMP)
+  _SMP_Broadcast_action( _Malloc_Cache_do_flush, &ctx );
+#else
+  _Malloc_Cache_do_flush( &ctx );
+#endif
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    _Malloc_Cache_free_chain( RTEMS_Malloc_Heap, ctx.flush[ cpu_index ] );
+  }
+}
+
+typedef struct {
+  uint32_t                       cpu_index;
+  rtems_malloc_cache_statistics *the_info;
+} Malloc_Cache_info_context;
+
+static void _Malloc_Cache_do_get_info( void *arg )
+{
+  Malloc_Cache_info_context *ctx;
+  ISR_Level                  level;
+
+  ctx = arg;
+
+  _ISR_Local_disable( level );
+  *ctx->the_info = _Malloc_Cache_configuration.caches[ ctx->cpu_index ].Stats;
+  _ISR_Local_enable( level );
+}
+
+int malloc_cache_info(
+  uint32_t                       cpu_index,
+  rtems_malloc_cache_statistics *the_info
+)
+{
+  Malloc_Cache_info_context ctx;
+
+  if (
+    the_info == NULL
+      || _Malloc_Cache_configuration.magazine_size == 0
+      || cpu_index >= _SMP_Get_processor_maximum()
+  ) {
+    return -1;
+  }
+
+  ctx.cpu_index = cpu_index;
+  ctx.the_info = the_info;
+
+#if defined(RTEMS_SMP)
+  if ( _Processor_mask_Is_set( _SMP_Get_online_processors(), cpu_index ) ) {
+    _SMP_Unicast_action( cpu_index, _Malloc_Cache_do_get_info, &ctx );
+    return 0;
+  }
+#endif
+
+  _Malloc_Cache_do_get_info( &ctx );
+  return 0;
+}
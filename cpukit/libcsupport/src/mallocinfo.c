@@ -20,6 +20,7 @@
 
 #include <rtems/malloc.h>
 #include <rtems/score/protectedheap.h>
+#include <rtems/score/smp.h>
 
 int malloc_info(
   Heap_Information_block *the_info
@@ -29,5 +30,27 @@ int malloc_info(
     return -1;
 
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
+
+  if ( _Malloc_Cache_configuration.magazine_size != 0 ) {
+    uint32_t cpu_max;
+    uint32_t cpu_index;
+
+    cpu_max = _SMP_Get_processor_maximum();
+
+    /*
+     * Blocks held by the per-processor caches are used blocks from the heap
+     * point of view, however, they are available for malloc().
+     */
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      rtems_malloc_cache_statistics stats;
+
+      (void) malloc_cache_info( cpu_index, &stats );
+      the_info->Used.number -= stats.cached_blocks;
+      the_info->Used.total -= stats.cached_size;
+      the_info->Free.number += stats.cached_blocks;
+      the_info->Free.total += stats.cached_size;
+    }
+  }
+
   return 0;
 }
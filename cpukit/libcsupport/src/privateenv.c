@@ -66,7 +66,7 @@ rtems_status_code rtems_libio_set_private_env(void)
       ) {
         Thread_Control *executing = _Thread_Get_executing();
 
-        executing->user_environment = new_env;
+        executing->Cold->user_environment = new_env;
       } else {
         sc = RTEMS_UNSATISFIED;
       }
@@ -96,7 +96,7 @@ void rtems_libio_use_global_env(void)
 
     rtems_libio_free_user_env(env);
     executing = _Thread_Get_executing();
-    executing->user_environment = NULL;
+    executing->Cold->user_environment = NULL;
 
     _Thread_Set_life_protection(life_state);
   }
@@ -104,7 +104,7 @@ void rtems_libio_use_global_env(void)
 
 static void rtems_libio_env_thread_terminate(Thread_Control *the_thread)
 {
-  rtems_user_env_t *env = the_thread->user_environment;
+  rtems_user_env_t *env = the_thread->Cold->user_environment;
 
   if (env != NULL) {
     rtems_libio_free_user_env(env);
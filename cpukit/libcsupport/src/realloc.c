@@ -62,6 +62,20 @@ void *realloc( void *ptr, size_t size )
     return malloc( size );
   }
 
+  /*
+   *  The blocks of the malloc() cache are not resized in place.
+   */
+  if (
+    _Malloc_Cache_is_enabled()
+      && _Malloc_Cache_size_of_alloc_area( ptr, &old_size )
+  ) {
+    if ( size <= old_size ) {
+      return ptr;
+    }
+
+    return new_alloc( ptr, size, old_size );
+  }
+
   heap = RTEMS_Malloc_Heap;
 
   switch ( _Malloc_System_state() ) {
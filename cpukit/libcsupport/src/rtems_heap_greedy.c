@@ -32,6 +32,7 @@ void *rtems_heap_greedy_allocate(
 {
   void *opaque;
 
+  rtems_malloc_cache_flush();
   _RTEMS_Lock_allocator();
   opaque = _Heap_Greedy_allocate( RTEMS_Malloc_Heap, block_sizes, block_count );
   _RTEMS_Unlock_allocator();
@@ -45,6 +46,7 @@ void *rtems_heap_greedy_allocate_all_except_largest(
 {
   void *opaque;
 
+  rtems_malloc_cache_flush();
   _RTEMS_Lock_allocator();
   opaque = _Heap_Greedy_allocate_all_except_largest(
     RTEMS_Malloc_Heap,
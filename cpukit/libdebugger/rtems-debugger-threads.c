@@ -533,11 +533,11 @@ rtems_debugger_thread_state_str(rtems_debugger_thread* thread,
 unsigned long
 rtems_debugger_thread_stack_size(rtems_debugger_thread* thread)
 {
-  return thread->tcb->Start.Initial_stack.size;
+  return thread->tcb->Cold->Start.Initial_stack.size;
 }
 
 void*
 rtems_debugger_thread_stack_area(rtems_debugger_thread* thread)
 {
-  return thread->tcb->Start.Initial_stack.area;
+  return thread->tcb->Cold->Start.Initial_stack.area;
 }
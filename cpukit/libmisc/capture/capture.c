@@ -282,7 +282,7 @@ rtems_capture_find_control (rtems_name name, rtems_id id)
 static bool
 rtems_capture_initialize_control (rtems_tcb *tcb, void *arg)
 {
-  if (tcb->Capture.control == NULL)
+  if (tcb->Cold->Capture.control == NULL)
   {
     rtems_name             name = rtems_build_name(0, 0, 0, 0);
     rtems_id               id;
@@ -300,7 +300,7 @@ rtems_capture_initialize_control (rtems_tcb *tcb, void *arg)
       if (rtems_capture_match_name_id (control->name, control->id,
                                        name, id))
       {
-        tcb->Capture.control = control;
+        tcb->Cold->Capture.control = control;
         break;
       }
     }
@@ -392,7 +392,7 @@ rtems_capture_record_open (rtems_tcb*                         tcb,
     ++cpu->count;
 
     if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
-      tcb->Capture.flags |= RTEMS_CAPTURE_TRACED;
+      tcb->Cold->Capture.flags |= RTEMS_CAPTURE_TRACED;
 
     /*
      * Create a local copy then copy. The buffer maybe mis-aligned.
@@ -437,14 +437,14 @@ rtems_capture_initialize_task( rtems_tcb* tcb )
 
   rtems_interrupt_lock_acquire (&capture_lock_global, &lock_context);
 
-  if (tcb->Capture.control == NULL) {
+  if (tcb->Cold->Capture.control == NULL) {
     for (control = capture_controls; control != NULL; control = control->next)
       if (rtems_capture_match_name_id (control->name, control->id,
                                        name, id))
-        tcb->Capture.control = control;
+        tcb->Cold->Capture.control = control;
   }
 
-  tcb->Capture.flags |= RTEMS_CAPTURE_INIT_TASK;
+  tcb->Cold->Capture.flags |= RTEMS_CAPTURE_INIT_TASK;
 
   rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 }
@@ -462,11 +462,11 @@ void rtems_capture_record_task (rtems_tcb* tcb)
     rtems_object_get_classic_name (id, &name);
 
   rec.name = name;
-  rec.stack_size = tcb->Start.Initial_stack.size;
+  rec.stack_size = tcb->Cold->Start.Initial_stack.size;
   rec.start_priority = rtems_capture_task_start_priority (tcb);
 
   rtems_interrupt_lock_acquire (&capture_lock_global, &lock_context);
-  tcb->Capture.flags |= RTEMS_CAPTURE_RECORD_TASK;
+  tcb->Cold->Capture.flags |= RTEMS_CAPTURE_RECORD_TASK;
   rtems_interrupt_lock_release (&capture_lock_global, &lock_context);
 
   /*
@@ -492,7 +492,7 @@ bool rtems_capture_filter (rtems_tcb*  tcb, uint32_t events)
   {
     rtems_capture_control* control;
 
-    control = tcb->Capture.control;
+    control = tcb->Cold->Capture.control;
 
     /*
      * Capture the record if we have an event that is always
@@ -532,14 +532,14 @@ rtems_capture_trigger_fired (rtems_tcb* ft, rtems_tcb* tt, uint32_t events)
 
     if (ft)
     {
-      fc = ft->Capture.control;
+      fc = ft->Cold->Capture.control;
       if (fc)
         from_events = fc->from_triggers & events;
     }
 
     if (tt)
     {
-      tc = tt->Capture.control;
+      tc = tt->Cold->Capture.control;
       if (tc)
       {
         to_events = tc->to_triggers & events;
@@ -756,7 +756,7 @@ rtems_capture_set_monitor (bool enable)
 static bool
 rtems_capture_flush_tcb (rtems_tcb *tcb, void *arg)
 {
-  tcb->Capture.flags &= ~RTEMS_CAPTURE_TRACED;
+  tcb->Cold->Capture.flags &= ~RTEMS_CAPTURE_TRACED;
   return false;
 }
 
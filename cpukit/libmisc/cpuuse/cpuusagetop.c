@@ -176,7 +176,7 @@ task_usage(Thread_Control* thread, void* arg)
   Timestamp_Control     current = data->zero;
   int                   j;
 
-  data->stack_size += thread->Start.Initial_stack.size;
+  data->stack_size += thread->Cold->Start.Initial_stack.size;
 
   _Thread_Get_CPU_time_used(thread, &usage);
 
@@ -452,7 +452,8 @@ rtems_cpuusage_top_thread (rtems_task_argument arg)
        */
       rtems_object_get_name(thread->Object.id, sizeof(name), name);
       if (name[0] == '\0')
-        snprintf(name, sizeof(name) - 1, "(%p)", thread->Start.Entry.Kinds.Numeric.entry);
+        snprintf(name, sizeof(name) - 1, "(%p)",
+                 thread->Cold->Start.Entry.Kinds.Numeric.entry);
 
       _Thread_queue_Context_initialize(&queue_context);
       _Thread_Wait_acquire(thread, &queue_context);
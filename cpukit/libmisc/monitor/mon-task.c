@@ -108,9 +108,9 @@ rtems_monitor_task_canonical(
     rtems_monitor_task_wait_info( canonical_task, rtems_thread );
 
     canonical_task->state = rtems_thread->current_state;
-    canonical_task->entry = rtems_thread->Start.Entry;
-    canonical_task->stack = rtems_thread->Start.Initial_stack.area;
-    canonical_task->stack_size = rtems_thread->Start.Initial_stack.size;
+    canonical_task->entry = rtems_thread->Cold->Start.Entry;
+    canonical_task->stack = rtems_thread->Cold->Start.Initial_stack.area;
+    canonical_task->stack_size = rtems_thread->Cold->Start.Initial_stack.size;
     canonical_task->priority = _Thread_Get_unmapped_priority( rtems_thread );
     canonical_task->events = api->Event.pending_events;
     /*
@@ -23,6 +23,36 @@
 
 #include "internal.h"
 
+static void rtems_shell_print_malloc_cache_stats( void )
+{
+  rtems_malloc_cache_statistics stats;
+  uint32_t                      cpu_index;
+
+  cpu_index = 0;
+
+  while ( malloc_cache_info( cpu_index, &stats ) == 0 ) {
+    printf(
+      "Cache of processor %" PRIu32 ":\n"
+      "  Number of cache hits:                   %12" PRIu32 "\n"
+      "  Number of cache misses:                 %12" PRIu32 "\n"
+      "  Number of magazine refills:             %12" PRIu32 "\n"
+      "  Number of frees to the cache:           %12" PRIu32 "\n"
+      "  Number of magazine flushes:             %12" PRIu32 "\n"
+      "  Number of cached blocks:                %12" PRIu32 "\n"
+      "  Size of cached blocks in bytes:         %12" PRIuPTR "\n",
+      cpu_index,
+      stats.hits,
+      stats.misses,
+      stats.refills,
+      stats.frees,
+      stats.flushes,
+      stats.cached_blocks,
+      stats.cached_size
+    );
+    ++cpu_index;
+  }
+}
+
 static int rtems_shell_main_malloc_info(
   int   argc,
   char *argv[]
@@ -38,6 +68,7 @@ static int rtems_shell_main_malloc_info(
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+    rtems_shell_print_malloc_cache_stats();
   }
 
   return 0;
@@ -19,6 +19,7 @@
 #include <rtems/malloc.h>
 #include <rtems/shell.h>
 #include <rtems/score/protectedheap.h>
+#include <rtems/score/stackpool.h>
 #include <rtems/score/wkspace.h>
 #include "internal.h"
 
@@ -29,6 +30,31 @@ void rtems_shell_print_unified_work_area_message(void)
   );
 }
 
+static void rtems_shell_print_stack_pool_stats( void )
+{
+  Stack_Pool_Statistics s;
+
+  _Stack_Pool_Get_statistics( &s );
+  printf(
+    "Size of a stack pool slab in bytes:       %12zu\n"
+    "Size of a stack pool stack area in bytes: %12zu\n"
+    "Maximum number of free stack pool slabs:  %12" PRIu32 "\n"
+    "Current number of free stack pool slabs:  %12" PRIu32 "\n"
+    "Stack pool hits:                          %12" PRIu32 "\n"
+    "Stack pool misses:                        %12" PRIu32 "\n"
+    "Stack pool oversized allocations:         %12" PRIu32 "\n"
+    "Stack pool overflows:                     %12" PRIu32 "\n",
+    s.slab_size,
+    s.stack_size,
+    s.maximum_free_slabs,
+    s.free_slabs,
+    s.hits,
+    s.misses,
+    s.oversized,
+    s.overflows
+  );
+}
+
 static int rtems_shell_main_wkspace_info(
   int   argc RTEMS_UNUSED,
   char *argv[] RTEMS_UNUSED
@@ -43,6 +69,10 @@ static int rtems_shell_main_wkspace_info(
   rtems_shell_print_heap_info( "used", &info.Used );
   rtems_shell_print_heap_stats( &info.Stats );
 
+  if ( _Stack_Pool_Configuration.maximum != 0 ) {
+    rtems_shell_print_stack_pool_stats();
+  }
+
   return 0;
 }
 
@@ -87,7 +87,7 @@ static inline bool Stack_check_Frame_pointer_in_range(
 {
   #if defined(__GNUC__)
     void *sp = __builtin_frame_address(0);
-    const Stack_Control *the_stack = &the_thread->Start.Initial_stack;
+    const Stack_Control *the_stack = &the_thread->Cold->Start.Initial_stack;
 
     if ( sp < the_stack->area ) {
       return false;
@@ -182,8 +182,8 @@ bool rtems_stack_checker_create_extension(
 {
   Stack_check_Initialized = true;
 
-  Stack_check_Dope_stack( &the_thread->Start.Initial_stack );
-  Stack_check_Add_sanity_pattern( &the_thread->Start.Initial_stack );
+  Stack_check_Dope_stack( &the_thread->Cold->Start.Initial_stack );
+  Stack_check_Add_sanity_pattern( &the_thread->Cold->Start.Initial_stack );
 
   return true;
 }
@@ -249,7 +249,7 @@ static void Stack_check_report_blown_task(
   bool pattern_ok
 )
 {
-  const Stack_Control *stack = &running->Start.Initial_stack;
+  const Stack_Control *stack = &running->Cold->Start.Initial_stack;
   void                *pattern_area = Stack_check_Get_pattern(stack);
   char                 name[2 * THREAD_DEFAULT_MAXIMUM_NAME_SIZE];
 
@@ -312,12 +312,14 @@ void rtems_stack_checker_switch_extension(
 
   if ( !sp_ok ) {
     pattern_ok = Stack_check_Is_sanity_pattern_valid(
-      &heir->Start.Initial_stack
+      &heir->Cold->Start.Initial_stack
     );
     Stack_check_report_blown_task( heir, pattern_ok );
   }
 
-  pattern_ok = Stack_check_Is_sanity_pattern_valid( &running->Start.Initial_stack );
+  pattern_ok = Stack_check_Is_sanity_pattern_valid(
+    &running->Cold->Start.Initial_stack
+  );
 
   if ( !pattern_ok ) {
     Stack_check_report_blown_task( running, pattern_ok );
@@ -325,7 +327,9 @@ void rtems_stack_checker_switch_extension(
 #else
   sp_ok = Stack_check_Frame_pointer_in_range( running );
 
-  pattern_ok = Stack_check_Is_sanity_pattern_valid( &running->Start.Initial_stack );
+  pattern_ok = Stack_check_Is_sanity_pattern_valid(
+    &running->Cold->Start.Initial_stack
+  );
 
   if ( !sp_ok || !pattern_ok ) {
     Stack_check_report_blown_task( running, pattern_ok );
@@ -451,7 +455,7 @@ static bool Stack_check_Dump_threads_usage(
   printer = arg;
   _Thread_Get_name( the_thread, name, sizeof( name ) );
   Stack_check_Dump_stack_usage(
-    &the_thread->Start.Initial_stack,
+    &the_thread->Cold->Start.Initial_stack,
     (void *) _CPU_Context_Get_SP( &the_thread->Registers ),
     name,
     the_thread->Object.id,
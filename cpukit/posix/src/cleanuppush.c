@@ -44,8 +44,8 @@ void _pthread_cleanup_push(
   _ISR_Local_disable( level );
 
   executing = _Thread_Executing;
-  context->_previous = executing->last_cleanup_context;
-  executing->last_cleanup_context = context;
+  context->_previous = executing->Cold->last_cleanup_context;
+  executing->Cold->last_cleanup_context = context;
 
   _ISR_Local_enable( level );
 }
@@ -65,7 +65,7 @@ void _pthread_cleanup_pop(
   _ISR_Local_disable( level );
 
   executing = _Thread_Executing;
-  executing->last_cleanup_context = context->_previous;
+  executing->Cold->last_cleanup_context = context->_previous;
 
   _ISR_Local_enable( level );
 }
@@ -74,8 +74,8 @@ static void _POSIX_Cleanup_terminate_extension( Thread_Control *the_thread )
 {
   struct _pthread_cleanup_context *context;
 
-  context = the_thread->last_cleanup_context;
-  the_thread->last_cleanup_context = NULL;
+  context = the_thread->Cold->last_cleanup_context;
+  the_thread->Cold->last_cleanup_context = NULL;
 
   while ( context != NULL ) {
     ( *context->_routine )( context->_arg );
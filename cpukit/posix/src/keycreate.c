@@ -45,6 +45,7 @@ int pthread_key_create(
   }
 
   the_key->destructor = destructor;
+  _ISR_lock_Initialize( &the_key->Lock, "POSIX Key" );
   _Chain_Initialize_empty( &the_key->Key_value_pairs );
   _Objects_Open_u32( &_POSIX_Keys_Information, &the_key->Object, 0 );
   *key = the_key->Object.id;
@@ -79,16 +80,58 @@ static void _POSIX_Keys_Initialize_keypool( void )
     _POSIX_Keys_Get_initial_keypool_size(),
     sizeof( _POSIX_Keys_Key_value_pairs[ 0 ] )
   );
+
+  if ( _POSIX_Keys_Keypool_caches != NULL ) {
+    _Freechain_Initialize_caches(
+      &_POSIX_Keys_Keypool,
+      _POSIX_Keys_Keypool_caches,
+      POSIX_KEYS_KEYPOOL_CACHE_BATCH_SIZE
+    );
+  }
 }
 
 POSIX_Keys_Key_value_pair * _POSIX_Keys_Key_value_allocate( void )
 {
-  return (POSIX_Keys_Key_value_pair *) _Freechain_Get(
+  POSIX_Keys_Key_value_pair *key_value_pair;
+  uint32_t                   bump_count;
+
+  bump_count = _POSIX_Keys_Get_keypool_bump_count();
+
+  if ( _POSIX_Keys_Keypool_caches != NULL ) {
+    key_value_pair = _Freechain_Get(
+      &_POSIX_Keys_Keypool,
+      _Workspace_Allocate,
+      0,
+      sizeof( POSIX_Keys_Key_value_pair )
+    );
+
+    if ( key_value_pair != NULL || bump_count == 0 ) {
+      return key_value_pair;
+    }
+  }
+
+  /* The allocator mutex protects the free chain and the workspace */
+  _Objects_Allocator_lock();
+  key_value_pair = _Freechain_Get(
     &_POSIX_Keys_Keypool,
     _Workspace_Allocate,
-    _POSIX_Keys_Get_keypool_bump_count(),
+    bump_count,
     sizeof( POSIX_Keys_Key_value_pair )
   );
+  _Objects_Allocator_unlock();
+
+  return key_value_pair;
+}
+
+void _POSIX_Keys_Key_value_free( POSIX_Keys_Key_value_pair *key_value_pair )
+{
+  if ( _POSIX_Keys_Keypool_caches != NULL ) {
+    _Freechain_Put( &_POSIX_Keys_Keypool, key_value_pair );
+  } else {
+    _Objects_Allocator_lock();
+    _Freechain_Put( &_POSIX_Keys_Keypool, key_value_pair );
+    _Objects_Allocator_unlock();
+  }
 }
 
 static void _POSIX_Keys_Run_destructors( Thread_Control *the_thread )
@@ -97,39 +140,36 @@ static void _POSIX_Keys_Run_destructors( Thread_Control *the_thread )
     ISR_lock_Context  lock_context;
     RBTree_Node      *node;
 
+    /* The allocator mutex protects the keys against pthread_key_delete() */
     _Objects_Allocator_lock();
     _POSIX_Keys_Key_value_acquire( the_thread, &lock_context );
 
-    node = _RBTree_Root( &the_thread->Keys.Key_value_pairs );
+    node = _RBTree_Root( &the_thread->Cold->Keys.Key_value_pairs );
+    _POSIX_Keys_Key_value_release( the_thread, &lock_context );
+
     if ( node != NULL ) {
       POSIX_Keys_Key_value_pair *key_value_pair;
-      pthread_key_t              key;
       void                      *value;
       POSIX_Keys_Control        *the_key;
       void                    ( *destructor )( void * );
 
       key_value_pair = POSIX_KEYS_RBTREE_NODE_TO_KEY_VALUE_PAIR( node );
-      key = key_value_pair->key;
-      value = key_value_pair->value;
-      _RBTree_Extract(
-        &the_thread->Keys.Key_value_pairs,
-        &key_value_pair->Lookup_node
-      );
-
-      _POSIX_Keys_Key_value_release( the_thread, &lock_context );
-      _POSIX_Keys_Key_value_free( key_value_pair );
-
-      the_key = _POSIX_Keys_Get( key );
+      the_key = _POSIX_Keys_Get( key_value_pair->key );
       _Assert( the_key != NULL );
+
+      _POSIX_Keys_Acquire( the_key, &lock_context );
+      value = key_value_pair->value;
       destructor = the_key->destructor;
+      _POSIX_Keys_Key_value_extract( key_value_pair );
+      _POSIX_Keys_Release( the_key, &lock_context );
 
+      _POSIX_Keys_Key_value_free( key_value_pair );
       _Objects_Allocator_unlock();
 
       if ( destructor != NULL && value != NULL ) {
         ( *destructor )( value );
       }
     } else {
-      _POSIX_Keys_Key_value_release( the_thread, &lock_context );
       _Objects_Allocator_unlock();
       break;
     }
@@ -26,27 +26,30 @@
 
 static void _POSIX_Keys_Destroy( POSIX_Keys_Control *the_key )
 {
+  ISR_lock_Context lock_context;
+
+  /*
+   * Close the key under protection of the key lock, so that
+   * _POSIX_Keys_Get_and_acquire() fails afterwards.
+   */
+  _POSIX_Keys_Acquire( the_key, &lock_context );
   _Objects_Close( &_POSIX_Keys_Information, &the_key->Object );
 
   while ( !_Chain_Is_empty( &the_key->Key_value_pairs ) ) {
     POSIX_Keys_Key_value_pair *key_value_pair;
-    ISR_lock_Context           lock_context;
-    Thread_Control            *the_thread;
 
     key_value_pair = (POSIX_Keys_Key_value_pair *)
       _Chain_First( &the_key->Key_value_pairs );
-
-    the_thread = key_value_pair->thread;
-    _POSIX_Keys_Key_value_acquire( the_thread, &lock_context );
-    _RBTree_Extract(
-      &the_thread->Keys.Key_value_pairs,
-      &key_value_pair->Lookup_node
-    );
-    _POSIX_Keys_Key_value_release( the_thread, &lock_context );
+    _POSIX_Keys_Key_value_extract( key_value_pair );
+    _POSIX_Keys_Release( the_key, &lock_context );
 
     _POSIX_Keys_Key_value_free( key_value_pair );
+
+    _POSIX_Keys_Acquire( the_key, &lock_context );
   }
 
+  _POSIX_Keys_Release( the_key, &lock_context );
+  _ISR_lock_Destroy( &the_key->Lock );
   _Objects_Free( &_POSIX_Keys_Information, &the_key->Object );
 }
 
@@ -41,46 +41,40 @@ static int _POSIX_Keys_Create_value(
   Thread_Control     *executing
 )
 {
-  POSIX_Keys_Control *the_key;
-  int                 eno;
-
-  _Objects_Allocator_lock();
+  POSIX_Keys_Key_value_pair *key_value_pair;
+  POSIX_Keys_Control        *the_key;
+  ISR_lock_Context           lock_context;
+  ISR_lock_Context           thread_lock_context;
+
+  key_value_pair = _POSIX_Keys_Key_value_allocate();
+  if ( key_value_pair == NULL ) {
+    return ENOMEM;
+  }
 
-  the_key = _POSIX_Keys_Get( key );
-  if ( the_key != NULL ) {
-    POSIX_Keys_Key_value_pair *key_value_pair;
+  the_key = _POSIX_Keys_Get_and_acquire( key, &lock_context );
+  if ( the_key == NULL ) {
+    _POSIX_Keys_Key_value_free( key_value_pair );
+    return EINVAL;
+  }
 
-    key_value_pair = _POSIX_Keys_Key_value_allocate();
-    if ( key_value_pair != NULL ) {
-      ISR_lock_Context lock_context;
+  key_value_pair->key = key;
+  key_value_pair->thread = executing;
+  key_value_pair->value = RTEMS_DECONST( void *, value );
 
-      key_value_pair->key = key;
-      key_value_pair->thread = executing;
-      key_value_pair->value = RTEMS_DECONST( void *, value );
+  _RBTree_Initialize_node( &key_value_pair->Lookup_node );
 
-      _RBTree_Initialize_node( &key_value_pair->Lookup_node );
+  _Chain_Initialize_node( &key_value_pair->Key_node );
+  _Chain_Append_unprotected(
+    &the_key->Key_value_pairs,
+    &key_value_pair->Key_node
+  );
 
-      _Chain_Initialize_node( &key_value_pair->Key_node );
-      _Chain_Append_unprotected(
-        &the_key->Key_value_pairs,
-        &key_value_pair->Key_node
-      );
+  _POSIX_Keys_Key_value_acquire_critical( executing, &thread_lock_context );
+  _POSIX_Keys_Key_value_insert( key, key_value_pair, executing );
+  _POSIX_Keys_Key_value_release_critical( executing, &thread_lock_context );
+  _POSIX_Keys_Release( the_key, &lock_context );
 
-      _POSIX_Keys_Key_value_acquire( executing, &lock_context );
-      _POSIX_Keys_Key_value_insert( key, key_value_pair, executing );
-      _POSIX_Keys_Key_value_release( executing, &lock_context );
-      eno = 0;
-    } else {
-      eno = ENOMEM;
-    }
-
-  } else {
-    eno = EINVAL;
-  }
-
-  _Objects_Allocator_unlock();
-
-  return eno;
+  return 0;
 }
 
 static int _POSIX_Keys_Delete_value(
@@ -88,40 +82,35 @@ static int _POSIX_Keys_Delete_value(
   Thread_Control *executing
 )
 {
-  POSIX_Keys_Control *the_key;
-  int                 eno;
-
-  _Objects_Allocator_lock();
-
-  the_key = _POSIX_Keys_Get( key );
-  if ( the_key != NULL ) {
-    POSIX_Keys_Key_value_pair *key_value_pair;
-    ISR_lock_Context           lock_context;
-
-    _POSIX_Keys_Key_value_acquire( executing, &lock_context );
+  POSIX_Keys_Key_value_pair *key_value_pair;
+  POSIX_Keys_Control        *the_key;
+  ISR_lock_Context           lock_context;
+  ISR_lock_Context           thread_lock_context;
+
+  the_key = _POSIX_Keys_Get_and_acquire( key, &lock_context );
+  if ( the_key == NULL ) {
+    return EINVAL;
+  }
 
-    key_value_pair = _POSIX_Keys_Key_value_find( key, executing );
-    if ( key_value_pair != NULL ) {
-      _RBTree_Extract(
-        &executing->Keys.Key_value_pairs,
-        &key_value_pair->Lookup_node
-      );
+  _POSIX_Keys_Key_value_acquire_critical( executing, &thread_lock_context );
 
-      _POSIX_Keys_Key_value_release( executing, &lock_context );
+  key_value_pair = _POSIX_Keys_Key_value_find( key, executing );
+  if ( key_value_pair != NULL ) {
+    _RBTree_Extract(
+      &executing->Cold->Keys.Key_value_pairs,
+      &key_value_pair->Lookup_node
+    );
+    _Chain_Extract_unprotected( &key_value_pair->Key_node );
+  }
 
-      _POSIX_Keys_Key_value_free( key_value_pair );
-    } else {
-      _POSIX_Keys_Key_value_release( executing, &lock_context );
-    }
+  _POSIX_Keys_Key_value_release_critical( executing, &thread_lock_context );
+  _POSIX_Keys_Release( the_key, &lock_context );
 
-    eno = 0;
-  } else {
-    eno = EINVAL;
+  if ( key_value_pair != NULL ) {
+    _POSIX_Keys_Key_value_free( key_value_pair );
   }
 
-  _Objects_Allocator_unlock();
-
-  return eno;
+  return 0;
 }
 
 /*
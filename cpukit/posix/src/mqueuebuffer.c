@@ -0,0 +1,224 @@
+/**
+ * @file
+ *
+ * @ingroup POSIX_MQUEUE_P Message Queues Private Support Information
+ *
+ * @brief POSIX Message Queue Buffer Loans
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+#include <rtems/posix/posixapi.h>
+
+#include <fcntl.h>
+
+static POSIX_Message_queue_Control *_POSIX_Message_queue_Get_open(
+  mqd_t                 mqdes,
+  int                   denied_access_mode,
+  Thread_queue_Context *queue_context
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, queue_context );
+
+  if ( the_mq == NULL ) {
+    return NULL;
+  }
+
+  if ( ( the_mq->oflag & O_ACCMODE ) == denied_access_mode ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return NULL;
+  }
+
+  _CORE_message_queue_Acquire_critical( &the_mq->Message_queue, queue_context );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, queue_context );
+    return NULL;
+  }
+
+  return the_mq;
+}
+
+int mq_loan_buffer_np( mqd_t mqdes, void **buffer )
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  if ( buffer == NULL ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_open( mqdes, O_RDONLY, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  status = _CORE_message_queue_Loan(
+    &the_mq->Message_queue,
+    &the_message,
+    &queue_context
+  );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *buffer = the_message->Contents.buffer;
+  }
+
+  return _POSIX_Zero_or_minus_one_plus_errno( status );
+}
+
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *buffer,
+  size_t        msg_len,
+  unsigned int  msg_prio
+)
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  if ( msg_prio > MQ_PRIO_MAX ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_open( mqdes, O_RDONLY, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  the_message = _CORE_message_queue_Get_loaned_message(
+    &the_mq->Message_queue,
+    buffer
+  );
+
+  if ( the_message == NULL ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  status = _CORE_message_queue_Commit(
+    &the_mq->Message_queue,
+    the_message,
+    msg_len,
+    _POSIX_Message_queue_Priority_to_core( msg_prio ),
+    &queue_context
+  );
+  return _POSIX_Zero_or_minus_one_plus_errno( status );
+}
+
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **buffer,
+  unsigned int  *msg_prio
+)
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Thread_Control                    *executing;
+  Status_Control                     status;
+
+  if ( buffer == NULL ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get_open( mqdes, O_WRONLY, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  _Thread_queue_Context_set_enqueue_callout(
+    &queue_context,
+    _Thread_queue_Enqueue_do_nothing_extra
+  );
+
+  executing = _Thread_Executing;
+  status = _CORE_message_queue_Seize_loan(
+    &the_mq->Message_queue,
+    executing,
+    &the_message,
+    ( the_mq->oflag & O_NONBLOCK ) == 0,
+    &queue_context
+  );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_error( status ) );
+  }
+
+  if ( msg_prio != NULL ) {
+    *msg_prio = _POSIX_Message_queue_Priority_from_core(
+      executing->Wait.count
+    );
+  }
+
+  *buffer = the_message->Contents.buffer;
+  return (ssize_t) the_message->Contents.size;
+}
+
+int mq_return_buffer_np( mqd_t mqdes, void *buffer )
+{
+  POSIX_Message_queue_Control       *the_mq;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_mq = _POSIX_Message_queue_Get_open( mqdes, -1, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  the_message = _CORE_message_queue_Get_loaned_message(
+    &the_mq->Message_queue,
+    buffer
+  );
+
+  if ( the_message == NULL ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  _CORE_message_queue_Return(
+    &the_mq->Message_queue,
+    the_message,
+    &queue_context
+  );
+  return 0;
+}
@@ -18,6 +18,46 @@
 #endif
 
 #include <rtems/posix/rwlockimpl.h>
+#include <rtems/posix/posixapi.h>
+
+#include <stdlib.h>
+
+static int _POSIX_RWLock_Destroy_big_reader(
+  POSIX_RWLock_Control *the_rwlock
+)
+{
+  CORE_BRWLock_Control *big_reader;
+  Thread_queue_Context  queue_context;
+  Status_Control        status;
+
+  big_reader = _POSIX_RWLock_Get_big_reader( the_rwlock );
+  _Thread_queue_Context_initialize( &queue_context );
+  _POSIX_RWLock_ISR_disable( &queue_context );
+
+  /*
+   *  In contrast to the default rwlock, the big reader rwlock must not be
+   *  destroyed while it is locked, since the storage is freed.
+   */
+
+  status = _CORE_BRWLock_Close( big_reader, &queue_context );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    return _POSIX_Get_error( status );
+  }
+
+  /*
+   *  Operations which validated the object before the flags are invalidated
+   *  check the flags again with interrupts disabled, see
+   *  _POSIX_RWLock_Big_reader_is_valid().  Wait for the operations in
+   *  progress before the storage is freed.
+   */
+
+  the_rwlock->flags = ~the_rwlock->flags;
+  _CORE_BRWLock_Quiesce();
+  _CORE_BRWLock_Destroy( big_reader );
+  free( the_rwlock->Big_reader.control );
+  return 0;
+}
 
 int pthread_rwlock_destroy(
   pthread_rwlock_t *_rwlock
@@ -29,6 +69,10 @@ int pthread_rwlock_destroy(
   the_rwlock = _POSIX_RWLock_Get( _rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
+  if ( _POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    return _POSIX_RWLock_Destroy_big_reader( the_rwlock );
+  }
+
   _CORE_RWLock_Acquire( &the_rwlock->RWLock, &queue_context );
 
   /*
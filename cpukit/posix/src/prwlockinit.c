@@ -24,6 +24,8 @@
 #include <rtems/posix/rwlockimpl.h>
 #include <rtems/posix/posixapi.h>
 
+#include <stdlib.h>
+
 RTEMS_STATIC_ASSERT(
   offsetof( POSIX_RWLock_Control, flags )
     == offsetof( pthread_rwlock_t, _flags ),
@@ -53,6 +55,30 @@ RTEMS_STATIC_ASSERT(
   POSIX_RWLOCK_CONTROL_SIZE
 );
 
+static int _POSIX_RWLock_Initialize_big_reader(
+  POSIX_RWLock_Control *the_rwlock
+)
+{
+  POSIX_RWLock_Big_reader *big_reader;
+  void                    *storage;
+  int                      eno;
+
+  eno = posix_memalign(
+    &storage,
+    CPU_CACHE_LINE_BYTES,
+    sizeof( *big_reader ) + _CORE_BRWLock_Per_CPU_size()
+  );
+  if ( eno != 0 ) {
+    return ENOMEM;
+  }
+
+  big_reader = storage;
+  _CORE_BRWLock_Initialize( &big_reader->Lock, &big_reader->Per_CPU[ 0 ] );
+  the_rwlock->Big_reader.control = big_reader;
+  the_rwlock->flags |= POSIX_RWLOCK_BIG_READER;
+  return 0;
+}
+
 int pthread_rwlock_init(
   pthread_rwlock_t           *rwlock,
   const pthread_rwlockattr_t *attr
@@ -78,5 +104,13 @@ int pthread_rwlock_init(
 
   the_rwlock->flags = (uintptr_t) the_rwlock ^ POSIX_RWLOCK_MAGIC;
   _CORE_RWLock_Initialize( &the_rwlock->RWLock );
+
+  if (
+    attr != NULL
+      && ( attr->is_initialized & POSIX_RWLOCKATTR_BIG_READER ) != 0
+  ) {
+    return _POSIX_RWLock_Initialize_big_reader( the_rwlock );
+  }
+
   return 0;
 }
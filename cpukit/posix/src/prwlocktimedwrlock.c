@@ -41,10 +41,29 @@ int pthread_rwlock_timedwrlock(
     &queue_context,
     abstime
   );
-  status = _CORE_RWLock_Seize_for_writing(
-    &the_rwlock->RWLock,
-    true,
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    Thread_Control *executing;
+
+    executing = _POSIX_RWLock_ISR_disable( &queue_context );
+
+    if ( !_POSIX_RWLock_Big_reader_is_valid( the_rwlock, &queue_context ) ) {
+      return EINVAL;
+    }
+
+    status = _CORE_BRWLock_Seize_for_writing(
+      _POSIX_RWLock_Get_big_reader( the_rwlock ),
+      executing,
+      true,
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_writing(
+      &the_rwlock->RWLock,
+      true,
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
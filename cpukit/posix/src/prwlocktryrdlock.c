@@ -34,10 +34,29 @@ int pthread_rwlock_tryrdlock(
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
   _Thread_queue_Context_initialize( &queue_context );
-  status = _CORE_RWLock_Seize_for_reading(
-    &the_rwlock->RWLock,
-    false,                  /* do not wait for the rwlock */
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    Thread_Control *executing;
+
+    executing = _POSIX_RWLock_ISR_disable( &queue_context );
+
+    if ( !_POSIX_RWLock_Big_reader_is_valid( the_rwlock, &queue_context ) ) {
+      return EINVAL;
+    }
+
+    status = _CORE_BRWLock_Seize_for_reading(
+      _POSIX_RWLock_Get_big_reader( the_rwlock ),
+      executing,
+      false,                  /* do not wait for the rwlock */
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_reading(
+      &the_rwlock->RWLock,
+      false,                  /* do not wait for the rwlock */
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
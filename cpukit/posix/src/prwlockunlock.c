@@ -50,6 +50,25 @@ int pthread_rwlock_unlock(
   the_rwlock = _POSIX_RWLock_Get( rwlock );
   POSIX_RWLOCK_VALIDATE_OBJECT( the_rwlock );
 
-  status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+  if ( _POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    Thread_queue_Context  queue_context;
+    Thread_Control       *executing;
+
+    _Thread_queue_Context_initialize( &queue_context );
+    executing = _POSIX_RWLock_ISR_disable( &queue_context );
+
+    if ( !_POSIX_RWLock_Big_reader_is_valid( the_rwlock, &queue_context ) ) {
+      return EINVAL;
+    }
+
+    status = _CORE_BRWLock_Surrender(
+      _POSIX_RWLock_Get_big_reader( the_rwlock ),
+      executing,
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Surrender( &the_rwlock->RWLock );
+  }
+
   return _POSIX_Get_error( status );
 }
@@ -37,10 +37,29 @@ int pthread_rwlock_wrlock(
 
   _Thread_queue_Context_initialize( &queue_context );
   _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
-  status = _CORE_RWLock_Seize_for_writing(
-    &the_rwlock->RWLock,
-    true,          /* do not timeout -- wait forever */
-    &queue_context
-  );
+
+  if ( _POSIX_RWLock_Is_big_reader( the_rwlock ) ) {
+    Thread_Control *executing;
+
+    executing = _POSIX_RWLock_ISR_disable( &queue_context );
+
+    if ( !_POSIX_RWLock_Big_reader_is_valid( the_rwlock, &queue_context ) ) {
+      return EINVAL;
+    }
+
+    status = _CORE_BRWLock_Seize_for_writing(
+      _POSIX_RWLock_Get_big_reader( the_rwlock ),
+      executing,
+      true,          /* do not timeout -- wait forever */
+      &queue_context
+    );
+  } else {
+    status = _CORE_RWLock_Seize_for_writing(
+      &the_rwlock->RWLock,
+      true,          /* do not timeout -- wait forever */
+      &queue_context
+    );
+  }
+
   return _POSIX_Get_error( status );
 }
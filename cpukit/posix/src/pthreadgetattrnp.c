@@ -57,8 +57,8 @@ int pthread_getattr_np(
 
   _Thread_State_acquire_critical( the_thread, &lock_context );
 
-  attr->stackaddr = the_thread->Start.Initial_stack.area;
-  attr->stacksize = the_thread->Start.Initial_stack.size;
+  attr->stackaddr = the_thread->Cold->Start.Initial_stack.area;
+  attr->stacksize = the_thread->Cold->Start.Initial_stack.size;
 
   if ( the_thread->was_created_with_inherited_scheduler ) {
     attr->inheritsched = PTHREAD_INHERIT_SCHED;
@@ -41,6 +41,7 @@ rtems_status_code rtems_message_queue_create(
 {
   Message_queue_Control          *the_message_queue;
   CORE_message_queue_Disciplines  discipline;
+  bool                            ok;
 #if defined(RTEMS_MULTIPROCESSING)
   bool                            is_global;
 #endif
@@ -63,6 +64,25 @@ rtems_status_code rtems_message_queue_create(
   if ( max_message_size == 0 )
       return RTEMS_INVALID_SIZE;
 
+  if ( _Attributes_Is_message_queue_ring( attribute_set ) ) {
+    if (
+      ( attribute_set & RTEMS_MESSAGE_QUEUE_SPSC_RING ) != 0
+        && ( attribute_set & RTEMS_MESSAGE_QUEUE_MPSC_RING ) != 0
+    ) {
+      return RTEMS_NOT_DEFINED;
+    }
+
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( is_global ) {
+      return RTEMS_NOT_DEFINED;
+    }
+#endif
+
+    if ( ( count & ( count - 1 ) ) != 0 ) {
+      return RTEMS_INVALID_NUMBER;
+    }
+  }
+
 #if defined(RTEMS_MULTIPROCESSING)
 #if 1
   /*
@@ -105,12 +125,24 @@ rtems_status_code rtems_message_queue_create(
   else
     discipline = CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO;
 
-  if ( ! _CORE_message_queue_Initialize(
-           &the_message_queue->message_queue,
-           discipline,
-           count,
-           max_message_size
-         ) ) {
+  if ( _Attributes_Is_message_queue_ring( attribute_set ) ) {
+    ok = _CORE_message_queue_Initialize_ring(
+      &the_message_queue->message_queue,
+      discipline,
+      count,
+      max_message_size,
+      ( attribute_set & RTEMS_MESSAGE_QUEUE_MPSC_RING ) != 0
+    );
+  } else {
+    ok = _CORE_message_queue_Initialize(
+      &the_message_queue->message_queue,
+      discipline,
+      count,
+      max_message_size
+    );
+  }
+
+  if ( !ok ) {
 #if defined(RTEMS_MULTIPROCESSING)
     if ( is_global )
         _Objects_MP_Close(
@@ -43,6 +43,10 @@ rtems_status_code rtems_message_queue_delete(
     return RTEMS_INVALID_ID;
   }
 
+  if ( the_message_queue->message_queue.ring != NULL ) {
+    _CORE_message_queue_Ring_close( &the_message_queue->message_queue );
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
@@ -43,6 +43,20 @@ rtems_status_code rtems_message_queue_get_number_pending(
 #endif
   }
 
+  if ( the_message_queue->message_queue.ring != NULL ) {
+    if ( !_CORE_message_queue_Ring_enter( &the_message_queue->message_queue ) ) {
+      _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+      return RTEMS_OBJECT_WAS_DELETED;
+    }
+
+    *count = _CORE_message_queue_Ring_get_number_pending(
+      &the_message_queue->message_queue
+    );
+    _CORE_message_queue_Ring_leave( &the_message_queue->message_queue );
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
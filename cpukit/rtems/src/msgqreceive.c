@@ -59,13 +59,26 @@ rtems_status_code rtems_message_queue_receive(
 #endif
   }
 
+  executing = _Thread_Executing;
+  _Thread_queue_Context_set_enqueue_timeout_ticks( &queue_context, timeout );
+
+  if ( the_message_queue->message_queue.ring != NULL ) {
+    status = _CORE_message_queue_Ring_seize(
+      &the_message_queue->message_queue,
+      executing,
+      buffer,
+      size,
+      !_Options_Is_no_wait( option_set ),
+      &queue_context
+    );
+    return _Status_Get( status );
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
   );
 
-  executing = _Thread_Executing;
-  _Thread_queue_Context_set_enqueue_timeout_ticks( &queue_context, timeout );
   status = _CORE_message_queue_Seize(
     &the_message_queue->message_queue,
     executing,
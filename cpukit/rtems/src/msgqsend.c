@@ -46,6 +46,16 @@ rtems_status_code rtems_message_queue_send(
 #endif
   }
 
+  if ( the_message_queue->message_queue.ring != NULL ) {
+    status = _CORE_message_queue_Ring_submit(
+      &the_message_queue->message_queue,
+      buffer,
+      size,
+      &queue_context
+    );
+    return _Status_Get( status );
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
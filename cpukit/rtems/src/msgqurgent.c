@@ -45,6 +45,11 @@ rtems_status_code rtems_message_queue_urgent(
 #endif
   }
 
+  if ( the_message_queue->message_queue.ring != NULL ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return RTEMS_NOT_DEFINED;
+  }
+
   _CORE_message_queue_Acquire_critical(
     &the_message_queue->message_queue,
     &queue_context
@@ -39,6 +39,7 @@ static const rtems_assoc_t rtems_object_api_classic_assoc[] = {
   { "Period",                  OBJECTS_RTEMS_PERIODS, 0},
   { "Extension",               OBJECTS_RTEMS_EXTENSIONS, 0},
   { "Barrier",                 OBJECTS_RTEMS_BARRIERS, 0},
+  { "RWLock",                  OBJECTS_RTEMS_RWLOCKS, 0},
   { NULL,                      0, 0}
 };
 
@@ -0,0 +1,102 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicRWLock
+ *
+ * @brief RTEMS Create RWLock
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/rwlockimpl.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/wkspace.h>
+#include <rtems/sysinit.h>
+
+rtems_status_code rtems_rwlock_create(
+  rtems_name  name,
+  rtems_id   *id
+)
+{
+  RWLock_Control       *the_rwlock;
+  CORE_BRWLock_Per_CPU *per_cpu;
+
+  if ( !rtems_is_name_valid( name ) ) {
+    return RTEMS_INVALID_NAME;
+  }
+
+  if ( id == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_rwlock = _RWLock_Allocate();
+
+  if ( the_rwlock == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_TOO_MANY;
+  }
+
+  per_cpu = _Workspace_Allocate_aligned(
+    _CORE_BRWLock_Per_CPU_size(),
+    CPU_CACHE_LINE_BYTES
+  );
+
+  if ( per_cpu == NULL ) {
+    _RWLock_Free( the_rwlock );
+    _Objects_Allocator_unlock();
+    return RTEMS_UNSATISFIED;
+  }
+
+  _CORE_BRWLock_Initialize( &the_rwlock->RWLock, per_cpu );
+
+  _Objects_Open(
+    &_RWLock_Information,
+    &the_rwlock->Object,
+    (Objects_Name) name
+  );
+
+  *id = the_rwlock->Object.id;
+
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
+
+static void _RWLock_Manager_initialization( void )
+{
+  _Objects_Initialize_information( &_RWLock_Information );
+}
+
+RTEMS_SYSINIT_ITEM(
+  _RWLock_Manager_initialization,
+  RTEMS_SYSINIT_CLASSIC_RWLOCK,
+  RTEMS_SYSINIT_ORDER_MIDDLE
+);
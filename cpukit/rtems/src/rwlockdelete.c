@@ -0,0 +1,78 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicRWLock
+ *
+ * @brief RTEMS Delete RWLock
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/rwlockimpl.h>
+#include <rtems/rtems/statusimpl.h>
+#include <rtems/score/wkspace.h>
+
+rtems_status_code rtems_rwlock_delete(
+  rtems_id id
+)
+{
+  RWLock_Control       *the_rwlock;
+  Thread_queue_Context  queue_context;
+  Status_Control        status;
+
+  _Objects_Allocator_lock();
+  the_rwlock = _RWLock_Get( id, &queue_context );
+
+  if ( the_rwlock == NULL ) {
+    _Objects_Allocator_unlock();
+    return RTEMS_INVALID_ID;
+  }
+
+  status = _CORE_BRWLock_Close( &the_rwlock->RWLock, &queue_context );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    _Objects_Allocator_unlock();
+    return _Status_Get( status );
+  }
+
+  /*
+   * Readers which got the object before it was closed may still access the
+   * reader counters, so wait for them before the storage is freed.
+   */
+  _Objects_Close( &_RWLock_Information, &the_rwlock->Object );
+  _CORE_BRWLock_Quiesce();
+  _CORE_BRWLock_Destroy( &the_rwlock->RWLock );
+  _Workspace_Free( the_rwlock->RWLock.per_cpu );
+  _RWLock_Free( the_rwlock );
+  _Objects_Allocator_unlock();
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file
+ *
+ * @ingroup ClassicRWLock
+ *
+ * @brief RTEMS Obtain RWLock for Reading or Writing
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/rwlockimpl.h>
+#include <rtems/rtems/optionsimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+THREAD_QUEUE_OBJECT_ASSERT(
+  RWLock_Control,
+  RWLock.Wait_queue,
+  RWLOCK_CONTROL
+);
+
+static rtems_status_code _RWLock_Obtain(
+  rtems_id         id,
+  rtems_option     option_set,
+  rtems_interval   timeout,
+  Status_Control ( *seize )(
+    CORE_BRWLock_Control *,
+    Thread_Control *,
+    bool,
+    Thread_queue_Context *
+  )
+)
+{
+  RWLock_Control       *the_rwlock;
+  Thread_queue_Context  queue_context;
+  bool                  wait;
+  Status_Control        status;
+
+  the_rwlock = _RWLock_Get( id, &queue_context );
+
+  if ( the_rwlock == NULL ) {
+    return RTEMS_INVALID_ID;
+  }
+
+  wait = !_Options_Is_no_wait( option_set );
+
+  if ( wait ) {
+    _Thread_queue_Context_set_enqueue_timeout_ticks( &queue_context, timeout );
+  } else {
+    _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  }
+
+  status = ( *seize )(
+    &the_rwlock->RWLock,
+    _Thread_Executing,
+    wait,
+    &queue_context
+  );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_rwlock_obtain_read(
+  rtems_id       id,
+  rtems_option   option_set,
+  rtems_interval timeout
+)
+{
+  return _RWLock_Obtain(
+    id,
+    option_set,
+    timeout,
+    _CORE_BRWLock_Seize_for_reading
+  );
+}
+
+rtems_status_code rtems_rwlock_obtain_write(
+  rtems_id       id,
+  rtems_option   option_set,
+  rtems_interval timeout
+)
+{
+  return _RWLock_Obtain(
+    id,
+    option_set,
+    timeout,
+    _CORE_BRWLock_Seize_for_writing
+  );
+}
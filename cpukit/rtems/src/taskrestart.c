@@ -43,7 +43,7 @@ rtems_status_code rtems_task_restart(
     return RTEMS_INVALID_ID;
   }
 
-  entry = the_thread->Start.Entry;
+  entry = the_thread->Cold->Start.Entry;
   entry.Kinds.Numeric.argument = argument;
 
   if ( the_thread == _Thread_Executing ) {
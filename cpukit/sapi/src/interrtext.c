@@ -67,7 +67,8 @@ static const char *const internal_error_text[] = {
   "INTERNAL_ERROR_LIBIO_STDERR_FD_OPEN_FAILED",
   "INTERNAL_ERROR_ILLEGAL_USE_OF_FLOATING_POINT_UNIT",
   "INTERNAL_ERROR_ARC4RANDOM_GETENTROPY_FAIL",
-  "INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA"
+  "INTERNAL_ERROR_NO_MEMORY_FOR_PER_CPU_DATA",
+  "INTERNAL_ERROR_STACK_POOL_GUARD_CORRUPTED"
 };
 
 const char *rtems_internal_error_text( rtems_fatal_code error )
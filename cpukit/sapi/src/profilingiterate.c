@@ -19,6 +19,7 @@
 #include <rtems/profiling.h>
 #include <rtems/counter.h>
 #include <rtems/score/percpu.h>
+#include <rtems/score/schedulerimpl.h>
 #include <rtems/score/smplock.h>
 #include <rtems.h>
 
@@ -69,6 +70,9 @@ static void per_cpu_stats_iterate(
         stats->total_interrupt_time
       );
 
+    per_cpu_data->mutex_spin_acquire_count = stats->mutex_spin_acquire_count;
+    per_cpu_data->mutex_block_count = stats->mutex_block_count;
+
     (*visitor)(visitor_arg, data);
   }
 #else
@@ -138,6 +142,135 @@ static void smp_lock_stats_iterate(
 #endif
 }
 
+#if defined(RTEMS_PROFILING)
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS == PER_CPU_LATENCY_HISTOGRAM_BINS,
+  latency_histogram_bins
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_SCHEDULER_BLOCK
+    == (int) PER_CPU_LATENCY_SCHEDULER_BLOCK,
+  latency_scheduler_block
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_SCHEDULER_UNBLOCK
+    == (int) PER_CPU_LATENCY_SCHEDULER_UNBLOCK,
+  latency_scheduler_unblock
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_SCHEDULER_UPDATE_PRIORITY
+    == (int) PER_CPU_LATENCY_SCHEDULER_UPDATE_PRIORITY,
+  latency_scheduler_update_priority
+);
+
+RTEMS_STATIC_ASSERT(
+  (int) RTEMS_PROFILING_THREAD_DISPATCH
+    == (int) PER_CPU_LATENCY_THREAD_DISPATCH,
+  latency_thread_dispatch
+);
+#endif
+
+#if defined(RTEMS_PROFILING)
+static void latency_stats_snapshot(
+  const Per_CPU_Latency_stats *stats,
+  Per_CPU_Latency_stats *snapshot
+)
+{
+#if defined(RTEMS_SMP)
+  /*
+   * The statistics are updated by the owning processor, so we have to retry
+   * until we got a consistent copy.
+   */
+  SMP_sequence_lock_Control *lock = RTEMS_DECONST(
+    SMP_sequence_lock_Control *,
+    &stats->Lock
+  );
+  unsigned int seq;
+
+  do {
+    seq = _SMP_sequence_lock_Read_begin(lock);
+#endif
+
+    snapshot->max_time = stats->max_time;
+    snapshot->count = stats->count;
+    snapshot->total_time = stats->total_time;
+    memcpy(
+      &snapshot->histogram[0],
+      &stats->histogram[0],
+      sizeof(snapshot->histogram)
+    );
+
+#if defined(RTEMS_SMP)
+  } while (_SMP_sequence_lock_Read_retry(lock, seq));
+#endif
+}
+#endif
+
+static void scheduler_operation_stats_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  rtems_profiling_scheduler_operation *op_data = &data->scheduler_operation;
+  uint32_t n = rtems_scheduler_get_processor_maximum();
+  uint32_t i;
+  uint32_t j;
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_SCHEDULER_OPERATION;
+
+  for (j = 0; j < RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS - 1; ++j) {
+    op_data->histogram_limits[j] =
+      rtems_counter_ticks_to_nanoseconds((CPU_Counter_ticks) 1 << j);
+  }
+
+  op_data->histogram_limits[j] = UINT32_MAX;
+
+  for (i = 0; i < n; ++i) {
+    const Per_CPU_Control *per_cpu = _Per_CPU_Get_by_index(i);
+    const Scheduler_Control *scheduler = _Scheduler_Get_by_CPU(per_cpu);
+    uint32_t k;
+
+    if (scheduler == NULL) {
+      continue;
+    }
+
+    op_data->processor_index = i;
+    op_data->scheduler_name = scheduler->name;
+
+    for (k = 0; k < PER_CPU_LATENCY_COUNT; ++k) {
+      Per_CPU_Latency_stats snapshot;
+
+      latency_stats_snapshot(&per_cpu->Stats.Latency[k], &snapshot);
+
+      op_data->operation = (rtems_profiling_scheduler_operation_type) k;
+      op_data->max_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.max_time);
+      op_data->count = snapshot.count;
+      op_data->total_time =
+        rtems_counter_ticks_to_nanoseconds(snapshot.total_time);
+
+      memcpy(
+        &op_data->histogram[0],
+        &snapshot.histogram[0],
+        sizeof(op_data->histogram)
+      );
+
+      (*visitor)(visitor_arg, data);
+    }
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 void rtems_profiling_iterate(
   rtems_profiling_visitor visitor,
   void *visitor_arg
@@ -147,4 +280,5 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  scheduler_operation_stats_iterate(visitor, visitor_arg, &data);
 }
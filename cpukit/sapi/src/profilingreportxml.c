@@ -20,6 +20,7 @@
 
 #ifdef RTEMS_PROFILING
 
+#include <ctype.h>
 #include <inttypes.h>
 
 typedef struct {
@@ -148,6 +149,22 @@ static void report_per_cpu(context *ctx, const rtems_profiling_per_cpu *per_cpu)
   );
   update_retval(ctx, rv);
 
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MutexSpinAcquireCount>%" PRIu64 "</MutexSpinAcquireCount>\n",
+    per_cpu->mutex_spin_acquire_count
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MutexBlockCount>%" PRIu64 "</MutexBlockCount>\n",
+    per_cpu->mutex_block_count
+  );
+  update_retval(ctx, rv);
+
   indent(ctx, 1);
   rv = rtems_printf(
     ctx->printer,
@@ -253,6 +270,116 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static const char *scheduler_operation_name(
+  rtems_profiling_scheduler_operation_type operation
+)
+{
+  switch (operation) {
+    case RTEMS_PROFILING_SCHEDULER_BLOCK:
+      return "Block";
+    case RTEMS_PROFILING_SCHEDULER_UNBLOCK:
+      return "Unblock";
+    case RTEMS_PROFILING_SCHEDULER_UPDATE_PRIORITY:
+      return "UpdatePriority";
+    case RTEMS_PROFILING_THREAD_DISPATCH:
+      return "ThreadDispatch";
+  }
+
+  return "?";
+}
+
+static void report_scheduler_operation(
+  context *ctx,
+  const rtems_profiling_scheduler_operation *op
+)
+{
+  int rv;
+  uint32_t i;
+  char name[5];
+
+  for (i = 0; i < 4; ++i) {
+    char c = (char) (op->scheduler_name >> (24 - 8 * i));
+
+    if (!isprint((unsigned char) c) || c == '"' || c == '&' || c == '<') {
+      c = '?';
+    }
+
+    name[i] = c;
+  }
+
+  name[4] = '\0';
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<SchedulerOperationProfilingReport processorIndex=\"%" PRIu32
+      "\" scheduler=\"%s\" operation=\"%s\">\n",
+    op->processor_index,
+    name,
+    scheduler_operation_name(op->operation)
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxTime unit=\"ns\">%" PRIu32 "</MaxTime>\n",
+    op->max_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanTime unit=\"ns\">%" PRIu64 "</MeanTime>\n",
+    arithmetic_mean(op->total_time, op->count)
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalTime unit=\"ns\">%" PRIu64 "</TotalTime>\n",
+    op->total_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<Count>%" PRIu64 "</Count>\n",
+    op->count
+  );
+  update_retval(ctx, rv);
+
+  for (i = 0; i < RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS - 1; ++i) {
+    indent(ctx, 2);
+    rv = rtems_printf(
+      ctx->printer,
+      "<HistogramBin upperLimit=\"%" PRIu32 "\" unit=\"ns\">%"
+        PRIu64 "</HistogramBin>\n",
+      op->histogram_limits[i],
+      op->histogram[i]
+    );
+    update_retval(ctx, rv);
+  }
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<HistogramBin>%" PRIu64 "</HistogramBin>\n",
+    op->histogram[i]
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</SchedulerOperationProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -264,6 +391,9 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_SCHEDULER_OPERATION:
+      report_scheduler_operation(ctx, &data->scheduler_operation);
+      break;
   }
 }
 
@@ -0,0 +1,368 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSWorkQueue
+ *
+ * @brief Per-Processor Work Queue Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/workqueue.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/atomic.h>
+
+#include <sys/cpuset.h>
+
+typedef struct {
+  /**
+   * @brief The LIFO list of pending work items.
+   *
+   * Producers push work items with a compare and exchange loop.  The worker
+   * task takes the complete list with an exchange, so there is no ABA
+   * problem.
+   */
+  Atomic_Uintptr pending;
+
+  /**
+   * @brief The worker task identifier, zero if there is no worker task.
+   *
+   * It is published with a release store once the worker task is started.
+   */
+  Atomic_Uint worker;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) rtems_work_queue_control;
+
+#define RTEMS_WORK_QUEUE_UNINITIALIZED 0
+
+#define RTEMS_WORK_QUEUE_INITIALIZING 1
+
+#define RTEMS_WORK_QUEUE_INITIALIZED 2
+
+static rtems_work_queue_control
+rtems_work_queues[ CPU_MAXIMUM_PROCESSORS ];
+
+/*
+ * The initialization state is published with a release store, so that
+ * submitters on other processors which observe an initialized work queue
+ * with an acquire load also observe the worker task identifiers.
+ */
+static Atomic_Uint rtems_work_queue_state;
+
+static rtems_id rtems_work_queue_get_worker(
+  const rtems_work_queue_control *wq
+)
+{
+  return _Atomic_Load_uint( &wq->worker, ATOMIC_ORDER_ACQUIRE );
+}
+
+static rtems_work_item *rtems_work_queue_take_all(
+  rtems_work_queue_control *wq
+)
+{
+  rtems_work_item *lifo;
+  rtems_work_item *fifo;
+
+  lifo = (rtems_work_item *) _Atomic_Exchange_uintptr(
+    &wq->pending,
+    0,
+    ATOMIC_ORDER_ACQUIRE
+  );
+  fifo = NULL;
+
+  while ( lifo != NULL ) {
+    rtems_work_item *next;
+
+    next = lifo->next;
+    lifo->next = fifo;
+    fifo = lifo;
+    lifo = next;
+  }
+
+  return fifo;
+}
+
+static void rtems_work_queue_worker( rtems_task_argument arg )
+{
+  rtems_work_queue_control *wq;
+
+  wq = (rtems_work_queue_control *) arg;
+
+  while ( true ) {
+    rtems_event_set  events;
+    rtems_work_item *item;
+
+    (void) rtems_event_system_receive(
+      RTEMS_EVENT_SYSTEM_SERVER,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+
+    item = rtems_work_queue_take_all( wq );
+
+    while ( item != NULL ) {
+      rtems_work_item *next;
+
+      /*
+       * Once the work item is no longer pending, it may be submitted again
+       * and its next member is overwritten.
+       */
+      next = item->next;
+      atomic_store_explicit( &item->pending, 0, memory_order_release );
+      ( *item->handler )( item );
+      item = next;
+    }
+  }
+}
+
+static void rtems_work_queue_delete_workers( uint32_t cpu_max )
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    rtems_work_queue_control *wq;
+
+    rtems_id                  worker;
+
+    wq = &rtems_work_queues[ cpu_index ];
+    worker = rtems_work_queue_get_worker( wq );
+
+    if ( worker != 0 ) {
+      (void) rtems_task_delete( worker );
+      _Atomic_Store_uint( &wq->worker, 0, ATOMIC_ORDER_RELAXED );
+    }
+  }
+}
+
+void rtems_work_item_initialize(
+  rtems_work_item    *item,
+  rtems_work_handler  handler
+)
+{
+  item->next = NULL;
+  item->handler = handler;
+  atomic_init( &item->pending, 0 );
+}
+
+rtems_status_code rtems_work_queue_initialize(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_mode          modes,
+  rtems_attribute     attributes
+)
+{
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+  unsigned int state;
+
+  state = RTEMS_WORK_QUEUE_UNINITIALIZED;
+
+  if (
+    !_Atomic_Compare_exchange_uint(
+      &rtems_work_queue_state,
+      &state,
+      RTEMS_WORK_QUEUE_INITIALIZING,
+      ATOMIC_ORDER_ACQUIRE,
+      ATOMIC_ORDER_RELAXED
+    )
+  ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( rtems_work_queues ) );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    rtems_work_queue_control *wq;
+    rtems_status_code         sc;
+    rtems_id                  worker;
+    rtems_id                  scheduler;
+#if defined(RTEMS_SMP)
+    cpu_set_t                 cpu;
+#endif
+
+    wq = &rtems_work_queues[ cpu_index ];
+    _Atomic_Init_uintptr( &wq->pending, 0 );
+    _Atomic_Init_uint( &wq->worker, 0 );
+
+    sc = rtems_scheduler_ident_by_processor( cpu_index, &scheduler );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      /* Do not start a worker task on a processor without a scheduler */
+      continue;
+    }
+
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', 'K' ),
+      priority,
+      stack_size,
+      modes,
+      attributes,
+      &worker
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      rtems_work_queue_delete_workers( cpu_index );
+      _Atomic_Store_uint(
+        &rtems_work_queue_state,
+        RTEMS_WORK_QUEUE_UNINITIALIZED,
+        ATOMIC_ORDER_RELEASE
+      );
+      return sc;
+    }
+
+#if defined(RTEMS_SMP)
+    sc = rtems_task_set_scheduler( worker, scheduler, priority );
+
+    if ( sc == RTEMS_SUCCESSFUL ) {
+      sc = rtems_scheduler_get_processor_set( scheduler, sizeof( cpu ), &cpu );
+    }
+
+    /*
+     * A scheduler which owns only this processor keeps the worker task on it.
+     * Such schedulers may not support an arbitrary affinity, for example the
+     * uniprocessor schedulers.
+     */
+    if (
+      sc == RTEMS_SUCCESSFUL
+        && ( CPU_COUNT( &cpu ) != 1 || !CPU_ISSET( (int) cpu_index, &cpu ) )
+    ) {
+      CPU_ZERO( &cpu );
+      CPU_SET( (int) cpu_index, &cpu );
+      sc = rtems_task_set_affinity( worker, sizeof( cpu ), &cpu );
+    }
+
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      /*
+       * A worker task which may run on other processors would break the
+       * contract of rtems_work_item_submit().
+       */
+      (void) rtems_task_delete( worker );
+      rtems_work_queue_delete_workers( cpu_index );
+      _Atomic_Store_uint(
+        &rtems_work_queue_state,
+        RTEMS_WORK_QUEUE_UNINITIALIZED,
+        ATOMIC_ORDER_RELEASE
+      );
+      return sc;
+    }
+#endif
+
+    sc = rtems_task_start(
+      worker,
+      rtems_work_queue_worker,
+      (rtems_task_argument) wq
+    );
+    _Assert( sc == RTEMS_SUCCESSFUL );
+    (void) sc;
+
+    _Atomic_Store_uint( &wq->worker, worker, ATOMIC_ORDER_RELEASE );
+  }
+
+  _Atomic_Store_uint(
+    &rtems_work_queue_state,
+    RTEMS_WORK_QUEUE_INITIALIZED,
+    ATOMIC_ORDER_RELEASE
+  );
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_item_submit(
+  rtems_work_item *item,
+  uint32_t         cpu_index
+)
+{
+  rtems_work_queue_control *wq;
+  rtems_id                  worker;
+  unsigned int              pending;
+  uintptr_t                 head;
+
+  if (
+    _Atomic_Load_uint( &rtems_work_queue_state, ATOMIC_ORDER_ACQUIRE )
+      != RTEMS_WORK_QUEUE_INITIALIZED
+  ) {
+    return RTEMS_INCORRECT_STATE;
+  }
+
+  if ( cpu_index >= rtems_scheduler_get_processor_maximum() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  wq = &rtems_work_queues[ cpu_index ];
+  worker = rtems_work_queue_get_worker( wq );
+
+  if ( worker == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  pending = 0;
+
+  if (
+    !atomic_compare_exchange_strong_explicit(
+      &item->pending,
+      &pending,
+      1,
+      memory_order_relaxed,
+      memory_order_relaxed
+    )
+  ) {
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  head = _Atomic_Load_uintptr( &wq->pending, ATOMIC_ORDER_RELAXED );
+
+  do {
+    item->next = (rtems_work_item *) head;
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      &wq->pending,
+      &head,
+      (uintptr_t) item,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  /*
+   * Only wake up the worker task if the work queue was empty.  Otherwise, the
+   * worker task has a pending wake up event or is about to take the list of
+   * pending work items.  This batches the inter-processor interrupts.
+   */
+  if ( head == 0 ) {
+    (void) rtems_event_system_send( worker, RTEMS_EVENT_SYSTEM_SERVER );
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_work_item_submit_local( rtems_work_item *item )
+{
+  return rtems_work_item_submit( item, rtems_scheduler_get_processor() );
+}
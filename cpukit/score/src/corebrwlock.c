@@ -0,0 +1,134 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRWLock
+ *
+ * @brief Big Reader RWLock Initialization
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/corebrwlockimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threaddispatch.h>
+
+void _CORE_BRWLock_Initialize(
+  CORE_BRWLock_Control *the_rwlock,
+  CORE_BRWLock_Per_CPU *per_cpu
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  _Thread_queue_Object_initialize( &the_rwlock->Wait_queue );
+  _Atomic_Init_uint( &the_rwlock->writer, 0 );
+  the_rwlock->write_owner = NULL;
+  the_rwlock->draining_writer = NULL;
+  the_rwlock->pending_readers = 0;
+  the_rwlock->per_cpu = per_cpu;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    _Atomic_Init_uint( &per_cpu[ cpu_index ].readers, 0 );
+  }
+}
+
+unsigned int _CORE_BRWLock_Get_number_of_readers(
+  const CORE_BRWLock_Control *the_rwlock
+)
+{
+  uint32_t     cpu_max;
+  uint32_t     cpu_index;
+  unsigned int readers;
+
+  cpu_max = _SMP_Get_processor_maximum();
+  readers = 0;
+
+  /*
+   * A reader may release the lock on another processor, so individual
+   * counters may wrap around.  Only the sum is meaningful.
+   */
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    readers += _Atomic_Load_uint(
+      &the_rwlock->per_cpu[ cpu_index ].readers,
+      ATOMIC_ORDER_SEQ_CST
+    );
+  }
+
+  return readers;
+}
+
+bool _CORE_BRWLock_Is_in_use( const CORE_BRWLock_Control *the_rwlock )
+{
+  return _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_RELAXED ) != 0
+    || _CORE_BRWLock_Get_number_of_readers( the_rwlock ) != 0
+    || the_rwlock->pending_readers != 0
+    || !_Thread_queue_Is_empty( &the_rwlock->Wait_queue.Queue );
+}
+
+Status_Control _CORE_BRWLock_Close(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+
+  if ( _CORE_BRWLock_Is_in_use( the_rwlock ) ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_RESOURCE_IN_USE;
+  }
+
+  /*
+   * Readers which already passed the reader counter check of the fast path
+   * are accounted in the reader counters, so they are observed above.  All
+   * other readers observe the closed lock and back out.
+   */
+  _Atomic_Store_uint(
+    &the_rwlock->writer,
+    CORE_BRWLOCK_CLOSED,
+    ATOMIC_ORDER_SEQ_CST
+  );
+  _CORE_BRWLock_Release( the_rwlock, queue_context );
+  return STATUS_SUCCESSFUL;
+}
+
+void _CORE_BRWLock_Quiesce( void )
+{
+#if defined(RTEMS_SMP)
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Synchronize();
+  _Thread_Dispatch_enable( cpu_self );
+#endif
+}
@@ -0,0 +1,253 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRWLock
+ *
+ * @brief Big Reader RWLock Obtain for Reading and Writing
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/corebrwlockimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+Status_Control _CORE_BRWLock_Seize_for_reading(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_BRWLock_Control **entry;
+  unsigned int           writer;
+  Status_Control         status;
+
+  /*
+   * A recursive obtain operation would deadlock with a draining writer,
+   * since the writer waits for this thread to leave and this thread waits
+   * for the writer.
+   */
+  if (
+    the_rwlock->write_owner == executing
+      || _CORE_BRWLock_Get_read_entry( executing, the_rwlock ) != NULL
+  ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_DEADLOCK;
+  }
+
+  entry = _CORE_BRWLock_Get_read_entry( executing, NULL );
+
+  if ( entry == NULL ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_TOO_MANY;
+  }
+
+  /*
+   * Announce this reader on the current processor and check for a writer
+   * afterwards.  A writer sets its indicator first and then sums up the
+   * reader counters.  The sequentially consistent operations ensure that
+   * at least one side observes the other.
+   */
+  _Atomic_Fetch_add_uint(
+    _CORE_BRWLock_Get_reader_counter( the_rwlock ),
+    1,
+    ATOMIC_ORDER_SEQ_CST
+  );
+
+  if ( _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_SEQ_CST ) == 0 ) {
+    *entry = the_rwlock;
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * There is a writer or the lock is closed, so back out.  This may complete
+   * the drain of a waiting writer.  Interrupts stay disabled until the
+   * thread queue is acquired, see _CORE_BRWLock_Quiesce().
+   */
+  _Atomic_Fetch_sub_uint(
+    _CORE_BRWLock_Get_reader_counter( the_rwlock ),
+    1,
+    ATOMIC_ORDER_SEQ_CST
+  );
+  _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+
+  /*
+   * The hand over enables interrupts.  The pending reader prevents that the
+   * lock is closed before we acquired the thread queue again.
+   */
+  ++the_rwlock->pending_readers;
+
+  if ( _CORE_BRWLock_Hand_over_to_writer( the_rwlock, queue_context ) ) {
+    ISR_Level level;
+
+    _Thread_queue_Context_ISR_disable( queue_context, level );
+    _Thread_queue_Context_set_ISR_level( queue_context, level );
+    _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+  }
+
+  --the_rwlock->pending_readers;
+  writer = _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_RELAXED );
+
+  if ( writer == CORE_BRWLOCK_CLOSED ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_OBJECT_WAS_DELETED;
+  }
+
+  if ( writer == 0 ) {
+    _Atomic_Fetch_add_uint(
+      _CORE_BRWLock_Get_reader_counter( the_rwlock ),
+      1,
+      ATOMIC_ORDER_SEQ_CST
+    );
+    *entry = the_rwlock;
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_UNAVAILABLE;
+  }
+
+  executing->Wait.option = CORE_BRWLOCK_THREAD_WAITING_FOR_READ;
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_RWLOCK
+  );
+  _Thread_queue_Enqueue(
+    &the_rwlock->Wait_queue.Queue,
+    CORE_BRWLOCK_TQ_OPERATIONS,
+    executing,
+    queue_context
+  );
+  status = _Thread_Wait_get_status( executing );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *entry = the_rwlock;
+  }
+
+  return status;
+}
+
+Status_Control _CORE_BRWLock_Seize_for_writing(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  bool                  wait,
+  Thread_queue_Context *queue_context
+)
+{
+  unsigned int   writer;
+  Status_Control status;
+  ISR_Level      level;
+
+  if (
+    the_rwlock->write_owner == executing
+      || _CORE_BRWLock_Get_read_entry( executing, the_rwlock ) != NULL
+  ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_DEADLOCK;
+  }
+
+  _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+  writer = _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_RELAXED );
+
+  if ( writer == CORE_BRWLOCK_CLOSED ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_OBJECT_WAS_DELETED;
+  }
+
+  executing->Wait.option = CORE_BRWLOCK_THREAD_WAITING_FOR_WRITE;
+
+  if ( writer == 0 ) {
+    _Atomic_Store_uint( &the_rwlock->writer, 1, ATOMIC_ORDER_SEQ_CST );
+
+    if ( _CORE_BRWLock_Get_number_of_readers( the_rwlock ) == 0 ) {
+      the_rwlock->write_owner = executing;
+      _CORE_BRWLock_Release( the_rwlock, queue_context );
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      _Atomic_Store_uint( &the_rwlock->writer, 0, ATOMIC_ORDER_SEQ_CST );
+      _CORE_BRWLock_Release( the_rwlock, queue_context );
+      return STATUS_UNAVAILABLE;
+    }
+
+    /* The last reader hands over the lock to us */
+    the_rwlock->draining_writer = executing;
+    executing->Wait.option = CORE_BRWLOCK_THREAD_DRAINING;
+  } else if ( !wait ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+    return STATUS_UNAVAILABLE;
+  }
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_RWLOCK
+  );
+  _Thread_queue_Enqueue(
+    &the_rwlock->Wait_queue.Queue,
+    CORE_BRWLOCK_TQ_OPERATIONS,
+    executing,
+    queue_context
+  );
+  status = _Thread_Wait_get_status( executing );
+
+  /*
+   * Only a draining writer has to clean up.  As the draining writer, the
+   * lock is in use and cannot be closed, otherwise the lock must not be
+   * accessed after a timeout.
+   */
+  if (
+    status != STATUS_SUCCESSFUL
+      && executing->Wait.option == CORE_BRWLOCK_THREAD_DRAINING
+  ) {
+    _Thread_queue_Context_ISR_disable( queue_context, level );
+    _Thread_queue_Context_set_ISR_level( queue_context, level );
+    _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+
+    if ( the_rwlock->draining_writer == executing ) {
+      /*
+       * We gave up while the readers drained, so withdraw the writer
+       * indicator and let the blocked readers in.
+       */
+      the_rwlock->draining_writer = NULL;
+      _CORE_BRWLock_Release_writer( the_rwlock, queue_context );
+    } else {
+      _CORE_BRWLock_Release( the_rwlock, queue_context );
+    }
+  }
+
+  return status;
+}
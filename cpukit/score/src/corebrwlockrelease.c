@@ -0,0 +1,183 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreBRWLock
+ *
+ * @brief Big Reader RWLock Release
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/corebrwlockimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/threadimpl.h>
+
+bool _CORE_BRWLock_Hand_over_to_writer(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  Thread_Control *draining_writer;
+
+  draining_writer = the_rwlock->draining_writer;
+
+  /*
+   * The draining writer may have been extracted from the thread queue due to
+   * a timeout, in this case it will clean up on its own.
+   */
+  if (
+    draining_writer == NULL
+      || draining_writer->Wait.queue == NULL
+      || _CORE_BRWLock_Get_number_of_readers( the_rwlock ) != 0
+  ) {
+    return false;
+  }
+
+  the_rwlock->draining_writer = NULL;
+  the_rwlock->write_owner = draining_writer;
+  _Thread_queue_Extract_critical(
+    &the_rwlock->Wait_queue.Queue,
+    CORE_BRWLOCK_TQ_OPERATIONS,
+    draining_writer,
+    queue_context
+  );
+  return true;
+}
+
+void _CORE_BRWLock_Reader_leave(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  _Atomic_Fetch_sub_uint(
+    _CORE_BRWLock_Get_reader_counter( the_rwlock ),
+    1,
+    ATOMIC_ORDER_SEQ_CST
+  );
+
+  if ( _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_SEQ_CST ) == 0 ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return;
+  }
+
+  _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+
+  if ( !_CORE_BRWLock_Hand_over_to_writer( the_rwlock, queue_context ) ) {
+    _CORE_BRWLock_Release( the_rwlock, queue_context );
+  }
+}
+
+static Thread_Control *_CORE_BRWLock_Flush_filter(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_BRWLock_Control *the_rwlock;
+
+  the_rwlock = RTEMS_CONTAINER_OF(
+    queue,
+    CORE_BRWLock_Control,
+    Wait_queue.Queue
+  );
+
+  if ( _Atomic_Load_uint( &the_rwlock->writer, ATOMIC_ORDER_RELAXED ) != 0 ) {
+    return NULL;
+  }
+
+  if ( the_thread->Wait.option == CORE_BRWLOCK_THREAD_WAITING_FOR_READ ) {
+    _Atomic_Fetch_add_uint(
+      _CORE_BRWLock_Get_reader_counter( the_rwlock ),
+      1,
+      ATOMIC_ORDER_SEQ_CST
+    );
+    return the_thread;
+  }
+
+  _Assert( the_thread->Wait.option == CORE_BRWLOCK_THREAD_WAITING_FOR_WRITE );
+  _Atomic_Store_uint( &the_rwlock->writer, 1, ATOMIC_ORDER_SEQ_CST );
+
+  if ( _CORE_BRWLock_Get_number_of_readers( the_rwlock ) == 0 ) {
+    the_rwlock->write_owner = the_thread;
+    return the_thread;
+  }
+
+  /* Readers granted by this flush or fast path readers are still in */
+  the_rwlock->draining_writer = the_thread;
+  the_thread->Wait.option = CORE_BRWLOCK_THREAD_DRAINING;
+  return NULL;
+}
+
+void _CORE_BRWLock_Release_writer(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_queue_Context *queue_context
+)
+{
+  the_rwlock->write_owner = NULL;
+  _Atomic_Store_uint( &the_rwlock->writer, 0, ATOMIC_ORDER_SEQ_CST );
+  _Thread_queue_Flush_critical(
+    &the_rwlock->Wait_queue.Queue,
+    CORE_BRWLOCK_TQ_OPERATIONS,
+    _CORE_BRWLock_Flush_filter,
+    queue_context
+  );
+}
+
+Status_Control _CORE_BRWLock_Surrender(
+  CORE_BRWLock_Control *the_rwlock,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_BRWLock_Control **entry;
+
+  if ( the_rwlock->write_owner == executing ) {
+    _CORE_BRWLock_Acquire_critical( the_rwlock, queue_context );
+    _CORE_BRWLock_Release_writer( the_rwlock, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * A release by a thread which does not own the lock would corrupt the
+   * reader counters.
+   */
+  entry = _CORE_BRWLock_Get_read_entry( executing, the_rwlock );
+
+  if ( entry == NULL ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_NOT_OWNER;
+  }
+
+  *entry = NULL;
+  _CORE_BRWLock_Reader_leave( the_rwlock, queue_context );
+  return STATUS_SUCCESSFUL;
+}
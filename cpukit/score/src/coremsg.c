@@ -53,6 +53,7 @@ bool _CORE_message_queue_Initialize(
   size_t aligned_message_size;
   size_t align_mask;
 
+  the_message_queue->ring                       = NULL;
   the_message_queue->maximum_pending_messages   = maximum_pending_messages;
   the_message_queue->number_of_pending_messages = 0;
   the_message_queue->maximum_message_size       = maximum_message_size;
@@ -105,6 +106,7 @@ bool _CORE_message_queue_Initialize(
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
 
   _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
+  _Thread_queue_Initialize( &the_message_queue->Loan_wait_queue, NULL );
 
   if ( discipline == CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY ) {
     the_message_queue->operations = &_Thread_queue_Operations_priority;
@@ -40,7 +40,8 @@ void _CORE_message_queue_Close(
 
   /*
    *  This will flush blocked threads whether they were blocked on
-   *  a send or receive.
+   *  a send or receive.  Threads waiting for a loaned message buffer
+   *  use a separate thread queue.
    */
 
   _Thread_queue_Flush_critical(
@@ -50,7 +51,17 @@ void _CORE_message_queue_Close(
     queue_context
   );
 
+  _Thread_queue_Acquire( &the_message_queue->Loan_wait_queue, queue_context );
+  _Thread_queue_Flush_critical(
+    &the_message_queue->Loan_wait_queue.Queue,
+    the_message_queue->operations,
+    _CORE_message_queue_Was_deleted,
+    queue_context
+  );
+
   (void) _Workspace_Free( the_message_queue->message_buffers );
+  _Workspace_Free( the_message_queue->ring );
 
   _Thread_queue_Destroy( &the_message_queue->Wait_queue );
+  _Thread_queue_Destroy( &the_message_queue->Loan_wait_queue );
 }
@@ -61,6 +61,18 @@ uint32_t   _CORE_message_queue_Flush(
 
   _CORE_message_queue_Acquire_critical( the_message_queue, queue_context );
 
+  if ( the_message_queue->ring != NULL ) {
+    if ( _CORE_message_queue_Ring_enter( the_message_queue ) ) {
+      count = _CORE_message_queue_Ring_flush( the_message_queue );
+      _CORE_message_queue_Ring_leave( the_message_queue );
+    } else {
+      count = 0;
+    }
+
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return count;
+  }
+
   count = the_message_queue->number_of_pending_messages;
   if ( count != 0 ) {
     the_message_queue->number_of_pending_messages = 0;
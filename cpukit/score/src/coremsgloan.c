@@ -0,0 +1,336 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Message Buffer Loans
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+Status_Control _CORE_message_queue_Loan(
+  CORE_message_queue_Control         *the_message_queue,
+  CORE_message_queue_Buffer_control **the_message_p,
+  Thread_queue_Context               *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  _Assert( the_message_queue->ring == NULL );
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+
+  if ( the_message == NULL ) {
+    return STATUS_TOO_MANY;
+  }
+
+  _Chain_Set_off_chain( &the_message->Node );
+  *the_message_p = the_message;
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Commit(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  _Assert( _Chain_Is_node_off_chain( &the_message->Node ) );
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  the_message->Contents.size = size;
+
+  /*
+   *  If there are no pending messages, then there may be a thread waiting to
+   *  receive a message.
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    Thread_Control *the_thread;
+
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+
+    /*
+     *  Threads waiting to send a message have no return argument.  While
+     *  receivers wait, there are no senders waiting, so the message buffer
+     *  can be freed after the copy.
+     */
+    if ( the_thread != NULL && the_thread->Wait.return_argument != NULL ) {
+      *(size_t *) the_thread->Wait.return_argument = size;
+      _CORE_message_queue_Copy_buffer(
+        the_message->Contents.buffer,
+        the_thread->Wait.return_argument_second.mutable_object,
+        size
+      );
+      _CORE_message_queue_Free_message_buffer(
+        the_message_queue,
+        the_message
+      );
+
+      the_thread->Wait.count = (uint32_t) submit_type;
+      _Thread_queue_Extract_critical(
+        &the_message_queue->Wait_queue.Queue,
+        the_message_queue->operations,
+        the_thread,
+        queue_context
+      );
+      return STATUS_SUCCESSFUL;
+    }
+
+    the_thread = _CORE_message_queue_Dequeue_loan_receiver(
+      the_message_queue,
+      the_message,
+      NULL,
+      size,
+      submit_type,
+      queue_context
+    );
+    if ( the_thread != NULL ) {
+      return STATUS_SUCCESSFUL;
+    }
+  }
+
+  _CORE_message_queue_Enqueue_message(
+    the_message_queue,
+    the_message,
+    submit_type
+  );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_loan(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  ISR_lock_Context                   lock_context;
+
+  _Assert( the_message_queue->ring == NULL );
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+    *the_message_p = the_message;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  /*
+   *  We wait in a separate thread queue, since threads waiting to send a
+   *  message may wait at the same time if all message buffers are loaned,
+   *  see _CORE_message_queue_Dequeue_loan_receiver().
+   */
+  executing->Wait.return_argument_second.mutable_object = NULL;
+  executing->Wait.return_argument = the_message_p;
+
+  _CORE_message_queue_Acquire_loan_receivers(
+    the_message_queue,
+    queue_context,
+    &lock_context
+  );
+  _CORE_message_queue_Hand_over_to_loan_receivers(
+    the_message_queue,
+    queue_context,
+    &lock_context
+  );
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Loan_wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+void _CORE_message_queue_Return(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+)
+{
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+  Thread_Control *the_thread;
+
+  _Assert( _Chain_Is_node_off_chain( &the_message->Node ) );
+
+  /*
+   *  There could be a thread waiting to send a message.  In this case, the
+   *  message is placed in the message buffer on behalf of the waiting
+   *  thread.
+   */
+  the_thread = _Thread_queue_First_locked(
+    &the_message_queue->Wait_queue,
+    the_message_queue->operations
+  );
+  if ( the_thread != NULL && the_thread->Wait.return_argument == NULL ) {
+    ISR_lock_Context  lock_context;
+    Thread_Control   *the_receiver;
+    Per_CPU_Control  *cpu_self;
+    bool              unblock_sender;
+    bool              unblock_receiver;
+
+    _CORE_message_queue_Acquire_loan_receivers(
+      the_message_queue,
+      queue_context,
+      &lock_context
+    );
+
+    the_receiver = _Thread_queue_First_locked(
+      &the_message_queue->Loan_wait_queue,
+      the_message_queue->operations
+    );
+    if ( the_receiver == NULL ) {
+      _CORE_message_queue_Release_loan_receivers(
+        the_message_queue,
+        &lock_context
+      );
+      _CORE_message_queue_Insert_message(
+        the_message_queue,
+        the_message,
+        the_thread->Wait.return_argument_second.immutable_object,
+        (size_t) the_thread->Wait.option,
+        (CORE_message_queue_Submit_types) the_thread->Wait.count
+      );
+      _Thread_queue_Extract_critical(
+        &the_message_queue->Wait_queue.Queue,
+        the_message_queue->operations,
+        the_thread,
+        queue_context
+      );
+      return;
+    }
+
+    /*
+     *  A thread waits to receive a loaned message buffer.  Hand over the
+     *  message of the waiting sender to it and unblock both threads.
+     */
+    the_message->Contents.size = (size_t) the_thread->Wait.option;
+    _CORE_message_queue_Copy_buffer(
+      the_thread->Wait.return_argument_second.immutable_object,
+      the_message->Contents.buffer,
+      the_message->Contents.size
+    );
+    *(CORE_message_queue_Buffer_control **)
+      the_receiver->Wait.return_argument = the_message;
+    the_receiver->Wait.count = the_thread->Wait.count;
+
+    unblock_sender = _Thread_queue_Extract_locked(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      the_thread,
+      queue_context
+    );
+    unblock_receiver = _Thread_queue_Extract_locked(
+      &the_message_queue->Loan_wait_queue.Queue,
+      the_message_queue->operations,
+      the_receiver,
+      queue_context
+    );
+
+    cpu_self = _Thread_Dispatch_disable_critical(
+      &queue_context->Lock_context.Lock_context
+    );
+    _CORE_message_queue_Release_loan_receivers(
+      the_message_queue,
+      &lock_context
+    );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+
+    if ( unblock_sender ) {
+      _Thread_Remove_timer_and_unblock(
+        the_thread,
+        &the_message_queue->Wait_queue.Queue
+      );
+    }
+
+    if ( unblock_receiver ) {
+      _Thread_Remove_timer_and_unblock(
+        the_receiver,
+        &the_message_queue->Loan_wait_queue.Queue
+      );
+    }
+
+    _Thread_Dispatch_enable( cpu_self );
+    return;
+  }
+#endif
+
+  _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+}
@@ -0,0 +1,459 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Lock-Free Message Queue Ring
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ * The ring is a bounded queue in which each slot carries a sequence number.
+ * A slot with a sequence number equal to the enqueue position is free.  A
+ * slot with a sequence number equal to the enqueue position plus one
+ * contains a message.  Producers reserve a slot by advancing the enqueue
+ * position, multiple producers do this with a compare and exchange.
+ * Consumers reserve a message by advancing the dequeue position with a
+ * compare and exchange.  So, a receiver, a flush, and a sender which fetches
+ * a message on behalf of a blocked receiver may consume concurrently.
+ *
+ * The ring operations are carried out with interrupts disabled, so a
+ * producer cannot be preempted on its processor while it owns a reserved
+ * slot.
+ *
+ * The ring memory is freed by the message queue deletion.  Each lock-free
+ * operation is accounted in the ring users count of the message queue.  The
+ * deletion marks the ring as closed and waits until the operations in
+ * progress ended, see _CORE_message_queue_Ring_close().
+ */
+
+static CORE_message_queue_Ring_slot *_CORE_message_queue_Ring_slot(
+  const CORE_message_queue_Ring *ring,
+  unsigned int                   position
+)
+{
+  return (CORE_message_queue_Ring_slot *)
+    &ring->slots[ ( position & ring->mask ) * ring->slot_size ];
+}
+
+static bool _CORE_message_queue_Ring_push(
+  CORE_message_queue_Ring *ring,
+  const void              *buffer,
+  size_t                   size
+)
+{
+  CORE_message_queue_Ring_slot *slot;
+  unsigned int                  position;
+  unsigned int                  sequence;
+
+  position = _Atomic_Load_uint( &ring->enqueue_position, ATOMIC_ORDER_RELAXED );
+
+  if ( ring->multiple_producers ) {
+    while ( true ) {
+      int difference;
+
+      slot = _CORE_message_queue_Ring_slot( ring, position );
+      sequence = _Atomic_Load_uint( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+      difference = (int) ( sequence - position );
+
+      if ( difference == 0 ) {
+        if (
+          _Atomic_Compare_exchange_uint(
+            &ring->enqueue_position,
+            &position,
+            position + 1,
+            ATOMIC_ORDER_RELAXED,
+            ATOMIC_ORDER_RELAXED
+          )
+        ) {
+          break;
+        }
+      } else if ( difference < 0 ) {
+        return false;
+      } else {
+        position = _Atomic_Load_uint(
+          &ring->enqueue_position,
+          ATOMIC_ORDER_RELAXED
+        );
+      }
+    }
+  } else {
+    slot = _CORE_message_queue_Ring_slot( ring, position );
+    sequence = _Atomic_Load_uint( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+
+    if ( sequence != position ) {
+      return false;
+    }
+
+    _Atomic_Store_uint(
+      &ring->enqueue_position,
+      position + 1,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+
+  slot->Contents.size = size;
+  _CORE_message_queue_Copy_buffer( buffer, slot->Contents.buffer, size );
+  _Atomic_Store_uint( &slot->sequence, position + 1, ATOMIC_ORDER_RELEASE );
+  return true;
+}
+
+static bool _CORE_message_queue_Ring_pop(
+  CORE_message_queue_Ring *ring,
+  void                    *buffer,
+  size_t                  *size_p
+)
+{
+  CORE_message_queue_Ring_slot *slot;
+  unsigned int                  position;
+  unsigned int                  sequence;
+
+  position = _Atomic_Load_uint( &ring->dequeue_position, ATOMIC_ORDER_RELAXED );
+
+  while ( true ) {
+    int difference;
+
+    slot = _CORE_message_queue_Ring_slot( ring, position );
+    sequence = _Atomic_Load_uint( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+    difference = (int) ( sequence - ( position + 1 ) );
+
+    if ( difference == 0 ) {
+      if (
+        _Atomic_Compare_exchange_uint(
+          &ring->dequeue_position,
+          &position,
+          position + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( difference < 0 ) {
+      return false;
+    } else {
+      position = _Atomic_Load_uint(
+        &ring->dequeue_position,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  if ( buffer != NULL ) {
+    *size_p = slot->Contents.size;
+    _CORE_message_queue_Copy_buffer(
+      slot->Contents.buffer,
+      buffer,
+      slot->Contents.size
+    );
+  }
+
+  _Atomic_Store_uint(
+    &slot->sequence,
+    position + ring->mask + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+  return true;
+}
+
+bool _CORE_message_queue_Initialize_ring(
+  CORE_message_queue_Control     *the_message_queue,
+  CORE_message_queue_Disciplines  discipline,
+  uint32_t                        maximum_pending_messages,
+  size_t                          maximum_message_size,
+  bool                            multiple_producers
+)
+{
+  CORE_message_queue_Ring *ring;
+  size_t                   align_mask;
+  size_t                   slot_size;
+  size_t                   size;
+  uint32_t                 i;
+
+  _Assert( maximum_pending_messages > 0 );
+  _Assert(
+    ( maximum_pending_messages & ( maximum_pending_messages - 1 ) ) == 0
+  );
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  slot_size = ( maximum_message_size + align_mask ) & ~align_mask;
+
+  if ( slot_size < maximum_message_size ) {
+    return false;
+  }
+
+  slot_size += offsetof( CORE_message_queue_Ring_slot, Contents.buffer );
+  slot_size = ( slot_size + align_mask ) & ~align_mask;
+
+  if ( slot_size > ( SIZE_MAX - sizeof( *ring ) ) / maximum_pending_messages ) {
+    return false;
+  }
+
+  size = sizeof( *ring ) + slot_size * maximum_pending_messages;
+  ring = _Workspace_Allocate_aligned( size, CPU_CACHE_LINE_BYTES );
+
+  if ( ring == NULL ) {
+    return false;
+  }
+
+  ring->slots = (char *) ( ring + 1 );
+  ring->slot_size = slot_size;
+  ring->mask = maximum_pending_messages - 1;
+  ring->multiple_producers = multiple_producers;
+  _Atomic_Init_uint( &ring->waiting_receivers, 0 );
+  _Atomic_Init_uint( &the_message_queue->ring_users, 0 );
+  _Atomic_Init_uint( &ring->enqueue_position, 0 );
+  _Atomic_Init_uint( &ring->dequeue_position, 0 );
+
+  for ( i = 0; i < maximum_pending_messages; ++i ) {
+    _Atomic_Init_uint( &_CORE_message_queue_Ring_slot( ring, i )->sequence, i );
+  }
+
+  the_message_queue->ring = ring;
+  the_message_queue->message_buffers = NULL;
+  the_message_queue->maximum_pending_messages = maximum_pending_messages;
+  the_message_queue->number_of_pending_messages = 0;
+  the_message_queue->maximum_message_size = maximum_message_size;
+  _CORE_message_queue_Set_notify( the_message_queue, NULL );
+  _Chain_Initialize_empty( &the_message_queue->Inactive_messages );
+  _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+  _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
+  _Thread_queue_Initialize( &the_message_queue->Loan_wait_queue, NULL );
+
+  if ( discipline == CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY ) {
+    the_message_queue->operations = &_Thread_queue_Operations_priority;
+  } else {
+    the_message_queue->operations = &_Thread_queue_Operations_FIFO;
+  }
+
+  return true;
+}
+
+Status_Control _CORE_message_queue_Ring_submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Ring *ring;
+  Thread_Control          *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  if ( !_CORE_message_queue_Ring_enter( the_message_queue ) ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_MESSAGE_QUEUE_WAS_DELETED;
+  }
+
+  ring = the_message_queue->ring;
+
+  if ( !_CORE_message_queue_Ring_push( ring, buffer, size ) ) {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_TOO_MANY;
+  }
+
+  /*
+   * This fence pairs with the fence in _CORE_message_queue_Ring_seize().
+   * Either we observe the waiting receiver or the receiver observes the
+   * message.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if (
+    _Atomic_Load_uint( &ring->waiting_receivers, ATOMIC_ORDER_RELAXED ) == 0
+  ) {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Acquire_critical( the_message_queue, queue_context );
+
+  the_thread = _Thread_queue_First_locked(
+    &the_message_queue->Wait_queue,
+    the_message_queue->operations
+  );
+
+  /*
+   * A receiver blocks only if the ring is empty.  While it is blocked, we act
+   * as a consumer on its behalf.  Concurrent wake ups are serialized by the
+   * message queue lock.  The pop fails if another receiver or a flush
+   * consumed the message in the meantime.
+   */
+  if ( the_thread == NULL ) {
+    _Atomic_Store_uint( &ring->waiting_receivers, 0, ATOMIC_ORDER_RELAXED );
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  } else if (
+    _CORE_message_queue_Ring_pop(
+      ring,
+      the_thread->Wait.return_argument_second.mutable_object,
+      (size_t *) the_thread->Wait.return_argument
+    )
+  ) {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    the_thread->Wait.count = CORE_MESSAGE_QUEUE_SEND_REQUEST;
+    _Thread_queue_Extract_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      the_thread,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Ring_seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Ring *ring;
+
+  if ( !_CORE_message_queue_Ring_enter( the_message_queue ) ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_MESSAGE_QUEUE_WAS_DELETED;
+  }
+
+  ring = the_message_queue->ring;
+  executing->Wait.count = CORE_MESSAGE_QUEUE_SEND_REQUEST;
+
+  if ( _CORE_message_queue_Ring_pop( ring, buffer, size_p ) ) {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  _CORE_message_queue_Acquire_critical( the_message_queue, queue_context );
+
+  _Atomic_Store_uint( &ring->waiting_receivers, 1, ATOMIC_ORDER_RELAXED );
+
+  /*
+   * This fence pairs with the fence in _CORE_message_queue_Ring_submit().
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _CORE_message_queue_Ring_pop( ring, buffer, size_p ) ) {
+    if ( _Thread_queue_Is_empty( &the_message_queue->Wait_queue.Queue ) ) {
+      _Atomic_Store_uint( &ring->waiting_receivers, 0, ATOMIC_ORDER_RELAXED );
+    }
+
+    _CORE_message_queue_Ring_leave( the_message_queue );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * The message queue deletion acquires the message queue lock after the
+   * ring was closed, so we may end the lock-free operation here.  After the
+   * thread queue enqueue, we must not access the ring since the message
+   * queue may be deleted in the meantime.
+   */
+  _CORE_message_queue_Ring_leave( the_message_queue );
+  executing->Wait.return_argument_second.mutable_object = buffer;
+  executing->Wait.return_argument = size_p;
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+uint32_t _CORE_message_queue_Ring_flush(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  uint32_t count;
+
+  count = 0;
+
+  while ( _CORE_message_queue_Ring_pop( the_message_queue->ring, NULL, NULL ) ) {
+    ++count;
+  }
+
+  return count;
+}
+
+void _CORE_message_queue_Ring_close(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  _Atomic_Fetch_or_uint(
+    &the_message_queue->ring_users,
+    CORE_MESSAGE_QUEUE_RING_CLOSED,
+    ATOMIC_ORDER_SEQ_CST
+  );
+
+  /*
+   * The lock-free operations in progress are carried out with interrupts
+   * disabled on other processors, so they end in a bounded time.
+   */
+  while (
+    _Atomic_Load_uint( &the_message_queue->ring_users, ATOMIC_ORDER_ACQUIRE )
+      != CORE_MESSAGE_QUEUE_RING_CLOSED
+  ) {
+    /* Wait */
+  }
+}
@@ -103,6 +103,39 @@ Status_Control _CORE_message_queue_Seize(
     #endif
   }
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+  {
+    Thread_Control *the_thread;
+
+    /*
+     *  There could be a thread waiting to send a message while all message
+     *  buffers are loaned.  In this case, we take the message directly from
+     *  the waiting thread, so that receivers never wait together with
+     *  senders.
+     */
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+    if ( the_thread != NULL && the_thread->Wait.return_argument == NULL ) {
+      *size_p = (size_t) the_thread->Wait.option;
+      executing->Wait.count = the_thread->Wait.count;
+      _CORE_message_queue_Copy_buffer(
+        the_thread->Wait.return_argument_second.immutable_object,
+        buffer,
+        *size_p
+      );
+      _Thread_queue_Extract_critical(
+        &the_message_queue->Wait_queue.Queue,
+        the_message_queue->operations,
+        the_thread,
+        queue_context
+      );
+      return STATUS_SUCCESSFUL;
+    }
+  }
+#endif
+
   if ( !wait ) {
     _CORE_message_queue_Release( the_message_queue, queue_context );
     return STATUS_UNSATISFIED;
@@ -128,6 +128,7 @@ Status_Control _CORE_message_queue_Submit(
      *  would be to use this variable prior to here.
      */
     executing->Wait.return_argument_second.immutable_object = buffer;
+    executing->Wait.return_argument = NULL;
     executing->Wait.option = (uint32_t) size;
     executing->Wait.count = submit_type;
 
@@ -20,6 +20,8 @@
 
 #include <rtems/score/freechain.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
 
 void *_Freechain_Extend(
   Freechain_Control   *freechain,
@@ -43,6 +45,222 @@ void *_Freechain_Extend(
   return starting_address;
 }
 
+void _Freechain_Initialize_caches(
+  Freechain_Control *freechain,
+  Freechain_Cache   *caches,
+  size_t             batch_size
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  _Assert( batch_size > 0 );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Freechain_Cache *cache;
+
+    cache = &caches[ cpu_index ];
+    _ISR_lock_Initialize( &cache->Lock, "Freechain Cache" );
+    _Chain_Initialize_empty( &cache->Free );
+    cache->count = 0;
+  }
+
+  _ISR_lock_Initialize( &freechain->Lock, "Freechain" );
+  freechain->batch_size = batch_size;
+  freechain->caches = caches;
+}
+
+static Freechain_Cache *_Freechain_Cache_acquire(
+  const Freechain_Control *freechain,
+  ISR_lock_Context        *lock_context
+)
+{
+  Freechain_Cache *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = &freechain->caches[ _Per_CPU_Get_index( _Per_CPU_Get() ) ];
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Freechain_Cache_release(
+  Freechain_Cache  *cache,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static void _Freechain_Move_nodes(
+  Chain_Control *from,
+  Chain_Control *to,
+  size_t         count
+)
+{
+  while ( count > 0 && !_Chain_Is_empty( from ) ) {
+    _Chain_Append_unprotected( to, _Chain_Get_first_unprotected( from ) );
+    --count;
+  }
+}
+
+static void _Freechain_Put_batch(
+  Freechain_Control *freechain,
+  Chain_Control     *batch
+)
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &freechain->Lock, &lock_context );
+
+  while ( !_Chain_Is_empty( batch ) ) {
+    _Chain_Prepend_unprotected(
+      &freechain->Free,
+      _Chain_Get_first_unprotected( batch )
+    );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &freechain->Lock, &lock_context );
+}
+
+static void *_Freechain_Get_cached(
+  Freechain_Control   *freechain,
+  Freechain_Allocator  allocator,
+  size_t               number_nodes_to_extend,
+  size_t               node_size
+)
+{
+  ISR_lock_Context  lock_context;
+  Freechain_Cache  *cache;
+  Chain_Control     batch;
+  Chain_Node       *node;
+  size_t            count;
+
+  cache = _Freechain_Cache_acquire( freechain, &lock_context );
+
+  if ( !_Chain_Is_empty( &cache->Free ) ) {
+    node = _Chain_Get_first_unprotected( &cache->Free );
+    --cache->count;
+    _Freechain_Cache_release( cache, &lock_context );
+    return node;
+  }
+
+  _Freechain_Cache_release( cache, &lock_context );
+
+  /* Refill the cache with a batch of nodes from the free chain */
+  _Chain_Initialize_empty( &batch );
+  _ISR_lock_ISR_disable_and_acquire( &freechain->Lock, &lock_context );
+  _Freechain_Move_nodes( &freechain->Free, &batch, freechain->batch_size );
+  _ISR_lock_Release_and_ISR_enable( &freechain->Lock, &lock_context );
+
+  if ( _Chain_Is_empty( &batch ) && number_nodes_to_extend > 0 ) {
+    char *starting_address;
+
+    /*
+     * Do not use _Freechain_Extend() since the free chain may be no longer
+     * empty at this point.
+     */
+    starting_address = ( *allocator )( number_nodes_to_extend * node_size );
+
+    if ( starting_address != NULL ) {
+      Chain_Control extension;
+
+      _Chain_Initialize(
+        &extension,
+        starting_address,
+        number_nodes_to_extend,
+        node_size
+      );
+      _Freechain_Move_nodes( &extension, &batch, freechain->batch_size );
+      _Freechain_Put_batch( freechain, &extension );
+    }
+  }
+
+  node = _Chain_Get_unprotected( &batch );
+
+  if ( _Chain_Is_empty( &batch ) ) {
+    return node;
+  }
+
+  /*
+   * The executing thread may have migrated to another processor in the
+   * meantime, however, this is not an issue for the cache.
+   */
+  count = 0;
+  cache = _Freechain_Cache_acquire( freechain, &lock_context );
+
+  while ( !_Chain_Is_empty( &batch ) ) {
+    _Chain_Prepend_unprotected(
+      &cache->Free,
+      _Chain_Get_first_unprotected( &batch )
+    );
+    ++count;
+  }
+
+  cache->count += count;
+  _Freechain_Cache_release( cache, &lock_context );
+
+  return node;
+}
+
+static void _Freechain_Put_cached( Freechain_Control *freechain, void *node )
+{
+  ISR_lock_Context  lock_context;
+  Freechain_Cache  *cache;
+  Chain_Control     batch;
+
+  _Chain_Initialize_node( node );
+  cache = _Freechain_Cache_acquire( freechain, &lock_context );
+  _Chain_Prepend_unprotected( &cache->Free, node );
+
+  /*
+   * Keep up to two batches in the cache, so that alternating get and put
+   * operations do not move the nodes back and forth.
+   */
+  if ( cache->count < 2 * freechain->batch_size ) {
+    ++cache->count;
+    _Freechain_Cache_release( cache, &lock_context );
+    return;
+  }
+
+  _Chain_Initialize_empty( &batch );
+  _Freechain_Move_nodes( &cache->Free, &batch, freechain->batch_size );
+  cache->count -= freechain->batch_size - 1;
+  _Freechain_Cache_release( cache, &lock_context );
+
+  _Freechain_Put_batch( freechain, &batch );
+}
+
+void _Freechain_Flush_caches( Freechain_Control *freechain )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  if ( freechain->caches == NULL ) {
+    return;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Freechain_Cache  *cache;
+    ISR_lock_Context  lock_context;
+    Chain_Control     batch;
+
+    cache = &freechain->caches[ cpu_index ];
+    _Chain_Initialize_empty( &batch );
+
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+    _Freechain_Move_nodes( &cache->Free, &batch, cache->count );
+    cache->count = 0;
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+    _Freechain_Put_batch( freechain, &batch );
+  }
+}
+
 void *_Freechain_Get(
   Freechain_Control   *freechain,
   Freechain_Allocator  allocator,
@@ -52,6 +270,15 @@ void *_Freechain_Get(
 {
   _Assert( node_size >= sizeof( Chain_Node ) );
 
+  if ( freechain->caches != NULL ) {
+    return _Freechain_Get_cached(
+      freechain,
+      allocator,
+      number_nodes_to_extend,
+      node_size
+    );
+  }
+
   if ( _Chain_Is_empty( &freechain->Free ) && number_nodes_to_extend > 0 ) {
     _Freechain_Extend(
       freechain,
@@ -67,6 +294,11 @@ void *_Freechain_Get(
 void _Freechain_Put( Freechain_Control *freechain, void *node )
 {
   if ( node != NULL ) {
+    if ( freechain->caches != NULL ) {
+      _Freechain_Put_cached( freechain, node );
+      return;
+    }
+
     _Chain_Initialize_node( node );
     _Chain_Prepend_unprotected( &freechain->Free, node );
   }
@@ -189,6 +189,150 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static Heap_Block *_Heap_Search_free_blocks(
+  Heap_Control *heap,
+  Heap_Block *block,
+  const Heap_Block *end,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t *alloc_begin_ptr,
+  uint32_t *search_count
+)
+{
+  uintptr_t const block_size_floor = alloc_size + HEAP_BLOCK_HEADER_SIZE
+    - HEAP_ALLOC_BONUS;
+  uintptr_t alloc_begin = 0;
+
+  while ( block != end ) {
+    _HAssert( _Heap_Is_prev_used( block ) );
+
+    _Heap_Protection_block_check( heap, block );
+
+    /*
+     * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+     * field.  Thus the value is about one unit larger than the real block
+     * size.  The greater than operator takes this into account.
+     */
+    if ( block->size_and_flag > block_size_floor ) {
+      if ( alignment == 0 ) {
+        alloc_begin = _Heap_Alloc_area_of_block( block );
+      } else {
+        alloc_begin = _Heap_Check_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary
+        );
+      }
+    }
+
+    /* Statistics */
+    ++*search_count;
+
+    if ( alloc_begin != 0 ) {
+      break;
+    }
+
+    block = block->next;
+  }
+
+  *alloc_begin_ptr = alloc_begin;
+
+  return block;
+}
+
+static Heap_Block *_Heap_Search_segregated(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  uintptr_t const page_size = heap->page_size;
+  uintptr_t const min_block_size = heap->min_block_size;
+  uintptr_t good_fit_size = alloc_size + HEAP_BLOCK_HEADER_SIZE
+    - HEAP_ALLOC_BONUS + 1;
+  uintptr_t margin;
+  Heap_Block *block;
+
+  *alloc_begin = 0;
+
+  if ( good_fit_size < min_block_size ) {
+    good_fit_size = min_block_size;
+  }
+
+  /*
+   * The allocation area of each block is aligned to the page size.  So,
+   * alignments which divide the page size need no special treatment.
+   */
+  if ( boundary == 0 && alignment != 0 && page_size % alignment == 0 ) {
+    alignment = 0;
+  }
+
+  /*
+   * Over-allocate for the alignment and boundary constraints.  The margin
+   * covers the worst case placement of the allocation area at the end of the
+   * block done by _Heap_Check_block() and leaves room for a free block in
+   * front of it.  This makes sure that the first block of the good fit block
+   * size class satisfies all constraints.
+   */
+  margin = 0;
+
+  if ( alignment != 0 ) {
+    margin = alignment + min_block_size + page_size;
+
+    if ( boundary != 0 ) {
+      margin += alignment + alloc_size;
+    }
+  }
+
+  if (
+    good_fit_size < alloc_size
+      || good_fit_size + margin < good_fit_size
+      || margin < alignment
+  ) {
+    /* Integer overflow occured */
+    return NULL;
+  }
+
+  good_fit_size += margin;
+
+  /*
+   * All blocks of the good fit block size class are big enough.  So, the
+   * search ends with the first block of this class and there is no search in
+   * the smaller block size classes.  This bounds the allocation time.
+   */
+  block = _Heap_Segregated_search( heap, good_fit_size, true );
+
+  if ( block == _Heap_Free_list_tail( heap ) ) {
+    return NULL;
+  }
+
+  _HAssert( _Heap_Is_prev_used( block ) );
+  _Heap_Protection_block_check( heap, block );
+
+  /* Statistics */
+  ++*search_count;
+
+  if ( alignment == 0 ) {
+    *alloc_begin = _Heap_Alloc_area_of_block( block );
+  } else {
+    *alloc_begin = _Heap_Check_block(
+      heap,
+      block,
+      alloc_size,
+      alignment,
+      boundary
+    );
+  }
+
+  return block;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -221,41 +365,26 @@ void *_Heap_Allocate_aligned_with_boundary(
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
-
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
-
-      /* Statistics */
-      ++search_count;
-
-      if ( alloc_begin != 0 ) {
-        break;
-      }
-
-      block = block->next;
+    if ( _Heap_Is_segregated( heap ) ) {
+      block = _Heap_Search_segregated(
+        heap,
+        alloc_size,
+        alignment,
+        boundary,
+        &alloc_begin,
+        &search_count
+      );
+    } else {
+      block = _Heap_Search_free_blocks(
+        heap,
+        _Heap_Free_list_first( heap ),
+        _Heap_Free_list_tail( heap ),
+        alloc_size,
+        alignment,
+        boundary,
+        &alloc_begin,
+        &search_count
+      );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -0,0 +1,239 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief Heap Handler Two-Level Segregated Fit Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+RTEMS_STATIC_ASSERT(
+  sizeof( Heap_Block ) >= ( 1U << HEAP_SEGREGATED_SECOND_LEVEL_SHIFT ),
+  HEAP_SEGREGATED_MIN_BLOCK_SIZE
+);
+
+RTEMS_STATIC_ASSERT(
+  HEAP_SEGREGATED_SECOND_LEVEL_COUNT <= 32,
+  HEAP_SEGREGATED_SECOND_LEVEL_COUNT
+);
+
+static Heap_Block *_Heap_Segregated_find(
+  const Heap_Segregated_index *index,
+  unsigned int                 fl,
+  unsigned int                 sl
+)
+{
+  uint32_t sl_map;
+
+  sl_map = index->second_level_map[ fl ] & ( UINT32_MAX << sl );
+
+  if ( sl_map == 0 ) {
+    uintptr_t fl_map;
+
+    ++fl;
+
+    if ( fl >= HEAP_SEGREGATED_FIRST_LEVEL_COUNT ) {
+      return NULL;
+    }
+
+    fl_map = index->first_level_map & ( UINTPTR_MAX << fl );
+
+    if ( fl_map == 0 ) {
+      return NULL;
+    }
+
+    fl = (unsigned int) ffsl( (long) fl_map ) - 1;
+    sl_map = index->second_level_map[ fl ];
+  }
+
+  sl = (unsigned int) ffs( (int) sl_map ) - 1;
+  return index->first[ fl ][ sl ];
+}
+
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *index;
+  unsigned int           fl;
+  unsigned int           sl;
+  Heap_Block            *next;
+
+  index = heap->segregated_index;
+  _Heap_Segregated_map( _Heap_Block_size( block ), &fl, &sl );
+  next = index->first[ fl ][ sl ];
+
+  if ( next == NULL ) {
+    next = _Heap_Segregated_find( index, fl, sl );
+
+    if ( next == NULL ) {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    index->second_level_map[ fl ] |= UINT32_C( 1 ) << sl;
+    index->first_level_map |= (uintptr_t) 1 << fl;
+  }
+
+  _Heap_Free_list_insert_before( next, block );
+  index->first[ fl ][ sl ] = block;
+}
+
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *index;
+  unsigned int           fl;
+  unsigned int           sl;
+
+  index = heap->segregated_index;
+  _Heap_Segregated_map( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block   *next;
+    unsigned int  next_fl;
+    unsigned int  next_sl;
+
+    next = block->next;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      _Heap_Segregated_map( _Heap_Block_size( next ), &next_fl, &next_sl );
+    } else {
+      next_fl = HEAP_SEGREGATED_FIRST_LEVEL_COUNT;
+      next_sl = 0;
+    }
+
+    if ( next_fl == fl && next_sl == sl ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->second_level_map[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( index->second_level_map[ fl ] == 0 ) {
+        index->first_level_map &= ~( (uintptr_t) 1 << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+Heap_Block *_Heap_Segregated_search(
+  Heap_Control *heap,
+  uintptr_t     block_size,
+  bool          good_fit
+)
+{
+  Heap_Block   *block;
+  unsigned int  fl;
+  unsigned int  sl;
+
+  if ( block_size < heap->min_block_size ) {
+    block_size = heap->min_block_size;
+  }
+
+  if ( good_fit ) {
+    uintptr_t class_size_minus_one;
+
+    fl = (unsigned int) flsl( (long) block_size ) - 1;
+    class_size_minus_one =
+      ( (uintptr_t) 1 << ( fl - HEAP_SEGREGATED_SECOND_LEVEL_SHIFT ) ) - 1;
+
+    if ( block_size + class_size_minus_one < block_size ) {
+      /* Integer overflow, there is no block which is big enough */
+      return _Heap_Free_list_tail( heap );
+    }
+
+    block_size += class_size_minus_one;
+  }
+
+  _Heap_Segregated_map( block_size, &fl, &sl );
+  block = _Heap_Segregated_find( heap->segregated_index, fl, sl );
+
+  if ( block == NULL ) {
+    block = _Heap_Free_list_tail( heap );
+  }
+
+  return block;
+}
+
+uintptr_t _Heap_Initialize_segregated(
+  Heap_Control *heap,
+  void         *area_begin_ptr,
+  uintptr_t     area_size,
+  uintptr_t     page_size
+)
+{
+  uintptr_t              area_begin;
+  uintptr_t              area_end;
+  uintptr_t              index_begin;
+  uintptr_t              index_end;
+  uintptr_t              space_available;
+  Heap_Segregated_index *index;
+  Heap_Block            *first_free_block;
+
+  area_begin = (uintptr_t) area_begin_ptr;
+  area_end = area_begin + area_size;
+  index_begin = _Heap_Align_up( area_begin, CPU_ALIGNMENT );
+  index_end = index_begin + sizeof( *index );
+
+  if (
+    area_end < area_begin
+      || index_begin < area_begin
+      || index_end < index_begin
+      || index_end > area_end
+  ) {
+    return 0;
+  }
+
+  space_available = _Heap_Initialize(
+    heap,
+    (void *) index_end,
+    area_end - index_end,
+    page_size
+  );
+
+  if ( space_available == 0 ) {
+    return 0;
+  }
+
+  index = (Heap_Segregated_index *) index_begin;
+  memset( index, 0, sizeof( *index ) );
+  heap->segregated_index = index;
+
+  first_free_block = _Heap_Free_list_first( heap );
+  _Heap_Free_list_remove( first_free_block );
+  _Heap_Segregated_insert( heap, first_free_block );
+
+  return space_available;
+}
@@ -119,6 +119,109 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated_index;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  unsigned int prev_class = 0;
+  size_t class_count = 0;
+  size_t index_count = 0;
+  unsigned int fl;
+  unsigned int sl;
+
+  while ( free_block != free_list_tail ) {
+    unsigned int current_class;
+
+    _Heap_Segregated_map( _Heap_Block_size( free_block ), &fl, &sl );
+    current_class = fl * HEAP_SEGREGATED_SECOND_LEVEL_COUNT + sl + 1;
+
+    if ( current_class < prev_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: size class not in ascending order\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( current_class != prev_class ) {
+      if ( index->first[ fl ][ sl ] != free_block ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not the first block of its size class\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      prev_class = current_class;
+      ++class_count;
+    }
+
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FIRST_LEVEL_COUNT; ++fl ) {
+    bool const fl_bit = ( index->first_level_map & ( (uintptr_t) 1 << fl ) )
+      != 0;
+
+    if ( fl_bit != ( index->second_level_map[ fl ] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "segregated index: first level map inconsistent at %u\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0; sl < HEAP_SEGREGATED_SECOND_LEVEL_COUNT; ++sl ) {
+      bool const sl_bit = ( index->second_level_map[ fl ] & ( 1U << sl ) )
+        != 0;
+
+      if ( sl_bit != ( index->first[ fl ][ sl ] != NULL ) ) {
+        (*printer)(
+          source,
+          true,
+          "segregated index: second level map inconsistent at %u/%u\n",
+          fl,
+          sl
+        );
+
+        return false;
+      }
+
+      if ( sl_bit ) {
+        ++index_count;
+      }
+    }
+  }
+
+  if ( index_count != class_count ) {
+    (*printer)(
+      source,
+      true,
+      "segregated index: %u size classes indexed, %u in free list\n",
+      index_count,
+      class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -236,7 +339,15 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  if ( _Heap_Is_segregated( heap ) ) {
+    return _Heap_Walk_check_segregated_index( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
@@ -90,7 +90,7 @@ static void _Mutex_Queue_release(
   _ISR_Local_enable( level );
 }
 
-static void _Mutex_Acquire_slow(
+static Status_Control _Mutex_Acquire_slow(
   Mutex_Control        *mutex,
   Thread_Control       *owner,
   Thread_Control       *executing,
@@ -98,6 +98,24 @@ static void _Mutex_Acquire_slow(
   Thread_queue_Context *queue_context
 )
 {
+  _Thread_queue_Context_set_ISR_level( queue_context, level );
+
+#if defined(RTEMS_SMP)
+  if (
+    _Thread_queue_Spin_on_owner(
+      &mutex->Queue.Queue,
+      owner,
+      executing,
+      queue_context
+    )
+  ) {
+    mutex->Queue.Queue.owner = executing;
+    _Thread_Resource_count_increment( executing );
+    _Mutex_Queue_release( mutex, level, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
   _Thread_queue_Context_set_thread_state(
     queue_context,
     STATES_WAITING_FOR_MUTEX
@@ -106,13 +124,13 @@ static void _Mutex_Acquire_slow(
     queue_context,
     _Thread_queue_Deadlock_fatal
   );
-  _Thread_queue_Context_set_ISR_level( queue_context, level );
   _Thread_queue_Enqueue(
     &mutex->Queue.Queue,
     MUTEX_TQ_OPERATIONS,
     executing,
     queue_context
   );
+  return _Thread_Wait_get_status( executing );
 }
 
 static void _Mutex_Release_critical(
@@ -177,6 +195,7 @@ int _Mutex_Acquire_timed(
   ISR_Level             level;
   Thread_Control       *executing;
   Thread_Control       *owner;
+  Status_Control        status;
 
   mutex = _Mutex_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
@@ -196,9 +215,15 @@ int _Mutex_Acquire_timed(
       &queue_context,
       abstime
     );
-    _Mutex_Acquire_slow( mutex, owner, executing, level, &queue_context );
+    status = _Mutex_Acquire_slow(
+      mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
 
-    return STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
+    return STATUS_GET_POSIX( status );
   }
 }
 
@@ -293,6 +318,7 @@ int _Mutex_recursive_Acquire_timed(
   ISR_Level                level;
   Thread_Control          *executing;
   Thread_Control          *owner;
+  Status_Control           status;
 
   mutex = _Mutex_recursive_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
@@ -317,9 +343,15 @@ int _Mutex_recursive_Acquire_timed(
       &queue_context,
       abstime
     );
-    _Mutex_Acquire_slow( &mutex->Mutex, owner, executing, level, &queue_context );
+    status = _Mutex_Acquire_slow(
+      &mutex->Mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
 
-    return STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
+    return STATUS_GET_POSIX( status );
   }
 }
 
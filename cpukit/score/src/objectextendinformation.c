@@ -216,6 +216,10 @@ Objects_Maximum _Objects_Extend_information(
 
     _Workspace_Free( old_tables );
 
+    if ( information->name_index != NULL ) {
+      (void) _Objects_Name_index_rebuild( information );
+    }
+
     block_count++;
   }
 
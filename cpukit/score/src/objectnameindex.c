@@ -0,0 +1,359 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief Object Name Hash Index
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+static uint32_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  name *= 0x9e3779b1U;
+
+  return name ^ ( name >> 16 );
+}
+
+static uint32_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      max_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = 2166136261U;
+
+  for ( i = 0; i < max_length && name[ i ] != '\0'; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static bool _Objects_Name_index_has_name(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    return the_object->name.name_p != NULL;
+  }
+
+  return the_object->name.name_u32 != 0;
+}
+
+static uint32_t _Objects_Name_index_home(
+  const Objects_Information *information,
+  const Objects_Name_index  *index,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t hash;
+
+  if ( _Objects_Has_string_name( information ) ) {
+    hash = _Objects_Name_index_hash_string(
+      the_object->name.name_p,
+      information->name_length
+    );
+  } else {
+    hash = _Objects_Name_index_hash_u32( the_object->name.name_u32 );
+  }
+
+  return hash % index->size;
+}
+
+static uint32_t _Objects_Name_index_next(
+  const Objects_Name_index *index,
+  uint32_t                  slot
+)
+{
+  ++slot;
+
+  if ( slot == index->size ) {
+    slot = 0;
+  }
+
+  return slot;
+}
+
+static Objects_Control *_Objects_Name_index_object(
+  const Objects_Information *information,
+  Objects_Maximum            object_index
+)
+{
+  return information->local_table[ object_index - OBJECTS_INDEX_MINIMUM ];
+}
+
+static void _Objects_Name_index_do_insert(
+  const Objects_Information *information,
+  Objects_Name_index        *index,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t slot;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  slot = _Objects_Name_index_home( information, index, the_object );
+
+  while ( index->slots[ slot ] != 0 ) {
+    slot = _Objects_Name_index_next( index, slot );
+  }
+
+  index->slots[ slot ] = _Objects_Get_index( the_object->id );
+}
+
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  _Objects_Name_index_do_insert(
+    information,
+    information->name_index,
+    the_object
+  );
+}
+
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  Objects_Name_index *index;
+  Objects_Maximum     object_index;
+  uint32_t            slot;
+  uint32_t            next;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  index = information->name_index;
+  object_index = _Objects_Get_index( the_object->id );
+  slot = _Objects_Name_index_home( information, index, the_object );
+
+  while ( index->slots[ slot ] != object_index ) {
+    if ( index->slots[ slot ] == 0 ) {
+      return;
+    }
+
+    slot = _Objects_Name_index_next( index, slot );
+  }
+
+  /*
+   * Use the backward shift deletion to keep the probe sequences of the
+   * remaining objects intact without tombstones.
+   */
+  next = slot;
+
+  while ( true ) {
+    const Objects_Control *other;
+    uint32_t               home;
+
+    next = _Objects_Name_index_next( index, next );
+
+    if ( index->slots[ next ] == 0 ) {
+      break;
+    }
+
+    other = _Objects_Name_index_object( information, index->slots[ next ] );
+    home = _Objects_Name_index_home( information, index, other );
+
+    if (
+      slot <= next ?
+        ( slot < home && home <= next ) : ( slot < home || home <= next )
+    ) {
+      continue;
+    }
+
+    index->slots[ slot ] = index->slots[ next ];
+    slot = next;
+  }
+
+  index->slots[ slot ] = 0;
+}
+
+Objects_Control *_Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+)
+{
+  const Objects_Name_index *index;
+  Objects_Control          *found;
+  uint32_t                  slot;
+
+  _Assert( !_Objects_Has_string_name( information ) );
+  _Assert( _Objects_Allocator_is_owner() );
+
+  index = information->name_index;
+  found = NULL;
+  slot = _Objects_Name_index_hash_u32( name ) % index->size;
+
+  /*
+   * Continue the search after a match to return the first object according
+   * to the object index.  This is the result of the linear search.
+   */
+  while ( index->slots[ slot ] != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Name_index_object(
+      information,
+      index->slots[ slot ]
+    );
+
+    if (
+      the_object->name.name_u32 == name
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    slot = _Objects_Name_index_next( index, slot );
+  }
+
+  return found;
+}
+
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  const Objects_Name_index *index;
+  Objects_Control          *found;
+  size_t                    max_name_length;
+  uint32_t                  slot;
+
+  _Assert( _Objects_Has_string_name( information ) );
+  _Assert( _Objects_Allocator_is_owner() );
+
+  index = information->name_index;
+  found = NULL;
+  max_name_length = information->name_length;
+  slot = _Objects_Name_index_hash_string( name, max_name_length )
+    % index->size;
+
+  while ( index->slots[ slot ] != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Name_index_object(
+      information,
+      index->slots[ slot ]
+    );
+
+    if (
+      strncmp( name, the_object->name.name_p, max_name_length ) == 0
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    slot = _Objects_Name_index_next( index, slot );
+  }
+
+  return found;
+}
+
+bool _Objects_Name_index_rebuild( Objects_Information *information )
+{
+  Objects_Name_index *old_index;
+  Objects_Name_index *new_index;
+  Objects_Maximum     maximum;
+  Objects_Maximum     i;
+  size_t              size;
+
+  old_index = information->name_index;
+  maximum = _Objects_Get_maximum_index( information );
+  size = OBJECTS_NAME_INDEX_SIZE( maximum );
+  new_index = _Workspace_Allocate( size );
+
+  if ( new_index != NULL ) {
+    memset( new_index, 0, size );
+    new_index->size = 2 * (uint32_t) maximum + 1;
+
+    for ( i = 0; i < maximum; ++i ) {
+      const Objects_Control *the_object;
+
+      the_object = information->local_table[ i ];
+
+      if ( the_object != NULL ) {
+        _Objects_Name_index_do_insert( information, new_index, the_object );
+      }
+    }
+  }
+
+  information->name_index = new_index;
+  _Workspace_Free( old_index );
+
+  return new_index != NULL;
+}
+
+void _Objects_Name_index_initialize( void )
+{
+  uint32_t api;
+
+  for ( api = OBJECTS_CLASSIC_API; api <= OBJECTS_APIS_LAST; ++api ) {
+    uint32_t the_class;
+    uint32_t class_maximum;
+
+    class_maximum = _Objects_API_maximum_class( api );
+
+    for ( the_class = 1; the_class <= class_maximum; ++the_class ) {
+      Objects_Information *information;
+
+      information = _Objects_Information_table[ api ][ the_class ];
+
+      if (
+        information == NULL
+          || _Objects_Get_maximum_index( information ) == 0
+          || ( api != OBJECTS_CLASSIC_API
+            && !_Objects_Has_string_name( information ) )
+      ) {
+        continue;
+      }
+
+      (void) _Objects_Name_index_rebuild( information );
+    }
+  }
+}
@@ -53,6 +53,25 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
+  if ( search_local_node && information->name_index != NULL ) {
+    if ( _Thread_Dispatch_is_enabled() ) {
+      _Objects_Allocator_lock();
+      the_object = _Objects_Name_index_find_u32( information, name );
+
+      if ( the_object != NULL ) {
+        *id = the_object->id;
+      }
+
+      _Objects_Allocator_unlock();
+
+      if ( the_object != NULL ) {
+        return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+      }
+
+      search_local_node = false;
+    }
+  }
+
   if ( search_local_node ) {
     for ( index = 0; index < maximum; ++index ) {
       the_object = information->local_table[ index ];
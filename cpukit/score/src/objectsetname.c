@@ -30,6 +30,10 @@ bool _Objects_Set_name(
   const char                *name
 )
 {
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   if ( _Objects_Has_string_name( information ) ) {
     size_t  length;
     char   *dup;
@@ -37,6 +41,10 @@ bool _Objects_Set_name(
     length = strnlen( name, information->name_length );
     dup = _Workspace_String_duplicate( name, length );
     if ( dup == NULL ) {
+      if ( information->name_index != NULL ) {
+        _Objects_Name_index_insert( information, the_object );
+      }
+
       return false;
     }
 
@@ -59,5 +67,9 @@ bool _Objects_Set_name(
       _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
   }
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return true;
 }
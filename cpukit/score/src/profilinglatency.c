@@ -0,0 +1,88 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreProfiling
+ *
+ * @brief Profiling Latency Statistics Update
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/profiling.h>
+#include <rtems/score/assert.h>
+
+#include <strings.h>
+
+void _Profiling_Do_latency_update(
+  Per_CPU_Latency_index index,
+  CPU_Counter_ticks     start_instant
+)
+{
+#if defined(RTEMS_PROFILING)
+  Per_CPU_Latency_stats *stats;
+  CPU_Counter_ticks      delta;
+  unsigned int           bin;
+#if defined(RTEMS_SMP)
+  unsigned int           seq;
+#endif
+
+  _Assert( index < PER_CPU_LATENCY_COUNT );
+
+  delta = _CPU_Counter_difference( _CPU_Counter_read(), start_instant );
+  stats = &_Per_CPU_Get()->Stats.Latency[ index ];
+  bin = (unsigned int) flsl( (long) delta );
+
+  if ( bin >= PER_CPU_LATENCY_HISTOGRAM_BINS ) {
+    bin = PER_CPU_LATENCY_HISTOGRAM_BINS - 1;
+  }
+
+#if defined(RTEMS_SMP)
+  seq = _SMP_sequence_lock_Write_begin( &stats->Lock );
+#endif
+
+  ++stats->count;
+  stats->total_time += delta;
+
+  if ( stats->max_time < delta ) {
+    stats->max_time = delta;
+  }
+
+  ++stats->histogram[ bin ];
+
+#if defined(RTEMS_SMP)
+  _SMP_sequence_lock_Write_end( &stats->Lock, seq );
+#endif
+#else
+  (void) index;
+  (void) start_instant;
+#endif
+}
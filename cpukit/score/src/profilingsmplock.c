@@ -31,10 +31,14 @@ typedef struct {
 
 static SMP_lock_Stats_control _SMP_lock_Stats_control = {
   .Lock = {
+#if defined(RTEMS_SMP_LOCK_MCS)
+    .MCS_lock = SMP_MCS_LOCK_INITIALIZER,
+#else
     .Ticket_lock = {
       .next_ticket = ATOMIC_INITIALIZER_UINT( 0U ),
       .now_serving = ATOMIC_INITIALIZER_UINT( 0U )
     },
+#endif
     .Stats = {
       .Node = CHAIN_NODE_INITIALIZER_ONE_NODE_CHAIN(
         &_SMP_lock_Stats_control.Stats_chain
@@ -0,0 +1,158 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreRCU
+ *
+ * @brief Read-Copy Update (RCU) Grace Periods and Callbacks
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rcuimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/smpimpl.h>
+
+ISR_LOCK_DEFINE( static, _RCU_Lock, "RCU" )
+
+static RCU_Head *_RCU_Pending;
+
+void _RCU_Call( RCU_Head *head, RCU_Handler handler )
+{
+  ISR_lock_Context lock_context;
+
+  head->handler = handler;
+
+  _ISR_lock_ISR_disable_and_acquire( &_RCU_Lock, &lock_context );
+  head->next = _RCU_Pending;
+  _RCU_Pending = head;
+  _ISR_lock_Release_and_ISR_enable( &_RCU_Lock, &lock_context );
+}
+
+#if defined(RTEMS_SMP)
+static void _RCU_Request_quiescent_state( void *arg )
+{
+  Per_CPU_Control *cpu_self;
+
+  (void) arg;
+
+  /*
+   * Carry out a thread dispatch once the processor leaves all sections with
+   * thread dispatching disabled.  This reports a quiescent state.
+   */
+  cpu_self = _Per_CPU_Get();
+  cpu_self->dispatch_necessary = true;
+}
+
+static void _RCU_Wait_for_grace_period( void )
+{
+  unsigned long    snapshots[ CPU_MAXIMUM_PROCESSORS ];
+  Processor_mask   targets;
+  Per_CPU_Control *cpu_self;
+  uint32_t         cpu_max;
+  uint32_t         cpu_index;
+
+  /*
+   * Make sure that the removal of elements by the caller is visible before
+   * we observe the quiescent states of other processors.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  cpu_self = _Thread_Dispatch_disable();
+
+  /*
+   * The current processor is in a quiescent state, since the caller is not
+   * in an RCU read-side critical section and no other thread on this
+   * processor can be in one, as read-side critical sections disable thread
+   * dispatching.
+   */
+  _Processor_mask_Assign( &targets, _SMP_Get_online_processors() );
+  _Processor_mask_Clear( &targets, _Per_CPU_Get_index( cpu_self ) );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &targets, cpu_index ) ) {
+      snapshots[ cpu_index ] = _Atomic_Load_ulong(
+        &_Per_CPU_Get_by_index( cpu_index )->rcu_quiescent_states,
+        ATOMIC_ORDER_ACQUIRE
+      );
+    }
+  }
+
+  _SMP_Multicast_action( &targets, _RCU_Request_quiescent_state, NULL );
+  _Thread_Dispatch_enable( cpu_self );
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &targets, cpu_index ) ) {
+      const Per_CPU_Control *cpu;
+
+      cpu = _Per_CPU_Get_by_index( cpu_index );
+
+      while (
+        _Atomic_Load_ulong( &cpu->rcu_quiescent_states, ATOMIC_ORDER_ACQUIRE )
+          == snapshots[ cpu_index ]
+      ) {
+        /* Wait */
+      }
+    }
+  }
+}
+#endif
+
+void _RCU_Synchronize( void )
+{
+  ISR_lock_Context  lock_context;
+  RCU_Head         *head;
+
+  _ISR_lock_ISR_disable_and_acquire( &_RCU_Lock, &lock_context );
+  head = _RCU_Pending;
+  _RCU_Pending = NULL;
+  _ISR_lock_Release_and_ISR_enable( &_RCU_Lock, &lock_context );
+
+#if defined(RTEMS_SMP)
+  _RCU_Wait_for_grace_period();
+#else
+  /*
+   * On uniprocessor configurations, no read-side critical section can be
+   * active while the caller executes, since read-side critical sections
+   * disable thread dispatching.
+   */
+  RTEMS_COMPILER_MEMORY_BARRIER();
+#endif
+
+  while ( head != NULL ) {
+    RCU_Head *next;
+
+    next = head->next;
+    ( *head->handler )( head );
+    head = next;
+  }
+}
@@ -57,9 +57,9 @@ int _Scheduler_CBS_Detach_thread (
 
   server->task_id = -1;
 
-  the_thread->budget_algorithm = the_thread->Start.budget_algorithm;
-  the_thread->budget_callout   = the_thread->Start.budget_callout;
-  the_thread->is_preemptible   = the_thread->Start.is_preemptible;
+  the_thread->budget_algorithm = the_thread->Cold->Start.budget_algorithm;
+  the_thread->budget_callout   = the_thread->Cold->Start.budget_callout;
+  the_thread->is_preemptible   = the_thread->Cold->Start.is_preemptible;
 
   _ISR_lock_ISR_enable( &lock_context );
   return SCHEDULER_CBS_OK;
@@ -0,0 +1,887 @@
+/**
+ * @file
+ *
+ * @brief Partitioned EDF SMP Scheduler Implementation
+ *
+ * @ingroup RTEMSScoreSchedulerSMPEDFPartitioned
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/scheduleredfpartitionedsmp.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static inline Scheduler_EDF_partitioned_SMP_Context *
+_Scheduler_EDF_partitioned_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_EDF_partitioned_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static inline Scheduler_EDF_partitioned_SMP_Context *
+_Scheduler_EDF_partitioned_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_EDF_partitioned_SMP_Context *) context;
+}
+
+static inline Scheduler_EDF_partitioned_SMP_Node *
+_Scheduler_EDF_partitioned_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_EDF_partitioned_SMP_Node *) node;
+}
+
+static inline uint32_t _Scheduler_EDF_partitioned_SMP_Get_index(
+  const Per_CPU_Control *cpu
+)
+{
+  return _Per_CPU_Get_index( cpu ) + 1;
+}
+
+static inline uint32_t _Scheduler_EDF_partitioned_SMP_Get_user_index(
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_EDF_partitioned_SMP_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+static inline uint32_t _Scheduler_EDF_partitioned_SMP_Get_fixed_index(
+  const Scheduler_EDF_partitioned_SMP_Node *node
+)
+{
+  if ( node->pinning_index != 0 ) {
+    return node->pinning_index;
+  }
+
+  return node->affinity_index;
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Priority_less_equal(
+  const void        *left,
+  const RBTree_Node *right
+)
+{
+  const Priority_Control   *the_left;
+  const Scheduler_SMP_Node *the_right;
+  Priority_Control          prio_left;
+  Priority_Control          prio_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, Scheduler_SMP_Node, Base.Node.RBTree );
+
+  prio_left = *the_left;
+  prio_right = the_right->priority;
+
+  return prio_left <= prio_right;
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Overall_less(
+  const Scheduler_EDF_partitioned_SMP_Node *left,
+  const Scheduler_EDF_partitioned_SMP_Node *right
+)
+{
+  Priority_Control lp;
+  Priority_Control rp;
+
+  lp = left->Base.priority;
+  rp = right->Base.priority;
+
+  return lp < rp || (lp == rp && left->generation < right->generation );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self =
+    _Scheduler_EDF_partitioned_SMP_Get_context( scheduler );
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  /* The ready queues are zero initialized and thus empty */
+}
+
+void _Scheduler_EDF_partitioned_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *the_node;
+
+  the_node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+  the_node->home_index = 0;
+  the_node->pinning_index = 0;
+  the_node->affinity_index = 0;
+  the_node->ready_queue_index = 0;
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *smp_node;
+
+  (void) context;
+
+  smp_node = _Scheduler_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  uint32_t                               cpu_max;
+  uint32_t                               rqi;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( rqi = 0; rqi <= cpu_max; ++rqi ) {
+    if ( !_RBTree_Is_empty( &self->Ready[ rqi ].Queue ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static inline Scheduler_EDF_partitioned_SMP_Node *
+_Scheduler_EDF_partitioned_SMP_Steal(
+  Scheduler_EDF_partitioned_SMP_Context *self,
+  uint32_t                               thief
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *highest_ready;
+  const Processor_mask               *processors;
+  uint32_t                            cpu_max;
+  uint32_t                            rqi;
+
+  highest_ready = NULL;
+  processors = &self->Base.Base.Processors;
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( rqi = 1; rqi <= cpu_max; ++rqi ) {
+    RBTree_Node                        *next;
+    Scheduler_EDF_partitioned_SMP_Node *other;
+
+    if ( rqi == thief || !_Processor_mask_Is_set( processors, rqi - 1 ) ) {
+      continue;
+    }
+
+    /*
+     * Pinned nodes and nodes with an affinity to one processor cannot be
+     * stolen.  Look for the highest priority node which may migrate.
+     */
+    next = _RBTree_Minimum( &self->Ready[ rqi ].Queue );
+    other = NULL;
+
+    while ( next != NULL ) {
+      other = (Scheduler_EDF_partitioned_SMP_Node *) next;
+
+      if ( _Scheduler_EDF_partitioned_SMP_Get_fixed_index( other ) == 0 ) {
+        break;
+      }
+
+      other = NULL;
+      next = _RBTree_Successor( next );
+    }
+
+    if (
+      other != NULL
+        && (
+          highest_ready == NULL
+            || _Scheduler_EDF_partitioned_SMP_Overall_less(
+              other,
+              highest_ready
+            )
+        )
+    ) {
+      highest_ready = other;
+    }
+  }
+
+  return highest_ready;
+}
+
+static inline Scheduler_Node *_Scheduler_EDF_partitioned_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Scheduler_EDF_partitioned_SMP_Node    *highest_ready;
+  uint32_t                               rqi;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+
+  /*
+   * The filter node is a scheduled node which is no longer on the scheduled
+   * chain.  Its processor gets the highest ready node.
+   */
+  rqi = _Scheduler_EDF_partitioned_SMP_Get_user_index( filter );
+  highest_ready = (Scheduler_EDF_partitioned_SMP_Node *)
+    _RBTree_Minimum( &self->Ready[ rqi ].Queue );
+
+  if ( highest_ready == NULL ) {
+    highest_ready = _Scheduler_EDF_partitioned_SMP_Steal( self, rqi );
+
+    if ( highest_ready == NULL ) {
+      highest_ready = (Scheduler_EDF_partitioned_SMP_Node *)
+        _RBTree_Minimum( &self->Ready[ 0 ].Queue );
+    }
+  }
+
+  _Assert( highest_ready != NULL );
+  return &highest_ready->Base.Base;
+}
+
+static inline Scheduler_Node *
+_Scheduler_EDF_partitioned_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *filter;
+  uint32_t                            home;
+
+  filter = _Scheduler_EDF_partitioned_SMP_Node_downcast( filter_base );
+  home = filter->home_index;
+
+  if ( home != 0 ) {
+    Scheduler_EDF_partitioned_SMP_Context *self;
+    Scheduler_EDF_partitioned_SMP_Node    *node;
+
+    self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+    node = self->Ready[ home ].scheduled;
+
+    /*
+     * Prefer the home processor to avoid a migration.  Pinned threads and
+     * threads with an affinity to one processor must stay on their home
+     * processor.
+     */
+    if (
+      node != NULL
+        && _Scheduler_SMP_Node_state( &node->Base.Base )
+          == SCHEDULER_SMP_NODE_SCHEDULED
+        && (
+          _Scheduler_EDF_partitioned_SMP_Get_fixed_index( filter ) != 0
+            || filter->Base.priority < node->Base.priority
+        )
+    ) {
+      return &node->Base.Base;
+    }
+  }
+
+  return _Scheduler_SMP_Get_lowest_scheduled( context, filter_base );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Scheduler_EDF_partitioned_SMP_Node    *node;
+  uint32_t                               rqi;
+  int                                    generation_index;
+  int                                    increment;
+  int64_t                                generation;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_base );
+
+  if ( _Scheduler_Node_get_owner( node_base )->is_idle ) {
+    rqi = 0;
+  } else {
+    rqi = node->home_index;
+
+    /*
+     * The home processor may have been removed from this scheduler instance
+     * while the node was blocked.  In this case, the pinning and affinity to
+     * this processor are meaningless and the node needs a new home.
+     */
+    if (
+      rqi != 0
+        && !_Processor_mask_Is_set( &self->Base.Base.Processors, rqi - 1 )
+    ) {
+      if ( node->pinning_index == rqi ) {
+        node->pinning_index = 0;
+      }
+
+      if ( node->affinity_index == rqi ) {
+        node->affinity_index = 0;
+      }
+
+      rqi = _Scheduler_EDF_partitioned_SMP_Get_fixed_index( node );
+
+      if (
+        rqi != 0
+          && !_Processor_mask_Is_set( &self->Base.Base.Processors, rqi - 1 )
+      ) {
+        node->pinning_index = 0;
+        node->affinity_index = 0;
+        rqi = 0;
+      }
+
+      node->home_index = rqi;
+    }
+
+    if ( rqi == 0 ) {
+      rqi = _Scheduler_EDF_partitioned_SMP_Get_user_index(
+        _Scheduler_SMP_Get_lowest_scheduled( context, node_base )
+      );
+      node->home_index = rqi;
+    }
+  }
+
+  node->ready_queue_index = rqi;
+  generation_index = SCHEDULER_PRIORITY_IS_APPEND( insert_priority );
+  increment = ( generation_index << 1 ) - 1;
+
+  generation = self->generations[ generation_index ];
+  node->generation = generation;
+  self->generations[ generation_index ] = generation + increment;
+
+  _RBTree_Initialize_node( &node->Base.Base.Node.RBTree );
+  _RBTree_Insert_inline(
+    &self->Ready[ rqi ].Queue,
+    &node->Base.Base.Node.RBTree,
+    &insert_priority,
+    _Scheduler_EDF_partitioned_SMP_Priority_less_equal
+  );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Scheduler_EDF_partitioned_SMP_Node    *node;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_to_extract );
+
+  _RBTree_Extract(
+    &self->Ready[ node->ready_queue_index ].Queue,
+    &node->Base.Base.Node.RBTree
+  );
+  _Chain_Initialize_node( &node->Base.Base.Node.Chain );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_SMP_Extract_from_scheduled( context, scheduled_to_ready );
+  insert_priority = _Scheduler_SMP_Node_priority( scheduled_to_ready );
+  _Scheduler_EDF_partitioned_SMP_Insert_ready(
+    context,
+    scheduled_to_ready,
+    insert_priority
+  );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_EDF_partitioned_SMP_Extract_from_ready(
+    context,
+    ready_to_scheduled
+  );
+  insert_priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Scheduler_SMP_Insert_scheduled(
+    context,
+    ready_to_scheduled,
+    insert_priority
+  );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Allocate_processor(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_base,
+  Scheduler_Node    *victim_base,
+  Per_CPU_Control   *victim_cpu
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Scheduler_EDF_partitioned_SMP_Node    *scheduled;
+  uint32_t                               rqi;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  scheduled = _Scheduler_EDF_partitioned_SMP_Node_downcast( scheduled_base );
+  rqi = _Scheduler_EDF_partitioned_SMP_Get_index( victim_cpu );
+
+  /*
+   * The processor becomes the new home processor of the thread.  Since the
+   * node may be still on a ready queue, the ready queue index is left as is.
+   */
+  if ( _Scheduler_EDF_partitioned_SMP_Get_fixed_index( scheduled ) == 0 ) {
+    scheduled->home_index = rqi;
+  }
+
+  self->Ready[ rqi ].scheduled = scheduled;
+  _Scheduler_SMP_Allocate_processor_exact(
+    context,
+    scheduled_base,
+    victim_base,
+    victim_cpu
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Get_highest_ready,
+    _Scheduler_EDF_partitioned_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Allocate_processor
+  );
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_EDF_partitioned_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_EDF_partitioned_SMP_Get_lowest_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Allocate_processor
+  );
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Get_highest_ready,
+    _Scheduler_EDF_partitioned_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Allocate_processor
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_partitioned_SMP_Do_update,
+    _Scheduler_EDF_partitioned_SMP_Enqueue
+  );
+}
+
+static inline bool _Scheduler_EDF_partitioned_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_EDF_partitioned_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_EDF_partitioned_SMP_Get_lowest_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Allocate_processor
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Do_update,
+    _Scheduler_EDF_partitioned_SMP_Enqueue,
+    _Scheduler_EDF_partitioned_SMP_Enqueue_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_EDF_partitioned_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_EDF_partitioned_SMP_Do_ask_for_help(
+    context,
+    the_thread,
+    node
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Get_highest_ready,
+    _Scheduler_EDF_partitioned_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Allocate_processor
+  );
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Register_idle(
+  Scheduler_Context *context,
+  Scheduler_Node    *idle_base,
+  Per_CPU_Control   *cpu
+)
+{
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Scheduler_EDF_partitioned_SMP_Node    *idle;
+
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  idle = _Scheduler_EDF_partitioned_SMP_Node_downcast( idle_base );
+  self->Ready[ _Scheduler_EDF_partitioned_SMP_Get_index( cpu ) ].scheduled =
+    idle;
+}
+
+void _Scheduler_EDF_partitioned_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_EDF_partitioned_SMP_Has_ready,
+    _Scheduler_EDF_partitioned_SMP_Enqueue_scheduled,
+    _Scheduler_EDF_partitioned_SMP_Register_idle
+  );
+}
+
+Thread_Control *_Scheduler_EDF_partitioned_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context                     *context;
+  Scheduler_EDF_partitioned_SMP_Context *self;
+  Thread_Control                        *idle;
+  Scheduler_EDF_partitioned_SMP_Node    *scheduled;
+  uint32_t                               rqi;
+
+  context = _Scheduler_Get_context( scheduler );
+  self = _Scheduler_EDF_partitioned_SMP_Get_self( context );
+  idle = _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Enqueue
+  );
+
+  rqi = _Scheduler_EDF_partitioned_SMP_Get_index( cpu );
+  self->Ready[ rqi ].scheduled = NULL;
+
+  if ( _Chain_Is_empty( &self->Base.Scheduled ) ) {
+    _Assert( _RBTree_Is_empty( &self->Ready[ rqi ].Queue ) );
+    return idle;
+  }
+
+  /* Move the orphaned ready nodes to the processor of the lowest node */
+  scheduled = (Scheduler_EDF_partitioned_SMP_Node *)
+    _Chain_Last( &self->Base.Scheduled );
+
+  while ( !_RBTree_Is_empty( &self->Ready[ rqi ].Queue ) ) {
+    Scheduler_EDF_partitioned_SMP_Node *node;
+    Priority_Control                    insert_priority;
+
+    node = (Scheduler_EDF_partitioned_SMP_Node *)
+      _RBTree_Minimum( &self->Ready[ rqi ].Queue );
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready(
+      context,
+      &node->Base.Base
+    );
+    node->home_index = _Scheduler_EDF_partitioned_SMP_Get_user_index(
+      &scheduled->Base.Base
+    );
+    node->pinning_index = 0;
+    node->affinity_index = 0;
+    insert_priority = _Scheduler_SMP_Node_priority( &node->Base.Base );
+    insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+    _Scheduler_EDF_partitioned_SMP_Insert_ready(
+      context,
+      &node->Base.Base,
+      insert_priority
+    );
+  }
+
+  return idle;
+}
+
+void _Scheduler_EDF_partitioned_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+    _Scheduler_EDF_partitioned_SMP_Enqueue,
+    _Scheduler_EDF_partitioned_SMP_Enqueue_scheduled
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context;
+
+  context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Do_start_idle(
+    context,
+    idle,
+    cpu,
+    _Scheduler_EDF_partitioned_SMP_Register_idle
+  );
+}
+
+void _Scheduler_EDF_partitioned_SMP_Pin(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  struct Per_CPU_Control  *cpu
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *node;
+  uint32_t                            rqi;
+
+  (void) scheduler;
+  (void) thread;
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_base );
+  rqi = _Scheduler_EDF_partitioned_SMP_Get_index( cpu );
+
+  _Assert(
+    _Scheduler_SMP_Node_state( &node->Base.Base ) == SCHEDULER_SMP_NODE_BLOCKED
+  );
+
+  node->home_index = rqi;
+  node->pinning_index = rqi;
+}
+
+void _Scheduler_EDF_partitioned_SMP_Unpin(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  struct Per_CPU_Control  *cpu
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *node;
+
+  (void) scheduler;
+  (void) thread;
+  (void) cpu;
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_base );
+
+  _Assert(
+    _Scheduler_SMP_Node_state( &node->Base.Base ) == SCHEDULER_SMP_NODE_BLOCKED
+  );
+
+  node->pinning_index = 0;
+
+  if ( node->affinity_index != 0 ) {
+    node->home_index = node->affinity_index;
+  }
+}
+
+static inline void _Scheduler_EDF_partitioned_SMP_Do_set_affinity(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  void              *arg
+)
+{
+  Scheduler_EDF_partitioned_SMP_Node *node;
+  const uint32_t                     *rqi;
+
+  (void) context;
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_base );
+  rqi = arg;
+  node->affinity_index = *rqi;
+
+  if ( *rqi != 0 ) {
+    node->home_index = *rqi;
+  }
+}
+
+bool _Scheduler_EDF_partitioned_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_Context                  *context;
+  Scheduler_EDF_partitioned_SMP_Node *node;
+  Processor_mask                      local_affinity;
+  uint32_t                            rqi;
+
+  context = _Scheduler_Get_context( scheduler );
+  _Processor_mask_And( &local_affinity, &context->Processors, affinity );
+
+  if ( _Processor_mask_Is_zero( &local_affinity ) ) {
+    return false;
+  }
+
+  if ( _Processor_mask_Is_equal( affinity, &_SMP_Online_processors ) ) {
+    rqi = 0;
+  } else {
+    rqi = _Processor_mask_Find_last_set( &local_affinity );
+  }
+
+  node = _Scheduler_EDF_partitioned_SMP_Node_downcast( node_base );
+
+  if ( node->pinning_index == 0 ) {
+    _Scheduler_SMP_Set_affinity(
+      context,
+      thread,
+      node_base,
+      &rqi,
+      _Scheduler_EDF_partitioned_SMP_Do_set_affinity,
+      _Scheduler_EDF_partitioned_SMP_Extract_from_ready,
+      _Scheduler_EDF_partitioned_SMP_Get_highest_ready,
+      _Scheduler_EDF_partitioned_SMP_Move_from_ready_to_scheduled,
+      _Scheduler_EDF_partitioned_SMP_Enqueue,
+      _Scheduler_EDF_partitioned_SMP_Allocate_processor
+    );
+  } else {
+    node->affinity_index = rqi;
+  }
+
+  return true;
+}
@@ -0,0 +1,897 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerStrongAPAIndexed
+ *
+ * @brief Indexed Strong APA Scheduler Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerstrongapaindexed.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static Scheduler_strong_APA_indexed_Context *
+_Scheduler_strong_APA_indexed_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_strong_APA_indexed_Context *) context;
+}
+
+static Scheduler_strong_APA_indexed_Context *
+_Scheduler_strong_APA_indexed_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_strong_APA_indexed_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_strong_APA_indexed_Node *
+_Scheduler_strong_APA_indexed_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_strong_APA_indexed_Node *) node;
+}
+
+static uint32_t _Scheduler_strong_APA_indexed_Get_cpu_index(
+  Scheduler_Node *node
+)
+{
+  return _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+static void _Scheduler_strong_APA_indexed_Set_node_affinity(
+  Scheduler_strong_APA_indexed_Node *node,
+  const Processor_mask              *affinity
+)
+{
+  _Processor_mask_Assign( &node->Affinity, affinity );
+  node->affinity_end = _Processor_mask_Find_last_set( affinity );
+}
+
+static bool _Scheduler_strong_APA_indexed_Priority_less_equal(
+  const void       *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Priority_less_equal( to_insert, next );
+}
+
+static void _Scheduler_strong_APA_indexed_Add_to_processors(
+  Scheduler_strong_APA_indexed_Context *self,
+  Scheduler_strong_APA_indexed_Node    *node
+)
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < node->affinity_end; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      _Priority_bit_map_Add(
+        &self->Processor_bit_map[ cpu_index ],
+        &node->Ready_queue.Priority_map
+      );
+    }
+  }
+}
+
+static void _Scheduler_strong_APA_indexed_Remove_from_processors(
+  Scheduler_strong_APA_indexed_Context *self,
+  Scheduler_strong_APA_indexed_Node    *node
+)
+{
+  const Chain_Control *ready_chain;
+  const Chain_Node    *tail;
+  const Chain_Node    *next;
+  Processor_mask       remaining;
+  uint32_t             cpu_index;
+
+  ready_chain = node->Ready_queue.ready_chain;
+  tail = _Chain_Immutable_tail( ready_chain );
+  next = _Chain_Immutable_first( ready_chain );
+  _Processor_mask_Zero( &remaining );
+
+  /*
+   * Determine the processors which are still covered by the other ready nodes
+   * of this priority.  In the common case of equal affinity sets, the first
+   * node covers all processors.
+   */
+  while ( next != tail ) {
+    const Scheduler_strong_APA_indexed_Node *other;
+
+    other = (const Scheduler_strong_APA_indexed_Node *) next;
+    _Processor_mask_Or( &remaining, &remaining, &other->Affinity );
+
+    if ( _Processor_mask_Is_subset( &remaining, &node->Affinity ) ) {
+      return;
+    }
+
+    next = _Chain_Immutable_next( next );
+  }
+
+  for ( cpu_index = 0; cpu_index < node->affinity_end; ++cpu_index ) {
+    if (
+      _Processor_mask_Is_set( &node->Affinity, cpu_index )
+        && !_Processor_mask_Is_set( &remaining, cpu_index )
+    ) {
+      _Priority_bit_map_Remove(
+        &self->Processor_bit_map[ cpu_index ],
+        &node->Ready_queue.Priority_map
+      );
+    }
+  }
+}
+
+static void _Scheduler_strong_APA_indexed_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  Scheduler_strong_APA_indexed_Node    *node;
+
+  self = _Scheduler_strong_APA_indexed_Get_self( context );
+  node = _Scheduler_strong_APA_indexed_Node_downcast( node_base );
+
+  if ( SCHEDULER_PRIORITY_IS_APPEND( insert_priority ) ) {
+    _Scheduler_priority_Ready_queue_enqueue(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &self->Bit_map
+    );
+  } else {
+    _Scheduler_priority_Ready_queue_enqueue_first(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &self->Bit_map
+    );
+  }
+
+  _Scheduler_strong_APA_indexed_Add_to_processors( self, node );
+}
+
+static void _Scheduler_strong_APA_indexed_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  Scheduler_strong_APA_indexed_Node    *node;
+
+  self = _Scheduler_strong_APA_indexed_Get_self( context );
+  node = _Scheduler_strong_APA_indexed_Node_downcast( node_to_extract );
+
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &self->Bit_map
+  );
+  _Scheduler_strong_APA_indexed_Remove_from_processors( self, node );
+}
+
+static void _Scheduler_strong_APA_indexed_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node.Chain );
+  _Scheduler_strong_APA_indexed_Insert_ready(
+    context,
+    scheduled_to_ready,
+    _Scheduler_SMP_Node_priority( scheduled_to_ready )
+  );
+}
+
+static void _Scheduler_strong_APA_indexed_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_strong_APA_indexed_Extract_from_ready(
+    context,
+    ready_to_scheduled
+  );
+  insert_priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Scheduler_SMP_Insert_scheduled(
+    context,
+    ready_to_scheduled,
+    insert_priority
+  );
+}
+
+static void _Scheduler_strong_APA_indexed_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  Scheduler_strong_APA_indexed_Node    *node;
+
+  self = _Scheduler_strong_APA_indexed_Get_self( context );
+  node = _Scheduler_strong_APA_indexed_Node_downcast( node_to_update );
+
+  _Scheduler_SMP_Node_update_priority( &node->Base, new_priority );
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( new_priority ),
+    &self->Bit_map,
+    &self->Ready[ 0 ]
+  );
+}
+
+static bool _Scheduler_strong_APA_indexed_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+
+  self = _Scheduler_strong_APA_indexed_Get_self( context );
+
+  return !_Priority_bit_map_Is_empty( &self->Bit_map );
+}
+
+static Scheduler_strong_APA_indexed_Node *
+_Scheduler_strong_APA_indexed_Get_highest_ready_for_processor(
+  Scheduler_strong_APA_indexed_Context *self,
+  uint32_t                              cpu_index
+)
+{
+  const Chain_Control *ready_chain;
+  Chain_Node          *next;
+
+  if ( _Priority_bit_map_Is_empty( &self->Processor_bit_map[ cpu_index ] ) ) {
+    return NULL;
+  }
+
+  ready_chain = &self->Ready[
+    _Priority_bit_map_Get_highest( &self->Processor_bit_map[ cpu_index ] )
+  ];
+  next = _Chain_First( ready_chain );
+
+  /*
+   * The processor bit map guarantees that at least one node of this ready
+   * chain is eligible for the processor.
+   */
+  while ( true ) {
+    Scheduler_strong_APA_indexed_Node *node;
+
+    _Assert( next != _Chain_Immutable_tail( ready_chain ) );
+    node = (Scheduler_strong_APA_indexed_Node *) next;
+
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      return node;
+    }
+
+    next = _Chain_Next( next );
+  }
+}
+
+static Scheduler_Node *_Scheduler_strong_APA_indexed_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_strong_APA_indexed_Node *highest_ready;
+
+  highest_ready = _Scheduler_strong_APA_indexed_Get_highest_ready_for_processor(
+    _Scheduler_strong_APA_indexed_Get_self( context ),
+    _Scheduler_strong_APA_indexed_Get_cpu_index( filter )
+  );
+  _Assert( highest_ready != NULL );
+
+  return &highest_ready->Base.Base;
+}
+
+static Scheduler_Node *_Scheduler_strong_APA_indexed_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base
+)
+{
+  Scheduler_SMP_Context             *self;
+  Scheduler_strong_APA_indexed_Node *filter;
+  const Chain_Node                  *head;
+  Chain_Node                        *previous;
+
+  self = _Scheduler_SMP_Get_self( context );
+  filter = _Scheduler_strong_APA_indexed_Node_downcast( filter_base );
+  head = _Chain_Immutable_head( &self->Scheduled );
+  previous = _Chain_Last( &self->Scheduled );
+
+  while ( previous != head ) {
+    Scheduler_Node *node;
+
+    node = (Scheduler_Node *) previous;
+
+    if (
+      _Processor_mask_Is_set(
+        &filter->Affinity,
+        _Scheduler_strong_APA_indexed_Get_cpu_index( node )
+      )
+    ) {
+      return node;
+    }
+
+    previous = _Chain_Previous( previous );
+  }
+
+  return NULL;
+}
+
+static void _Scheduler_strong_APA_indexed_Prepare_search(
+  Scheduler_strong_APA_indexed_Context *self
+)
+{
+  const Chain_Node *tail;
+  Chain_Node       *next;
+
+  tail = _Chain_Immutable_tail( &self->Base.Scheduled );
+  next = _Chain_First( &self->Base.Scheduled );
+
+  while ( next != tail ) {
+    Scheduler_Node *node;
+    uint32_t        cpu_index;
+
+    node = (Scheduler_Node *) next;
+    cpu_index = _Scheduler_strong_APA_indexed_Get_cpu_index( node );
+    self->CPU[ cpu_index ].scheduled = node;
+
+    next = _Chain_Next( next );
+  }
+}
+
+/*
+ * Performs a breadth-first search starting at the processor.  The edges lead
+ * from a processor to the processors in the affinity set of the node
+ * scheduled on this processor.  Returns the lowest priority scheduled node
+ * reachable from the processor and the index of its processor.
+ */
+static Scheduler_Node *_Scheduler_strong_APA_indexed_Search(
+  Scheduler_strong_APA_indexed_Context *self,
+  uint32_t                              start,
+  uint32_t                             *target
+)
+{
+  const Processor_mask *processors;
+  Scheduler_Node       *lowest_scheduled;
+  uint32_t              cpu_max;
+  uint32_t              cpu_index;
+  uint32_t              head;
+  uint32_t              tail;
+
+  processors = &self->Base.Base.Processors;
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    self->CPU[ cpu_index ].visited = false;
+  }
+
+  self->CPU[ start ].visited = true;
+  self->Search_queue[ 0 ] = start;
+  head = 0;
+  tail = 1;
+  lowest_scheduled = self->CPU[ start ].scheduled;
+  *target = start;
+
+  while ( head < tail ) {
+    Scheduler_strong_APA_indexed_Node *node;
+    uint32_t                           current;
+
+    current = self->Search_queue[ head ];
+    ++head;
+    node = _Scheduler_strong_APA_indexed_Node_downcast(
+      self->CPU[ current ].scheduled
+    );
+
+    if (
+      _Scheduler_SMP_Node_priority( &node->Base.Base )
+        > _Scheduler_SMP_Node_priority( lowest_scheduled )
+    ) {
+      lowest_scheduled = &node->Base.Base;
+      *target = current;
+    }
+
+    for ( cpu_index = 0; cpu_index < node->affinity_end; ++cpu_index ) {
+      if (
+        _Processor_mask_Is_set( &node->Affinity, cpu_index )
+          && _Processor_mask_Is_set( processors, cpu_index )
+          && !self->CPU[ cpu_index ].visited
+      ) {
+        self->CPU[ cpu_index ].visited = true;
+        self->CPU[ cpu_index ].predecessor = current;
+        self->Search_queue[ tail ] = cpu_index;
+        ++tail;
+      }
+    }
+  }
+
+  return lowest_scheduled;
+}
+
+/*
+ * Moves each scheduled node along the search path from the start processor
+ * to the target processor to the next processor of the path and allocates
+ * the start processor to the newly scheduled node.
+ */
+static void _Scheduler_strong_APA_indexed_Shift_along_path(
+  Scheduler_strong_APA_indexed_Context *self,
+  Scheduler_Node                       *scheduled,
+  uint32_t                              start,
+  uint32_t                              target
+)
+{
+  uint32_t cpu_index;
+
+  cpu_index = target;
+
+  while ( cpu_index != start ) {
+    uint32_t predecessor;
+
+    predecessor = self->CPU[ cpu_index ].predecessor;
+    _Scheduler_SMP_Allocate_processor_exact(
+      &self->Base.Base,
+      self->CPU[ predecessor ].scheduled,
+      NULL,
+      _Per_CPU_Get_by_index( cpu_index )
+    );
+    cpu_index = predecessor;
+  }
+
+  _Scheduler_SMP_Allocate_processor_exact(
+    &self->Base.Base,
+    scheduled,
+    NULL,
+    _Per_CPU_Get_by_index( start )
+  );
+}
+
+/*
+ * Searches for displacement chains until no ready node can be scheduled.  A
+ * ready node which could start a chain at a processor has at most the
+ * priority of the highest priority ready node eligible for this processor,
+ * so it is sufficient to search from each processor with this node.  Each
+ * chain replaces a scheduled node with a higher priority ready node, so this
+ * terminates.
+ */
+static void _Scheduler_strong_APA_indexed_Check_for_migrations(
+  Scheduler_Context *context
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  uint32_t                              cpu_max;
+  uint32_t                              cpu_index;
+
+  self = _Scheduler_strong_APA_indexed_Get_self( context );
+  cpu_max = _SMP_Get_processor_maximum();
+  cpu_index = 0;
+
+  _Scheduler_strong_APA_indexed_Prepare_search( self );
+
+  while ( cpu_index < cpu_max ) {
+    Scheduler_strong_APA_indexed_Node *highest_ready;
+    Scheduler_Node                    *lowest_scheduled;
+    Priority_Control                   insert_priority;
+    uint32_t                           target;
+
+    if ( _Priority_bit_map_Is_empty( &self->Bit_map ) ) {
+      break;
+    }
+
+    if ( !_Processor_mask_Is_set( &context->Processors, cpu_index ) ) {
+      ++cpu_index;
+      continue;
+    }
+
+    highest_ready =
+      _Scheduler_strong_APA_indexed_Get_highest_ready_for_processor(
+        self,
+        cpu_index
+      );
+
+    if (
+      highest_ready == NULL
+        || _Scheduler_SMP_Node_priority( &highest_ready->Base.Base )
+          >= _Scheduler_SMP_Node_priority(
+            (Scheduler_Node *) _Chain_Last( &self->Base.Scheduled )
+          )
+    ) {
+      ++cpu_index;
+      continue;
+    }
+
+    insert_priority = _Scheduler_SMP_Node_priority( &highest_ready->Base.Base );
+    lowest_scheduled =
+      _Scheduler_strong_APA_indexed_Search( self, cpu_index, &target );
+
+    if ( insert_priority >= _Scheduler_SMP_Node_priority( lowest_scheduled ) ) {
+      ++cpu_index;
+      continue;
+    }
+
+    _Scheduler_strong_APA_indexed_Extract_from_ready(
+      context,
+      &highest_ready->Base.Base
+    );
+    _Scheduler_SMP_Enqueue_to_scheduled(
+      context,
+      &highest_ready->Base.Base,
+      SCHEDULER_PRIORITY_APPEND( insert_priority ),
+      lowest_scheduled,
+      _Scheduler_SMP_Insert_scheduled,
+      _Scheduler_strong_APA_indexed_Move_from_scheduled_to_ready,
+      _Scheduler_SMP_Allocate_processor_exact
+    );
+
+    if (
+      target != cpu_index
+        && _Scheduler_SMP_Node_state( &highest_ready->Base.Base )
+          == SCHEDULER_SMP_NODE_SCHEDULED
+    ) {
+      _Scheduler_strong_APA_indexed_Shift_along_path(
+        self,
+        &highest_ready->Base.Base,
+        cpu_index,
+        target
+      );
+    }
+
+    _Scheduler_strong_APA_indexed_Prepare_search( self );
+    cpu_index = 0;
+  }
+}
+
+void _Scheduler_strong_APA_indexed_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  uint32_t                              cpu_index;
+
+  self = _Scheduler_strong_APA_indexed_Get_context( scheduler );
+  _Scheduler_SMP_Initialize( &self->Base );
+  _Priority_bit_map_Initialize( &self->Bit_map );
+
+  for ( cpu_index = 0; cpu_index < CPU_MAXIMUM_PROCESSORS; ++cpu_index ) {
+    _Priority_bit_map_Initialize( &self->Processor_bit_map[ cpu_index ] );
+  }
+
+  _Scheduler_priority_Ready_queue_initialize(
+    &self->Ready[ 0 ],
+    scheduler->maximum_priority
+  );
+}
+
+void _Scheduler_strong_APA_indexed_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_strong_APA_indexed_Context *self;
+  Scheduler_strong_APA_indexed_Node    *the_node;
+
+  the_node = _Scheduler_strong_APA_indexed_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+  _Scheduler_strong_APA_indexed_Set_node_affinity(
+    the_node,
+    _SMP_Get_online_processors()
+  );
+
+  self = _Scheduler_strong_APA_indexed_Get_context( scheduler );
+  _Scheduler_priority_Ready_queue_update(
+    &the_node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( priority ),
+    &self->Bit_map,
+    &self->Ready[ 0 ]
+  );
+}
+
+void _Scheduler_strong_APA_indexed_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Get_highest_ready,
+    _Scheduler_strong_APA_indexed_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+static bool _Scheduler_strong_APA_indexed_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_strong_APA_indexed_Priority_less_equal,
+    _Scheduler_strong_APA_indexed_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_strong_APA_indexed_Move_from_scheduled_to_ready,
+    _Scheduler_strong_APA_indexed_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static bool _Scheduler_strong_APA_indexed_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Get_highest_ready,
+    _Scheduler_strong_APA_indexed_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_strong_APA_indexed_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_strong_APA_indexed_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    the_thread,
+    node,
+    _Scheduler_strong_APA_indexed_Do_update,
+    _Scheduler_strong_APA_indexed_Enqueue
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+static bool _Scheduler_strong_APA_indexed_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_strong_APA_indexed_Priority_less_equal,
+    _Scheduler_strong_APA_indexed_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_strong_APA_indexed_Move_from_scheduled_to_ready,
+    _Scheduler_strong_APA_indexed_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_strong_APA_indexed_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    the_thread,
+    node,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Do_update,
+    _Scheduler_strong_APA_indexed_Enqueue,
+    _Scheduler_strong_APA_indexed_Enqueue_scheduled,
+    _Scheduler_strong_APA_indexed_Do_ask_for_help
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+bool _Scheduler_strong_APA_indexed_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  bool               success;
+
+  success = _Scheduler_strong_APA_indexed_Do_ask_for_help(
+    context,
+    the_thread,
+    node
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+
+  return success;
+}
+
+void _Scheduler_strong_APA_indexed_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_strong_APA_indexed_Extract_from_ready
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+void _Scheduler_strong_APA_indexed_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Get_highest_ready,
+    _Scheduler_strong_APA_indexed_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+void _Scheduler_strong_APA_indexed_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_strong_APA_indexed_Has_ready,
+    _Scheduler_strong_APA_indexed_Enqueue_scheduled,
+    _Scheduler_SMP_Do_nothing_register_idle
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+Thread_Control *_Scheduler_strong_APA_indexed_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Thread_Control    *idle;
+
+  idle = _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Enqueue
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+
+  return idle;
+}
+
+void _Scheduler_strong_APA_indexed_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    the_thread,
+    node,
+    _Scheduler_strong_APA_indexed_Extract_from_ready,
+    _Scheduler_strong_APA_indexed_Enqueue,
+    _Scheduler_strong_APA_indexed_Enqueue_scheduled
+  );
+  _Scheduler_strong_APA_indexed_Check_for_migrations( context );
+}
+
+bool _Scheduler_strong_APA_indexed_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node_base,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_Context                 *context;
+  Scheduler_strong_APA_indexed_Node *node;
+  States_Control                     current_state;
+  Processor_mask                     my_affinity;
+
+  context = _Scheduler_Get_context( scheduler );
+  _Processor_mask_And( &my_affinity, &context->Processors, affinity );
+
+  if ( _Processor_mask_Count( &my_affinity ) == 0 ) {
+    return false;
+  }
+
+  node = _Scheduler_strong_APA_indexed_Node_downcast( node_base );
+
+  if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) ) {
+    return true;
+  }
+
+  current_state = the_thread->current_state;
+
+  if ( _States_Is_ready( current_state ) ) {
+    _Scheduler_strong_APA_indexed_Block( scheduler, the_thread, node_base );
+  }
+
+  _Scheduler_strong_APA_indexed_Set_node_affinity( node, affinity );
+
+  if ( _States_Is_ready( current_state ) ) {
+    _Scheduler_strong_APA_indexed_Unblock( scheduler, the_thread, node_base );
+  }
+
+  return true;
+}
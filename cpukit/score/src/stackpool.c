@@ -0,0 +1,252 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief Stack Pool Allocator
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/stackpool.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/interr.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/stackimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+#define STACK_POOL_GUARD_PATTERN 0xa5
+
+typedef struct Stack_Pool_Slab {
+  struct Stack_Pool_Slab *next;
+} Stack_Pool_Slab;
+
+typedef struct {
+  ISR_lock_Control       Lock;
+  Stack_Pool_Slab       *free_slabs;
+  size_t                 header_size;
+  size_t                 guard_size;
+  Stack_Pool_Statistics  Stats;
+} Stack_Pool_Control;
+
+static Stack_Pool_Control _Stack_Pool = {
+  .Lock = ISR_LOCK_INITIALIZER( "Stack Pool" )
+};
+
+void _Stack_Pool_Initialize( size_t stack_space_size )
+{
+  const Stack_Pool_Configuration *config;
+  size_t                          header_size;
+  size_t                          guard_size;
+  size_t                          stack_size;
+
+  (void) stack_space_size;
+
+  config = &_Stack_Pool_Configuration;
+
+  /* Keep the stack area aligned */
+  header_size = _Heap_Align_up(
+    sizeof( Stack_Pool_Header ),
+    CPU_STACK_ALIGNMENT
+  );
+  _Stack_Pool.header_size = header_size;
+  guard_size = _Heap_Align_up( config->guard_size, CPU_STACK_ALIGNMENT );
+  _Stack_Pool.guard_size = guard_size;
+
+  stack_size = _Stack_Extend_size(
+    _Stack_Ensure_minimum( config->stack_size ),
+    true
+  );
+  _Stack_Pool.Stats.stack_size = stack_size;
+  _Stack_Pool.Stats.slab_size = header_size + guard_size + stack_size;
+  _Stack_Pool.Stats.maximum_free_slabs = (uint32_t) config->maximum;
+}
+
+static size_t _Stack_Pool_Get_stack_area_offset( void )
+{
+#if CPU_STACK_GROWS_UP == TRUE
+  return _Stack_Pool.header_size;
+#else
+  return _Stack_Pool.header_size + _Stack_Pool.guard_size;
+#endif
+}
+
+static char *_Stack_Pool_Get_guard( Stack_Pool_Header *header )
+{
+#if CPU_STACK_GROWS_UP == TRUE
+  /* An overflow goes beyond the end of the stack area */
+  return (char *) header + _Stack_Pool.header_size + header->stack_size;
+#else
+  /* An overflow goes below the begin of the stack area */
+  return (char *) header + _Stack_Pool.header_size;
+#endif
+}
+
+static bool _Stack_Pool_Is_guard_intact( const char *guard, size_t guard_size )
+{
+  size_t i;
+
+  for ( i = 0; i < guard_size; ++i ) {
+    if ( (unsigned char) guard[ i ] != STACK_POOL_GUARD_PATTERN ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void *_Stack_Pool_Allocate_from_workspace(
+  uint32_t kind,
+  size_t   stack_size
+)
+{
+  Stack_Pool_Header *header;
+  size_t             guard_size;
+
+  guard_size = _Stack_Pool.guard_size;
+  header = _Workspace_Allocate(
+    _Stack_Pool.header_size + guard_size + stack_size
+  );
+
+  if ( header == NULL ) {
+    return NULL;
+  }
+
+  header->kind = kind;
+  header->stack_size = stack_size;
+  memset(
+    _Stack_Pool_Get_guard( header ),
+    STACK_POOL_GUARD_PATTERN,
+    guard_size
+  );
+  return (char *) header + _Stack_Pool_Get_stack_area_offset();
+}
+
+void *_Stack_Pool_Allocate( size_t stack_size )
+{
+  ISR_lock_Context  lock_context;
+  Stack_Pool_Slab  *free_slab;
+
+  if ( stack_size > _Stack_Pool.Stats.stack_size ) {
+    _ISR_lock_ISR_disable_and_acquire( &_Stack_Pool.Lock, &lock_context );
+    ++_Stack_Pool.Stats.oversized;
+    _ISR_lock_Release_and_ISR_enable( &_Stack_Pool.Lock, &lock_context );
+
+    return _Stack_Pool_Allocate_from_workspace(
+      STACK_POOL_KIND_OVERSIZED,
+      stack_size
+    );
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &_Stack_Pool.Lock, &lock_context );
+  free_slab = _Stack_Pool.free_slabs;
+
+  if ( free_slab != NULL ) {
+    _Stack_Pool.free_slabs = free_slab->next;
+    --_Stack_Pool.Stats.free_slabs;
+    ++_Stack_Pool.Stats.hits;
+  } else {
+    ++_Stack_Pool.Stats.misses;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Stack_Pool.Lock, &lock_context );
+
+  if ( free_slab != NULL ) {
+    /* The guard region was checked when the slab was freed */
+    return free_slab;
+  }
+
+  return _Stack_Pool_Allocate_from_workspace(
+    STACK_POOL_KIND_SLAB,
+    _Stack_Pool.Stats.stack_size
+  );
+}
+
+void _Stack_Pool_Free( void *addr )
+{
+  ISR_lock_Context   lock_context;
+  Stack_Pool_Header *header;
+  Stack_Pool_Slab   *free_slab;
+
+  if ( addr == NULL ) {
+    return;
+  }
+
+  header = (Stack_Pool_Header *)
+    ( (char *) addr - _Stack_Pool_Get_stack_area_offset() );
+
+  if (
+    ( header->kind != STACK_POOL_KIND_SLAB
+      && header->kind != STACK_POOL_KIND_OVERSIZED )
+      || !_Stack_Pool_Is_guard_intact(
+        _Stack_Pool_Get_guard( header ),
+        _Stack_Pool.guard_size
+      )
+  ) {
+    _Internal_error( INTERNAL_ERROR_STACK_POOL_GUARD_CORRUPTED );
+  }
+
+  if ( header->kind == STACK_POOL_KIND_OVERSIZED ) {
+    _Workspace_Free( header );
+    return;
+  }
+
+  free_slab = addr;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Stack_Pool.Lock, &lock_context );
+
+  if ( _Stack_Pool.Stats.free_slabs < _Stack_Pool.Stats.maximum_free_slabs ) {
+    free_slab->next = _Stack_Pool.free_slabs;
+    _Stack_Pool.free_slabs = free_slab;
+    ++_Stack_Pool.Stats.free_slabs;
+    free_slab = NULL;
+  } else {
+    ++_Stack_Pool.Stats.overflows;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Stack_Pool.Lock, &lock_context );
+
+  if ( free_slab != NULL ) {
+    _Workspace_Free( header );
+  }
+}
+
+void _Stack_Pool_Get_statistics( Stack_Pool_Statistics *stats )
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Stack_Pool.Lock, &lock_context );
+  *stats = _Stack_Pool.Stats;
+  _ISR_lock_Release_and_ISR_enable( &_Stack_Pool.Lock, &lock_context );
+}
@@ -80,8 +80,8 @@ static void _Thread_Create_idle_for_CPU( Per_CPU_Control *cpu )
 #endif
 
   idle->is_idle = true;
-  idle->Start.Entry.adaptor = _Thread_Entry_adaptor_idle;
-  idle->Start.Entry.Kinds.Idle.entry = _Thread_Idle_body;
+  idle->Cold->Start.Entry.adaptor = _Thread_Entry_adaptor_idle;
+  idle->Cold->Start.Entry.Kinds.Idle.entry = _Thread_Idle_body;
 
   _Thread_Load_environment( idle );
 
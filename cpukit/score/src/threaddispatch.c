@@ -24,6 +24,7 @@
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/isr.h>
+#include <rtems/score/rcuimpl.h>
 #include <rtems/score/schedulerimpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
@@ -31,10 +32,6 @@
 #include <rtems/score/wkspace.h>
 #include <rtems/config.h>
 
-#if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-Thread_Control *_Thread_Allocated_fp;
-#endif
-
 CHAIN_DEFINE_EMPTY( _User_extensions_Switches_list );
 
 #if defined(RTEMS_SMP)
@@ -273,13 +270,17 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
   }
 #endif
 
+  _RCU_Quiescent_state( cpu_self );
   executing = cpu_self->executing;
 
   do {
-    Thread_Control *heir;
+    Thread_Control    *heir;
+    CPU_Counter_ticks  start_instant;
 
+    start_instant = _Profiling_Latency_start();
     level = _Thread_Preemption_intervention( executing, cpu_self, level );
     heir = _Thread_Get_heir_and_make_it_executing( cpu_self );
+    _Profiling_Latency_update( PER_CPU_LATENCY_THREAD_DISPATCH, start_instant );
 
     /*
      *  When the heir and executing are the same, then we are being
@@ -359,6 +360,45 @@ void _Thread_Dispatch_direct( Per_CPU_Control *cpu_self )
   _Thread_Do_dispatch( cpu_self, level );
 }
 
+#if defined(RTEMS_SMP)
+void _Thread_Dispatch_request_batch_flush( Per_CPU_Control *cpu_self )
+{
+  Processor_mask targets;
+  ISR_Level      level;
+  uint32_t       cpu_max;
+  uint32_t       cpu_index;
+
+  /*
+   * Interrupt service routines on this processor may issue thread dispatch
+   * requests concurrently, so fetch and clear the targets with interrupts
+   * disabled.
+   */
+  _ISR_Local_disable( level );
+  _Assert( cpu_self->Dispatch_requests.nest_level == 1 );
+  cpu_self->Dispatch_requests.nest_level = 0;
+  _Processor_mask_Assign( &targets, &cpu_self->Dispatch_requests.targets );
+  _Processor_mask_Zero( &cpu_self->Dispatch_requests.targets );
+  _ISR_Local_enable( level );
+
+  if ( _Processor_mask_Is_zero( &targets ) ) {
+    return;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &targets, cpu_index ) ) {
+      Per_CPU_Control *cpu_target;
+
+      cpu_target = _Per_CPU_Get_by_index( cpu_index );
+      _Atomic_Fetch_or_ulong( &cpu_target->message, 0, ATOMIC_ORDER_RELEASE );
+      _CPU_SMP_Send_interrupt( cpu_index );
+      ++cpu_self->Dispatch_requests.interrupts;
+    }
+  }
+}
+#endif
+
 void _Thread_Dispatch_enable( Per_CPU_Control *cpu_self )
 {
   uint32_t disable_level = cpu_self->thread_dispatch_disable_level;
@@ -20,7 +20,7 @@
 
 void _Thread_Entry_adaptor_idle( Thread_Control *executing )
 {
-  const Thread_Entry_idle *idle = &executing->Start.Entry.Kinds.Idle;
+  const Thread_Entry_idle *idle = &executing->Cold->Start.Entry.Kinds.Idle;
 
   ( *idle->entry )( 0 );
 }
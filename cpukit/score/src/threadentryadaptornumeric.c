@@ -20,7 +20,8 @@
 
 void _Thread_Entry_adaptor_numeric( Thread_Control *executing )
 {
-  const Thread_Entry_numeric *numeric = &executing->Start.Entry.Kinds.Numeric;
+  const Thread_Entry_numeric *numeric =
+    &executing->Cold->Start.Entry.Kinds.Numeric;
 
   ( *numeric->entry )( numeric->argument );
 }
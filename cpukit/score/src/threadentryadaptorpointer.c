@@ -20,7 +20,8 @@
 
 void _Thread_Entry_adaptor_pointer( Thread_Control *executing )
 {
-  const Thread_Entry_pointer *pointer = &executing->Start.Entry.Kinds.Pointer;
+  const Thread_Entry_pointer *pointer =
+    &executing->Cold->Start.Entry.Kinds.Pointer;
 
   executing->Wait.return_argument = ( *pointer->entry )( pointer->argument );
 }
@@ -87,7 +87,7 @@ void _Thread_Handler( void )
    * have to put level into a register for those cpu's that use
    * inline asm here
    */
-  level = executing->Start.isr_level;
+  level = executing->Cold->Start.isr_level;
   _ISR_Set_level( level );
 
   /*
@@ -136,7 +136,7 @@ void _Thread_Handler( void )
    *  thread/task prototype. The following code supports invoking the
    *  user thread entry point using the prototype expected.
    */
-  ( *executing->Start.Entry.adaptor )( executing );
+  ( *executing->Cold->Start.Entry.adaptor )( executing );
 
   /*
    *  In the call above, the return code from the user thread body which return
@@ -60,7 +60,7 @@ bool _Thread_Initialize(
 
   /* Set everything to perform the error case clean up */
   scheduler_index = 0;
-  the_thread->Start.allocated_stack = config->allocated_stack;
+  the_thread->Cold->Start.allocated_stack = config->allocated_stack;
 
 #if defined(RTEMS_SMP)
   if (
@@ -89,7 +89,7 @@ bool _Thread_Initialize(
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
   if ( config->is_fp ) {
     the_thread->fp_context = ( Context_Control_fp *) stack_area;
-    the_thread->Start.fp_context = ( Context_Control_fp *) stack_area;
+    the_thread->Cold->Start.fp_context = ( Context_Control_fp *) stack_area;
     stack_size -= CONTEXT_FP_SIZE;
     stack_area += CONTEXT_FP_SIZE;
   }
@@ -102,14 +102,14 @@ bool _Thread_Initialize(
     uintptr_t tls_align;
 
     tls_align = (uintptr_t) _TLS_Alignment;
-    the_thread->Start.tls_area = (void *)
+    the_thread->Cold->Start.tls_area = (void *)
       ( ( (uintptr_t) stack_area + tls_align - 1 ) & ~( tls_align - 1 ) );
     stack_size -= tls_size;
     stack_area += tls_size;
   }
 
   _Stack_Initialize(
-     &the_thread->Start.Initial_stack,
+     &the_thread->Cold->Start.Initial_stack,
      stack_area,
      stack_size
   );
@@ -127,10 +127,10 @@ bool _Thread_Initialize(
    */
 
   the_thread->is_fp                  = config->is_fp;
-  the_thread->Start.isr_level        = config->isr_level;
-  the_thread->Start.is_preemptible   = config->is_preemptible;
-  the_thread->Start.budget_algorithm = config->budget_algorithm;
-  the_thread->Start.budget_callout   = config->budget_callout;
+  the_thread->Cold->Start.isr_level        = config->isr_level;
+  the_thread->Cold->Start.is_preemptible   = config->is_preemptible;
+  the_thread->Cold->Start.budget_algorithm = config->budget_algorithm;
+  the_thread->Cold->Start.budget_callout   = config->budget_callout;
 
   _Thread_Timer_initialize( &the_thread->Timer, cpu );
 
@@ -230,13 +230,13 @@ bool _Thread_Initialize(
 
   the_thread->current_state           = STATES_DORMANT;
   the_thread->Wait.operations         = &_Thread_queue_Operations_default;
-  the_thread->Start.initial_priority  = config->priority;
+  the_thread->Cold->Start.initial_priority  = config->priority;
 
   RTEMS_STATIC_ASSERT( THREAD_WAIT_FLAGS_INITIAL == 0, Wait_flags );
 
   /* POSIX Keys */
-  _RBTree_Initialize_empty( &the_thread->Keys.Key_value_pairs );
-  _ISR_lock_Initialize( &the_thread->Keys.Lock, "POSIX Key Value Pairs" );
+  _RBTree_Initialize_empty( &the_thread->Cold->Keys.Key_value_pairs );
+  _ISR_lock_Initialize( &the_thread->Cold->Keys.Lock, "POSIX Key Value Pairs" );
 
   _Thread_Action_control_initialize( &the_thread->Post_switch_actions );
 
@@ -278,6 +278,6 @@ failed:
     &information->Thread_queue_heads.Free,
     the_thread->Wait.spare_heads
   );
-  _Stack_Free( the_thread->Start.allocated_stack );
+  _Stack_Free( the_thread->Cold->Start.allocated_stack );
   return false;
 }
@@ -26,23 +26,34 @@ void _Thread_Load_environment(
 )
 {
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-  if ( the_thread->Start.fp_context ) {
-    the_thread->fp_context = the_thread->Start.fp_context;
+  if ( the_thread->Cold->Start.fp_context ) {
+    the_thread->fp_context = the_thread->Cold->Start.fp_context;
     _Context_Initialize_fp( &the_thread->fp_context );
   }
 #endif
 
-  the_thread->is_preemptible   = the_thread->Start.is_preemptible;
-  the_thread->budget_algorithm = the_thread->Start.budget_algorithm;
-  the_thread->budget_callout   = the_thread->Start.budget_callout;
+#if ( CPU_HARDWARE_FP == TRUE || CPU_SOFTWARE_FP == TRUE ) \
+  && CPU_USE_DEFERRED_FP_SWITCH == TRUE
+  /*
+   * A restarted thread must not use the floating point context of its
+   * previous life still loaded in the floating point unit.  A thread which
+   * restarts itself takes the ownership again in _Thread_Life_action_handler()
+   * once its initial floating point context is loaded.
+   */
+  _Thread_Deallocate_fp( the_thread );
+#endif
+
+  the_thread->is_preemptible   = the_thread->Cold->Start.is_preemptible;
+  the_thread->budget_algorithm = the_thread->Cold->Start.budget_algorithm;
+  the_thread->budget_callout   = the_thread->Cold->Start.budget_callout;
 
   _Context_Initialize(
     &the_thread->Registers,
-    the_thread->Start.Initial_stack.area,
-    the_thread->Start.Initial_stack.size,
-    the_thread->Start.isr_level,
+    the_thread->Cold->Start.Initial_stack.area,
+    the_thread->Cold->Start.Initial_stack.size,
+    the_thread->Cold->Start.isr_level,
     _Thread_Handler,
     the_thread->is_fp,
-    the_thread->Start.tls_area
+    the_thread->Cold->Start.tls_area
   );
 }
@@ -695,12 +695,18 @@ void _Thread_queue_Surrender(
     &queue_context->Lock_context.Lock_context
   );
 
+  /*
+   * The priority updates and the unblock of the new owner may request thread
+   * dispatches on other processors, so send them in one batch.
+   */
+  _Thread_Dispatch_request_batch_begin( cpu_self );
   _Thread_Priority_update( queue_context );
 
   if ( unblock ) {
     _Thread_Remove_timer_and_unblock( new_owner, queue );
   }
 
+  _Thread_Dispatch_request_batch_end( cpu_self );
   _Thread_Dispatch_enable( cpu_self );
 }
 
@@ -733,8 +739,10 @@ void _Thread_queue_Surrender_sticky(
     queue,
     &queue_context->Lock_context.Lock_context
   );
+  _Thread_Dispatch_request_batch_begin( cpu_self );
   _Thread_Priority_and_sticky_update( previous_owner, -1 );
   _Thread_Priority_and_sticky_update( new_owner, 0 );
+  _Thread_Dispatch_request_batch_end( cpu_self );
   _Thread_Dispatch_enable( cpu_self );
 }
 #endif
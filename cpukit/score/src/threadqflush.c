@@ -128,6 +128,12 @@ size_t _Thread_queue_Flush_critical(
     cpu_self = _Thread_queue_Dispatch_disable( queue_context );
     _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
 
+    /*
+     * Unblock all threads in one batch, so that each processor which needs a
+     * thread dispatch receives at most one inter-processor interrupt.
+     */
+    _Thread_Dispatch_request_batch_begin( cpu_self );
+
     do {
       Scheduler_Node *scheduler_node;
       Thread_Control *the_thread;
@@ -149,6 +155,7 @@ size_t _Thread_queue_Flush_critical(
       _Thread_State_release( owner, &lock_context );
     }
 
+    _Thread_Dispatch_request_batch_end( cpu_self );
     _Thread_Dispatch_enable( cpu_self );
   } else {
     _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
@@ -0,0 +1,133 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQ
+ *
+ * @brief Thread Queue Spin on Owner
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+#include <rtems/score/threadimpl.h>
+
+/*
+ * The maximum count of busy wait iterations between two owner checks.  It
+ * limits the exponential backoff to keep the reaction time short.
+ */
+#define THREAD_QUEUE_SPIN_BACKOFF_MAXIMUM 64
+
+static bool _Thread_queue_Is_owner_executing(
+  const Thread_queue_Queue *queue,
+  const Thread_Control     *owner,
+  const Per_CPU_Control    *owner_cpu
+)
+{
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  return queue->owner == owner && owner_cpu->executing == owner;
+}
+
+bool _Thread_queue_Spin_on_owner(
+  Thread_queue_Queue   *queue,
+  Thread_Control       *owner,
+  Thread_Control       *executing,
+  Thread_queue_Context *queue_context
+)
+{
+  const Per_CPU_Control *owner_cpu;
+  uint32_t               limit;
+  uint32_t               backoff;
+  uint32_t               i;
+  bool                   acquired;
+
+  limit = _Thread_queue_Spin_limit;
+
+  if ( limit == 0 ) {
+    return false;
+  }
+
+  /*
+   * The owner control may go away after the release of the thread queue lock.
+   * Use only the processor of the owner at this point in time and do not
+   * dereference the owner during the spinning.
+   */
+  owner_cpu = _Thread_Get_CPU( owner );
+
+  if ( owner_cpu->executing != owner ) {
+#if defined(RTEMS_PROFILING)
+    ++_Per_CPU_Get()->Stats.mutex_block_count;
+#endif
+    return false;
+  }
+
+  _Thread_queue_Queue_release(
+    queue,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  backoff = 1;
+
+  for ( i = 0; i < limit; ++i ) {
+    uint32_t j;
+
+    for ( j = 0; j < backoff; ++j ) {
+      RTEMS_COMPILER_MEMORY_BARRIER();
+    }
+
+    if ( !_Thread_queue_Is_owner_executing( queue, owner, owner_cpu ) ) {
+      break;
+    }
+
+    if ( backoff < THREAD_QUEUE_SPIN_BACKOFF_MAXIMUM ) {
+      backoff *= 2;
+    }
+  }
+
+  _ISR_lock_ISR_disable( &queue_context->Lock_context.Lock_context );
+  _Thread_queue_Queue_acquire_critical(
+    queue,
+    &executing->Potpourri_stats,
+    &queue_context->Lock_context.Lock_context
+  );
+
+  acquired = ( queue->owner == NULL );
+
+#if defined(RTEMS_PROFILING)
+  if ( acquired ) {
+    ++_Per_CPU_Get()->Stats.mutex_spin_acquire_count;
+  } else {
+    ++_Per_CPU_Get()->Stats.mutex_block_count;
+  }
+#endif
+
+  return acquired;
+}
@@ -158,7 +158,7 @@ static void _Thread_Free( Thread_Control *the_thread )
 
   _User_extensions_Thread_delete( the_thread );
   _User_extensions_Destroy_iterators( the_thread );
-  _ISR_lock_Destroy( &the_thread->Keys.Lock );
+  _ISR_lock_Destroy( &the_thread->Cold->Keys.Lock );
   _Scheduler_Node_destroy(
     _Thread_Scheduler_get_home( the_thread ),
     _Thread_Scheduler_get_home_node( the_thread )
@@ -168,11 +168,9 @@ static void _Thread_Free( Thread_Control *the_thread )
   /*
    *  The thread might have been FP.  So deal with that.
    */
-#if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-#if ( CPU_USE_DEFERRED_FP_SWITCH == TRUE )
-  if ( _Thread_Is_allocated_fp( the_thread ) )
-    _Thread_Deallocate_fp();
-#endif
+#if ( CPU_HARDWARE_FP == TRUE || CPU_SOFTWARE_FP == TRUE ) \
+  && CPU_USE_DEFERRED_FP_SWITCH == TRUE
+  _Thread_Deallocate_fp( the_thread );
 #endif
 
   _Freechain_Put(
@@ -184,7 +182,7 @@ static void _Thread_Free( Thread_Control *the_thread )
    *  Free the rest of the memory associated with this task
    *  and set the associated pointers to NULL for safety.
    */
-  _Stack_Free( the_thread->Start.allocated_stack );
+  _Stack_Free( the_thread->Cold->Start.allocated_stack );
 
 #if defined(RTEMS_SMP)
   _ISR_lock_Destroy( &the_thread->Scheduler.Lock );
@@ -258,9 +256,9 @@ static Thread_Life_state _Thread_Change_life_locked(
     _Thread_Is_life_change_allowed( state )
       && _Thread_Is_life_changing( state )
   ) {
-    the_thread->is_preemptible   = the_thread->Start.is_preemptible;
-    the_thread->budget_algorithm = the_thread->Start.budget_algorithm;
-    the_thread->budget_callout   = the_thread->Start.budget_callout;
+    the_thread->is_preemptible   = the_thread->Cold->Start.is_preemptible;
+    the_thread->budget_algorithm = the_thread->Cold->Start.budget_algorithm;
+    the_thread->budget_callout   = the_thread->Cold->Start.budget_callout;
 
     _Thread_Add_post_switch_action(
       the_thread,
@@ -358,6 +356,22 @@ void _Thread_Life_action_handler(
 
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
   if ( executing->fp_context != NULL ) {
+#if ( CPU_USE_DEFERRED_FP_SWITCH == TRUE )
+    Thread_Control *fp_owner;
+
+    /*
+     * The restarted thread continues with its initial floating point context
+     * loaded in the floating point unit, so it becomes the owner.  The
+     * context of another owner must be saved before it is overwritten.
+     */
+    fp_owner = cpu_self->fp_owner;
+
+    if ( fp_owner != NULL && fp_owner != executing ) {
+      _Context_Save_fp( &fp_owner->fp_context );
+    }
+
+    cpu_self->fp_owner = executing;
+#endif
     _Context_Restore_fp( &executing->fp_context );
   }
 #endif
@@ -572,7 +586,7 @@ bool _Thread_Restart_other(
     return false;
   }
 
-  the_thread->Start.Entry = *entry;
+  the_thread->Cold->Start.Entry = *entry;
   previous = _Thread_Change_life_locked(
     the_thread,
     0,
@@ -588,7 +602,7 @@ bool _Thread_Restart_other(
 
     _Thread_Finalize_life_change(
       the_thread,
-      the_thread->Start.initial_priority
+      the_thread->Cold->Start.initial_priority
     );
   } else {
     _Thread_Clear_state_locked( the_thread, STATES_SUSPENDED );
@@ -620,7 +634,7 @@ void _Thread_Restart_self(
   _Thread_queue_Context_clear_priority_updates( &queue_context );
   _Thread_State_acquire_critical( executing, lock_context );
 
-  executing->Start.Entry = *entry;
+  executing->Cold->Start.Entry = *entry;
   _Thread_Change_life_locked(
     executing,
     0,
@@ -635,7 +649,7 @@ void _Thread_Restart_self(
   _Thread_Priority_change(
     executing,
     &executing->Real_priority,
-    executing->Start.initial_priority,
+    executing->Cold->Start.initial_priority,
     false,
     &queue_context
   );
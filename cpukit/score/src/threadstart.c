@@ -38,7 +38,7 @@ bool _Thread_Start(
     return false;
   }
 
-  the_thread->Start.Entry = *entry;
+  the_thread->Cold->Start.Entry = *entry;
   _Thread_Load_environment( the_thread );
   _Thread_Clear_state_locked( the_thread, STATES_ALL_SET );
 
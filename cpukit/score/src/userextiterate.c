@@ -189,8 +189,8 @@ void _User_extensions_Iterate(
   );
 
   if ( executing != NULL ) {
-    iter.previous = executing->last_user_extensions_iterator;
-    executing->last_user_extensions_iterator = &iter;
+    iter.previous = executing->Cold->last_user_extensions_iterator;
+    executing->Cold->last_user_extensions_iterator = &iter;
   }
 
   while ( ( node = _Chain_Iterator_next( &iter.Iterator ) ) != end ) {
@@ -207,7 +207,7 @@ void _User_extensions_Iterate(
   }
 
   if ( executing != NULL ) {
-    executing->last_user_extensions_iterator = iter.previous;
+    executing->Cold->last_user_extensions_iterator = iter.previous;
   }
 
   _Chain_Iterator_destroy( &iter.Iterator );
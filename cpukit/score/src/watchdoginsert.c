@@ -39,6 +39,16 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if ( header->wheel != NULL ) {
+    Watchdog_Wheel *wheel;
+
+    wheel = header->wheel;
+    the_watchdog->expire = expire;
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+    _Watchdog_Wheel_place( wheel, the_watchdog, wheel->now + 1 );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -0,0 +1,118 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief _Watchdog_Header_next_expiration() Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+static uint64_t _Watchdog_Wheel_next_expiration( const Watchdog_Wheel *wheel )
+{
+  uint64_t     next;
+  uint64_t     now;
+  unsigned int level;
+
+  next = WATCHDOG_MAXIMUM_TICKS;
+  now = wheel->now;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    unsigned int shift;
+    uint64_t     i;
+
+    shift = WATCHDOG_WHEEL_SLOT_BITS * level;
+
+    /*
+     * On level zero, the watchdogs of a slot expire at the ticks value
+     * associated with the slot.  On the higher levels, the watchdogs of a slot
+     * move to the lower levels at the ticks value associated with the slot.
+     */
+    for ( i = 1; i <= WATCHDOG_WHEEL_SLOT_COUNT; ++i ) {
+      uint64_t candidate;
+
+      if ( level == 0 ) {
+        candidate = now + i;
+      } else {
+        candidate = ( ( now >> shift ) + i ) << shift;
+      }
+
+      if ( candidate >= next ) {
+        break;
+      }
+
+      if (
+        !_Chain_Is_empty(
+          &wheel->Slots[ level ][
+            ( candidate >> shift ) & ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+          ]
+        )
+      ) {
+        next = candidate;
+        break;
+      }
+    }
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Overflow ) ) {
+    unsigned int shift;
+    uint64_t     candidate;
+
+    shift = WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT;
+    candidate = ( ( now >> shift ) + 1 ) << shift;
+
+    if ( candidate < next ) {
+      next = candidate;
+    }
+  }
+
+  return next;
+}
+
+uint64_t _Watchdog_Header_next_expiration( const Watchdog_Header *header )
+{
+  const Watchdog_Control *first;
+
+  if ( header->wheel != NULL ) {
+    return _Watchdog_Wheel_next_expiration( header->wheel );
+  }
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return WATCHDOG_MAXIMUM_TICKS;
+  }
+
+  return first->expire;
+}
@@ -51,37 +51,108 @@ void _Watchdog_Do_tickle(
   } while ( first != NULL );
 }
 
-void _Watchdog_Tick( Per_CPU_Control *cpu )
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  Chain_Control  *slot,
+  uint64_t        now
+)
 {
-  ISR_lock_Context  lock_context;
-  Watchdog_Header  *header;
-  Watchdog_Control *first;
-  uint64_t          ticks;
-  struct timespec   now;
+  Chain_Control  watchdogs;
+  Chain_Node    *node;
 
-  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
-    ++_Watchdog_Ticks_since_boot;
+  /*
+   * Watchdogs of the overflow chain may move back to the overflow chain, so
+   * detach the watchdogs first.
+   */
+  _Chain_Initialize_empty( &watchdogs );
+
+  while ( ( node = _Chain_Get_unprotected( slot ) ) != NULL ) {
+    _Chain_Append_unprotected( &watchdogs, node );
   }
 
-  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  while ( ( node = _Chain_Get_unprotected( &watchdogs ) ) != NULL ) {
+    _Watchdog_Wheel_place(
+      wheel,
+      RTEMS_CONTAINER_OF( node, Watchdog_Control, Node.Chain ),
+      now
+    );
+  }
+}
 
-  ticks = cpu->Watchdog.ticks;
-  _Assert( ticks < UINT64_MAX );
-  ++ticks;
-  cpu->Watchdog.ticks = ticks;
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  Watchdog_Wheel *wheel;
+  Chain_Control  *slot;
+  unsigned int    level;
+
+  wheel = header->wheel;
+  _Assert( now == wheel->now + 1 );
+
+  /*
+   * Determine the highest level which reached a slot boundary and move the
+   * watchdogs of the reached slots level by level down to level zero.
+   */
+  level = 0;
+
+  while (
+    level < WATCHDOG_WHEEL_LEVEL_COUNT
+      && ( now & ( ( UINT64_C( 1 )
+        << ( WATCHDOG_WHEEL_SLOT_BITS * ( level + 1 ) ) ) - 1 ) ) == 0
+  ) {
+    ++level;
+  }
 
-  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
+  while ( level > 0 ) {
+    if ( level == WATCHDOG_WHEEL_LEVEL_COUNT ) {
+      slot = &wheel->Overflow;
+    } else {
+      slot = &wheel->Slots[ level ][
+        ( now >> ( WATCHDOG_WHEEL_SLOT_BITS * level ) )
+          & ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+      ];
+    }
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
-      header,
-      first,
-      ticks,
-      &cpu->Watchdog.Lock,
-      &lock_context
+    _Watchdog_Wheel_cascade( wheel, slot, now );
+    --level;
+  }
+
+  wheel->now = now;
+  slot = &wheel->Slots[ 0 ][ now & ( WATCHDOG_WHEEL_SLOT_COUNT - 1 ) ];
+
+  while ( !_Chain_Is_empty( slot ) ) {
+    Watchdog_Control               *first;
+    Watchdog_Service_routine_entry  routine;
+
+    first = RTEMS_CONTAINER_OF(
+      _Chain_Get_first_unprotected( slot ),
+      Watchdog_Control,
+      Node.Chain
     );
+    _Assert( first->expire <= now );
+    _Watchdog_Set_state( first, WATCHDOG_INACTIVE );
+    routine = first->routine;
+
+    _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+    ( *routine )( first );
+    _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
   }
+}
+
+static void _Watchdog_Do_tickle_clocks(
+  Per_CPU_Control  *cpu,
+  ISR_lock_Context *lock_context
+)
+{
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+  struct timespec   now;
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
   first = _Watchdog_Header_first( header );
@@ -93,7 +164,7 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
       first,
       _Watchdog_Ticks_from_timespec( &now ),
       &cpu->Watchdog.Lock,
-      &lock_context
+      lock_context
     );
   }
 
@@ -107,11 +178,63 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
       first,
       _Watchdog_Ticks_from_timespec( &now ),
       &cpu->Watchdog.Lock,
+      lock_context
+    );
+  }
+}
+
+void _Watchdog_Tick( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  Watchdog_Control *first;
+  uint64_t          ticks;
+
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+    ++_Watchdog_Ticks_since_boot;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  ticks = cpu->Watchdog.ticks;
+  _Assert( ticks < UINT64_MAX );
+  ++ticks;
+  cpu->Watchdog.ticks = ticks;
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+  if ( header->wheel != NULL ) {
+    _Watchdog_Tickle_wheel(
+      header,
+      ticks,
+      &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
+  _Watchdog_Do_tickle_clocks( cpu, &lock_context );
   _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
 
   _Scheduler_Tick( cpu );
 }
+
+void _Watchdog_Tickle_clocks( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  _Watchdog_Do_tickle_clocks( cpu, &lock_context );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
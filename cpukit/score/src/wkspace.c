@@ -52,7 +52,7 @@ void _Workspace_Handler_initialization(
 
   page_size = CPU_HEAP_ALIGNMENT;
   remaining = rtems_configuration_get_work_space_size();
-  init_or_extend = _Heap_Initialize;
+  init_or_extend = _Workspace_Heap_initialize;
   unified = rtems_configuration_get_unified_work_area();
   overhead = _Heap_Area_overhead( page_size );
 
@@ -109,6 +109,11 @@ void *_Workspace_Allocate( size_t size )
   return _Heap_Allocate( &_Workspace_Area, size );
 }
 
+void *_Workspace_Allocate_aligned( size_t size, size_t alignment )
+{
+  return _Heap_Allocate_aligned( &_Workspace_Area, size, alignment );
+}
+
 void _Workspace_Free( void *block )
 {
   _Heap_Free( &_Workspace_Area, block );
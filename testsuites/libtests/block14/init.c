@@ -56,7 +56,7 @@ static const test_action actions [ACTION_COUNT] = {
   { 5, rtems_bdbuf_get, RTEMS_SUCCESSFUL, rtems_bdbuf_sync }
 };
 
-#define STATS(a, b, c, d, e, f, g, h) \
+#define STATS(a, b, c, d, e, f, g, h, i) \
   { \
     .read_hits = a, \
     .read_misses = b, \
@@ -65,17 +65,18 @@ static const test_action actions [ACTION_COUNT] = {
     .read_errors = e, \
     .write_transfers = f, \
     .write_blocks = g, \
-    .write_errors = h \
+    .write_errors = h, \
+    .promotions = i \
   }
 
 static const rtems_blkdev_stats expected_stats [ACTION_COUNT] = {
-  STATS(0, 1, 0, 1, 0, 0, 0, 0),
-  STATS(0, 2, 1, 3, 0, 0, 0, 0),
-  STATS(1, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 2, 2, 1)
+  STATS(0, 1, 0, 1, 0, 0, 0, 0, 0),
+  STATS(0, 2, 1, 3, 0, 0, 0, 0, 0),
+  STATS(1, 2, 2, 4, 0, 0, 0, 0, 0),
+  STATS(2, 2, 2, 4, 0, 0, 0, 0, 0),
+  STATS(2, 2, 2, 4, 0, 1, 1, 0, 0),
+  STATS(2, 3, 2, 5, 1, 1, 1, 0, 0),
+  STATS(2, 3, 2, 5, 1, 2, 2, 1, 0)
 };
 
 static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
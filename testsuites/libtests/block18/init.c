@@ -0,0 +1,229 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/bdbuf.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#define DISK_COUNT 4
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 64
+
+#define ACCESS_COUNT 20000
+
+typedef struct {
+  rtems_disk_device *dds[DISK_COUNT];
+  uint32_t seed;
+  char disk_data[DISK_COUNT][BLOCK_COUNT * BLOCK_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static int disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  char *disk_data = rtems_disk_get_driver_data(dd);
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *r = arg;
+    uint32_t i;
+
+    for (i = 0; i < r->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &r->bufs[i];
+      char *data = &disk_data[sg->block * BLOCK_SIZE];
+
+      if (r->req == RTEMS_BLKDEV_REQ_READ) {
+        memcpy(sg->buffer, data, sg->length);
+      } else {
+        memcpy(data, sg->buffer, sg->length);
+      }
+    }
+
+    rtems_blkdev_request_done(r, RTEMS_SUCCESSFUL);
+    return 0;
+  }
+
+  return rtems_blkdev_ioctl(dd, req, arg);
+}
+
+static void create_disks(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    rtems_status_code sc;
+    char path[] = "/dev/bd0";
+    int fd;
+    int rv;
+
+    path[sizeof(path) - 2] = (char) ('0' + i);
+
+    sc = rtems_blkdev_create(
+      path,
+      BLOCK_SIZE,
+      BLOCK_COUNT,
+      disk_ioctl,
+      &ctx->disk_data[i][0]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    fd = open(path, O_RDWR);
+    rtems_test_assert(fd >= 0);
+
+    rv = rtems_disk_fd_get_disk_device(fd, &ctx->dds[i]);
+    rtems_test_assert(rv == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->seed = ctx->seed * 1664525 + 1013904223;
+  return ctx->seed >> 16;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * Fills the cache with all blocks of the active disks and measures the
+ * duration of cache hits at random blocks of these disks.  Only one task
+ * accesses the cache, so this measures the lookup cost with respect to the
+ * count of cached buffers and not the cache lock contention.
+ */
+static void run(test_context *ctx, size_t active_disks)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  size_t i;
+  rtems_blkdev_bnum block;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    rtems_bdbuf_purge_dev(ctx->dds[i]);
+  }
+
+  for (i = 0; i < active_disks; ++i) {
+    for (block = 0; block < BLOCK_COUNT; ++block) {
+      read_block(ctx->dds[i], block);
+    }
+  }
+
+  ctx->seed = 1;
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < ACCESS_COUNT; ++i) {
+    uint32_t r;
+
+    r = next_random(ctx);
+    read_block(ctx->dds[r % active_disks], (r / DISK_COUNT) % BLOCK_COUNT);
+  }
+
+  t1 = rtems_counter_read();
+
+  printf(
+    "  <Run disks=\"%zu\" cachedBuffers=\"%zu\" accesses=\"%i\" "
+      "duration=\"%" PRIu64 "\" unit=\"ns\"/>\n",
+    active_disks,
+    active_disks * BLOCK_COUNT,
+    ACCESS_COUNT,
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0))
+  );
+}
+
+static void test(test_context *ctx)
+{
+  size_t active_disks;
+
+  create_disks(ctx);
+
+  printf("<BlockBenchmark>\n");
+
+  for (active_disks = 1; active_disks <= DISK_COUNT; ++active_disks) {
+    run(ctx, active_disks);
+  }
+
+  printf("</BlockBenchmark>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE \
+  (DISK_COUNT * BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
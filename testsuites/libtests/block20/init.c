@@ -0,0 +1,269 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define BLOCK_COUNT 64
+
+#define STREAM_LENGTH 16
+
+#define STREAM_A_BEGIN 0
+
+#define STREAM_B_BEGIN 32
+
+#define DISK_PATH "/disk"
+
+#define SHRINK_DISK_PATH "/shrink"
+
+#define TRANSFER_MAX 16
+
+typedef struct {
+  rtems_blkdev_bnum block;
+  uint32_t count;
+} transfer;
+
+static transfer transfers[TRANSFER_MAX];
+
+static size_t transfer_count;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static int shrink_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+    rtems_test_assert(transfer_count < TRANSFER_MAX);
+    transfers[transfer_count].block = breq->bufs[0].block;
+    transfers[transfer_count].count = breq->bufnum;
+    ++transfer_count;
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static rtems_disk_device *create_disk(
+  const char *path,
+  rtems_block_device_ioctl handler
+)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(path, 1, BLOCK_COUNT, handler, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return dd;
+}
+
+static void check_transfer(
+  size_t index,
+  rtems_blkdev_bnum block,
+  uint32_t count
+)
+{
+  rtems_test_assert(index < transfer_count);
+  rtems_test_assert(transfers[index].block == block);
+  rtems_test_assert(transfers[index].count == count);
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_interleaved_streams(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum i;
+
+  for (i = 0; i < STREAM_LENGTH; ++i) {
+    read_block(dd, STREAM_A_BEGIN + i);
+    read_block(dd, STREAM_B_BEGIN + i);
+  }
+
+  /*
+   * Each stream misses the first two blocks, afterwards the read-ahead of
+   * each stream keeps up with the reads.
+   */
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_hits == 2 * STREAM_LENGTH - 4);
+  rtems_test_assert(stats.read_ahead_transfers == 8);
+  rtems_test_assert(stats.evictions == 0);
+}
+
+static void test_shrinking_window(
+  rtems_disk_device *dd,
+  rtems_disk_device *other
+)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum i;
+
+  /* The second read of the stream starts a read-ahead of a full window */
+  read_block(dd, 0);
+  read_block(dd, 1);
+  rtems_test_assert(transfer_count == 3);
+  check_transfer(0, 0, 1);
+  check_transfer(1, 1, 1);
+  check_transfer(2, 2, 4);
+
+  /* Recycle the read-ahead blocks before the stream uses them */
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    read_block(other, i);
+  }
+
+  rtems_test_assert(transfer_count == 3);
+
+  /*
+   * The stream misses a block of its previous read-ahead request, so the
+   * window shrinks to one half.
+   */
+  read_block(dd, 2);
+  read_block(dd, 3);
+  rtems_test_assert(transfer_count == 6);
+  check_transfer(3, 2, 1);
+  check_transfer(4, 3, 1);
+  check_transfer(5, 4, 2);
+
+  /* The stream consumed the read-ahead blocks, so the window grows again */
+  read_block(dd, 4);
+  read_block(dd, 5);
+  rtems_test_assert(transfer_count == 7);
+  check_transfer(6, 6, 4);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_hits == 2);
+  rtems_test_assert(stats.read_ahead_transfers == 3);
+}
+
+static void test(void)
+{
+  rtems_disk_device *dd;
+  rtems_disk_device *shrink_dd;
+  int rv;
+
+  dd = create_disk(DISK_PATH, test_disk_ioctl);
+  shrink_dd = create_disk(SHRINK_DISK_PATH, shrink_disk_ioctl);
+
+  test_interleaved_streams(dd);
+  test_shrinking_window(shrink_dd, dd);
+
+  rv = unlink(SHRINK_DISK_PATH);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 4
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,347 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/bdbuf.h>
+#include <rtems/counter.h>
+#include <rtems/thread.h>
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define READER_COUNT 4
+
+#define BLOCK_SIZE 512
+
+#define REGION_BLOCK_COUNT 64
+
+#define BLOCK_COUNT (READER_COUNT * REGION_BLOCK_COUNT)
+
+#define MAX_READ_AHEAD_BLOCKS 8
+
+#define MAX_QUEUE_DEPTH 8
+
+#define QUEUE_SIZE 16
+
+typedef struct {
+  rtems_id id;
+  rtems_blkdev_bnum begin;
+} reader_context;
+
+typedef struct {
+  rtems_id master;
+  rtems_id controller;
+  rtems_disk_device *dd;
+  uint32_t queue_depth;
+  rtems_mutex mutex;
+  rtems_blkdev_request *queue[QUEUE_SIZE];
+  size_t head;
+  size_t tail;
+  uint32_t requests;
+  reader_context readers[READER_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .mutex = RTEMS_MUTEX_INITIALIZER("Queue")
+};
+
+static void enqueue_request(test_context *ctx, rtems_blkdev_request *r)
+{
+  rtems_mutex_lock(&ctx->mutex);
+  rtems_test_assert(ctx->tail - ctx->head < QUEUE_SIZE);
+  ctx->queue[ctx->tail % QUEUE_SIZE] = r;
+  ++ctx->tail;
+  ++ctx->requests;
+  rtems_mutex_unlock(&ctx->mutex);
+}
+
+static rtems_blkdev_request *dequeue_request(test_context *ctx)
+{
+  rtems_blkdev_request *r;
+
+  rtems_mutex_lock(&ctx->mutex);
+
+  if (ctx->head != ctx->tail) {
+    r = ctx->queue[ctx->head % QUEUE_SIZE];
+    ++ctx->head;
+  } else {
+    r = NULL;
+  }
+
+  rtems_mutex_unlock(&ctx->mutex);
+
+  return r;
+}
+
+static int disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  test_context *ctx = &test_instance;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *r = arg;
+
+    rtems_test_assert(r->req == RTEMS_BLKDEV_REQ_READ);
+    enqueue_request(ctx, r);
+    return 0;
+  } else if (req == RTEMS_BLKIO_GETQUEUEDEPTH) {
+    *(uint32_t *) arg = ctx->queue_depth;
+    return 0;
+  }
+
+  return rtems_blkdev_ioctl(dd, req, arg);
+}
+
+/*
+ * The simulated controller needs one clock tick to carry out a request.  It
+ * processes up to queue depth requests in parallel.
+ */
+static void controller_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    uint32_t i;
+
+    rtems_task_wake_after(1);
+
+    for (i = 0; i < ctx->queue_depth; ++i) {
+      rtems_blkdev_request *r;
+      uint32_t j;
+
+      r = dequeue_request(ctx);
+      if (r == NULL) {
+        break;
+      }
+
+      for (j = 0; j < r->bufnum; ++j) {
+        memset(r->bufs[j].buffer, 0, r->bufs[j].length);
+      }
+
+      rtems_blkdev_request_done(r, RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+static void reader_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  reader_context *rc = &ctx->readers[arg];
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_blkdev_bnum i;
+
+    for (i = 0; i < REGION_BLOCK_COUNT; ++i) {
+      rtems_bdbuf_buffer *bd;
+
+      sc = rtems_bdbuf_read(ctx->dd, rc->begin + i, &bd);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_bdbuf_release(bd);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_suspend(RTEMS_SELF);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void start_tasks(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  sc = rtems_task_create(
+    rtems_build_name('C', 'T', 'R', 'L'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->controller
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->controller, controller_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < READER_COUNT; ++i) {
+    ctx->readers[i].begin = i * REGION_BLOCK_COUNT;
+
+    sc = rtems_task_create(
+      rtems_build_name('R', 'E', 'A', (char) ('0' + i)),
+      4,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->readers[i].id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->readers[i].id, reader_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_suspend(ctx->readers[i].id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void run(test_context *ctx, uint32_t queue_depth)
+{
+  rtems_status_code sc;
+  rtems_blkdev_stats stats;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t duration;
+  uint32_t actual_queue_depth;
+  char path[] = "/dev/qd0";
+  size_t i;
+  int fd;
+  int rv;
+
+  /* Each queue depth needs a new disk, since it is queried at disk creation */
+  path[sizeof(path) - 2] = (char) ('0' + queue_depth);
+  ctx->queue_depth = queue_depth;
+  ctx->requests = 0;
+
+  sc = rtems_blkdev_create(path, BLOCK_SIZE, BLOCK_COUNT, disk_ioctl, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_queue_depth(fd, &actual_queue_depth);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(actual_queue_depth == queue_depth);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &ctx->dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < READER_COUNT; ++i) {
+    sc = rtems_task_resume(ctx->readers[i].id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < READER_COUNT; ++i) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  t1 = rtems_counter_read();
+  duration = rtems_counter_ticks_to_nanoseconds(
+    rtems_counter_difference(t1, t0)
+  );
+
+  rtems_bdbuf_get_device_stats(ctx->dd, &stats);
+  rtems_test_assert(stats.read_errors == 0);
+
+  printf(
+    "  <Run queueDepth=\"%" PRIu32 "\" readers=\"%i\" blocks=\"%i\" "
+      "requests=\"%" PRIu32 "\" readAheadTransfers=\"%" PRIu32 "\" "
+      "duration=\"%" PRIu64 "\" unit=\"ns\" iops=\"%" PRIu64 "\"/>\n",
+    queue_depth,
+    READER_COUNT,
+    BLOCK_COUNT,
+    ctx->requests,
+    stats.read_ahead_transfers,
+    duration,
+    duration > 0 ? (UINT64_C(1000000000) * BLOCK_COUNT) / duration : 0
+  );
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(test_context *ctx)
+{
+  uint32_t queue_depth;
+
+  ctx->master = rtems_task_self();
+  start_tasks(ctx);
+
+  printf("<BlockBenchmark>\n");
+
+  for (queue_depth = 1; queue_depth <= MAX_QUEUE_DEPTH; queue_depth *= 2) {
+    run(ctx, queue_depth);
+  }
+
+  printf("</BlockBenchmark>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS MAX_READ_AHEAD_BLOCKS
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 3
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + READER_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
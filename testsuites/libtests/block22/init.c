@@ -0,0 +1,406 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 22";
+
+#define BLOCK_COUNT 32
+
+#define MAX_WRITE_BLOCKS 8
+
+#define DISK_PATH "/disk"
+
+#define QUEUE_DEPTH_DISK_PATH "/disk-qd"
+
+#define QUEUE_DEPTH 2
+
+#define SWAPOUT_WORKERS 3
+
+#define SPREAD_BLOCK_COUNT (3 * MAX_WRITE_BLOCKS + 2)
+
+#define MAX_REQUESTS 8
+
+#define SWAPOUT_PERIOD 50
+
+#define BLOCK_HOLD 1000
+
+/*
+ * After this time the modified buffers waited for more than one half of the
+ * hold time, however, their hold timer did not expire yet.
+ */
+#define AGE_TIME 700
+
+typedef struct {
+  uint32_t queue_depth;
+  uint32_t write_requests;
+  rtems_blkdev_bnum first_block;
+  uint32_t block_count;
+  bool written[BLOCK_COUNT];
+  rtems_blkdev_bnum request_first_block[MAX_REQUESTS];
+  uint32_t request_block_count[MAX_REQUESTS];
+  rtems_id request_task[MAX_REQUESTS];
+} test_context;
+
+static test_context test_instance;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  test_context *ctx = &test_instance;
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+
+    ctx->first_block = breq->bufs[0].block;
+    ctx->block_count = breq->bufnum;
+
+    if (ctx->write_requests < MAX_REQUESTS) {
+      ctx->request_first_block[ctx->write_requests] = ctx->first_block;
+      ctx->request_block_count[ctx->write_requests] = ctx->block_count;
+      ctx->request_task[ctx->write_requests] = rtems_task_self();
+    }
+
+    ++ctx->write_requests;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = breq->bufs[i].block;
+
+      rtems_test_assert(block == ctx->first_block + i);
+      rtems_test_assert(!ctx->written[block]);
+      ctx->written[block] = true;
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else if (req == RTEMS_BLKIO_GETQUEUEDEPTH) {
+    *(uint32_t *) arg = ctx->queue_depth;
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void modify_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void sync_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_sync(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_aging(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(AGE_TIME));
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* No hold timer expired */
+  rtems_test_assert(ctx->write_requests == 0);
+}
+
+static void test_merge_adjacent(test_context *ctx, rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < 6; ++block) {
+    if (block != 3) {
+      modify_block(dd, block);
+    }
+  }
+
+  modify_block(dd, 10);
+
+  wait_for_aging(ctx);
+
+  modify_block(dd, 6);
+  modify_block(dd, 7);
+
+  /*
+   * The hold timers of the other modified buffers did not expire, however,
+   * the aged neighbours of the synchronized block are written with it.  The
+   * young neighbours and the aged buffers which are not adjacent stay
+   * modified.
+   */
+  sync_block(dd, 3);
+
+  rtems_test_assert(ctx->write_requests == 1);
+  rtems_test_assert(ctx->first_block == 0);
+  rtems_test_assert(ctx->block_count == 6);
+  rtems_test_assert(!ctx->written[6]);
+  rtems_test_assert(!ctx->written[7]);
+  rtems_test_assert(!ctx->written[10]);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.write_transfers == 1);
+  rtems_test_assert(stats.write_blocks == 6);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->written[6]);
+  rtems_test_assert(ctx->written[7]);
+  rtems_test_assert(ctx->written[10]);
+}
+
+static void test_merge_limit(test_context *ctx, rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+
+  ctx->write_requests = 0;
+
+  for (block = 16; block < 28; ++block) {
+    if (block != 20) {
+      modify_block(dd, block);
+    }
+  }
+
+  wait_for_aging(ctx);
+
+  /*
+   * The run grows first towards the lower blocks and then towards the higher
+   * blocks up to the maximum write blocks.
+   */
+  sync_block(dd, 20);
+
+  rtems_test_assert(ctx->write_requests == 1);
+  rtems_test_assert(ctx->first_block == 16);
+  rtems_test_assert(ctx->block_count == MAX_WRITE_BLOCKS);
+
+  for (block = 24; block < 28; ++block) {
+    rtems_test_assert(!ctx->written[block]);
+  }
+
+  sc = rtems_bdbuf_syncdev(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (block = 24; block < 28; ++block) {
+    rtems_test_assert(ctx->written[block]);
+  }
+}
+
+static uint32_t find_request(
+  const test_context *ctx,
+  rtems_blkdev_bnum first_block
+)
+{
+  uint32_t i;
+
+  for (i = 0; i < ctx->write_requests; ++i) {
+    if (ctx->request_first_block[i] == first_block) {
+      break;
+    }
+  }
+
+  rtems_test_assert(i < ctx->write_requests);
+
+  return i;
+}
+
+static void test_spread_over_workers(test_context *ctx, rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+  rtems_id first_task = 0;
+  rtems_id other_task = 0;
+
+  for (block = 0; block < SPREAD_BLOCK_COUNT; ++block) {
+    modify_block(dd, block);
+  }
+
+  /*
+   * The hold timers of all modified buffers expire in the same swapout run.
+   * The swapout task hands the transfer over to a worker and spreads it over
+   * further workers up to the queue depth of the device.
+   */
+  sc = rtems_task_wake_after(
+    RTEMS_MILLISECONDS_TO_TICKS(BLOCK_HOLD + 4 * SWAPOUT_PERIOD)
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The first worker writes the first chunk.  The second worker writes the
+   * rest in chunks of the maximum write blocks.  The third worker stays idle
+   * since the queue depth is two.
+   */
+  rtems_test_assert(ctx->write_requests == 4);
+
+  for (block = 0; block < SPREAD_BLOCK_COUNT; block += MAX_WRITE_BLOCKS) {
+    uint32_t i;
+    uint32_t block_count;
+
+    i = find_request(ctx, block);
+
+    block_count = SPREAD_BLOCK_COUNT - block;
+    if (block_count > MAX_WRITE_BLOCKS) {
+      block_count = MAX_WRITE_BLOCKS;
+    }
+
+    rtems_test_assert(ctx->request_block_count[i] == block_count);
+
+    if (block == 0) {
+      first_task = ctx->request_task[i];
+    } else if (block == MAX_WRITE_BLOCKS) {
+      other_task = ctx->request_task[i];
+    } else {
+      rtems_test_assert(ctx->request_task[i] == other_task);
+    }
+  }
+
+  rtems_test_assert(first_task != other_task);
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    rtems_test_assert(ctx->written[block] == (block < SPREAD_BLOCK_COUNT));
+  }
+}
+
+static rtems_disk_device *create_disk(
+  test_context *ctx,
+  const char *path,
+  uint32_t queue_depth
+)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  ctx->queue_depth = queue_depth;
+  ctx->write_requests = 0;
+  memset(&ctx->written, 0, sizeof(ctx->written));
+
+  sc = rtems_blkdev_create(
+    path,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return dd;
+}
+
+static void test(test_context *ctx)
+{
+  rtems_disk_device *dd;
+  int rv;
+
+  dd = create_disk(ctx, DISK_PATH, 1);
+
+  test_merge_adjacent(ctx, dd);
+  test_merge_limit(ctx, dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+
+  dd = create_disk(ctx, QUEUE_DEPTH_DISK_PATH, QUEUE_DEPTH);
+
+  test_spread_over_workers(ctx, dd);
+
+  rv = unlink(QUEUE_DEPTH_DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_WRITE_BLOCKS MAX_WRITE_BLOCKS
+
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAPOUT_PERIOD
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD BLOCK_HOLD
+#define CONFIGURE_SWAPOUT_WORKER_TASKS SWAPOUT_WORKERS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,327 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/score/thread.h>
+
+const char rtems_test_name[] = "BLOCK 23";
+
+#define BLOCK_COUNT 8
+
+#define PARTITION_BUFFERS (BLOCK_COUNT / 2)
+
+#define SWAPOUT_PERIOD 1000000
+
+#define SWAPOUT_PRIORITY 10
+
+#define INIT_PRIORITY 20
+
+typedef enum {
+  DISK_A,
+  DISK_B,
+  DISK_COUNT
+} test_disk_index;
+
+typedef struct {
+  uint32_t read_requests;
+  uint32_t write_requests;
+  uint8_t data[BLOCK_COUNT];
+} test_disk;
+
+typedef struct {
+  test_disk disks[DISK_COUNT];
+  rtems_disk_device *dd[DISK_COUNT];
+  uint32_t switches;
+  bool probe;
+  bool probe_done;
+  uint32_t probe_switches_other_partition;
+  uint32_t probe_switches_same_partition;
+  test_disk_index write_order[2];
+  uint32_t write_count;
+} test_context;
+
+static test_context test_instance;
+
+static const char * const disk_paths[DISK_COUNT] = {
+  "/disk-a",
+  "/disk-b"
+};
+
+static void read_and_release(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * This function is executed by the swapout task while it writes the modified
+ * buffer of disk B.  The test task owns the partition lock of disk A at this
+ * time.
+ */
+static void probe_partition_locks(test_context *ctx)
+{
+  uint32_t switches;
+
+  /* Cache hit on disk B, this must not block on the partition of disk A */
+  switches = ctx->switches;
+  read_and_release(ctx->dd[DISK_B], 1);
+  ctx->probe_switches_other_partition = ctx->switches - switches;
+
+  /* Cache hit on disk A, this has to wait for the test task */
+  switches = ctx->switches;
+  read_and_release(ctx->dd[DISK_A], 1);
+  ctx->probe_switches_same_partition = ctx->switches - switches;
+
+  ctx->probe_done = true;
+}
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  test_context *ctx = &test_instance;
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    test_disk *disk = rtems_disk_get_driver_data(dd);
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+      ++disk->read_requests;
+    } else {
+      rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+      ++disk->write_requests;
+
+      rtems_test_assert(ctx->write_count < RTEMS_ARRAY_SIZE(ctx->write_order));
+      ctx->write_order[ctx->write_count] = (test_disk_index) (disk - ctx->disks);
+      ++ctx->write_count;
+
+      if (ctx->probe && disk == &ctx->disks[DISK_B]) {
+        ctx->probe = false;
+        probe_partition_locks(ctx);
+      }
+    }
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &breq->bufs[i];
+
+      rtems_test_assert(sg->block < BLOCK_COUNT);
+      rtems_test_assert(sg->length == 1);
+
+      if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+        memcpy(sg->buffer, &disk->data[sg->block], sg->length);
+      } else {
+        memcpy(&disk->data[sg->block], sg->buffer, sg->length);
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void test_concurrent_devices(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  read_and_release(ctx->dd[DISK_A], 1);
+  read_and_release(ctx->dd[DISK_B], 1);
+
+  sc = rtems_bdbuf_get(ctx->dd[DISK_B], 0, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  bd->buffer[0] = 'b';
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->write_count == 0);
+
+  sc = rtems_bdbuf_get(ctx->dd[DISK_A], 0, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  bd->buffer[0] = 'a';
+
+  /*
+   * The synchronization request wakes up the higher priority swapout task
+   * while we own the partition lock of disk A.  The swapout task processes
+   * the partition of disk B first and the driver of disk B accesses the cache
+   * of both disks.
+   */
+  ctx->probe = true;
+  sc = rtems_bdbuf_sync(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->probe_done);
+  rtems_test_assert(ctx->probe_switches_other_partition == 0);
+  rtems_test_assert(ctx->probe_switches_same_partition > 0);
+
+  rtems_test_assert(ctx->write_count == 2);
+  rtems_test_assert(ctx->write_order[0] == DISK_B);
+  rtems_test_assert(ctx->write_order[1] == DISK_A);
+  rtems_test_assert(ctx->disks[DISK_A].data[0] == 'a');
+  rtems_test_assert(ctx->disks[DISK_B].data[0] == 'b');
+
+  /* The probe accesses were cache hits */
+  rtems_test_assert(ctx->disks[DISK_A].read_requests == 1);
+  rtems_test_assert(ctx->disks[DISK_B].read_requests == 1);
+}
+
+static void test_partition_isolation(test_context *ctx)
+{
+  rtems_blkdev_bnum block;
+
+  /*
+   * Sweep through more blocks of disk B than its partition can hold.  This
+   * recycles only buffers of disk B.
+   */
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    read_and_release(ctx->dd[DISK_B], block);
+  }
+
+  rtems_test_assert(ctx->disks[DISK_B].read_requests > PARTITION_BUFFERS);
+
+  read_and_release(ctx->dd[DISK_A], 0);
+  read_and_release(ctx->dd[DISK_A], 1);
+
+  rtems_test_assert(ctx->disks[DISK_A].read_requests == 1);
+}
+
+static void create_disk(test_context *ctx, test_disk_index i)
+{
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    disk_paths[i],
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    &ctx->disks[i]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(disk_paths[i], O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &ctx->dd[i]);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(test_context *ctx)
+{
+  test_disk_index i;
+  int rv;
+
+  /*
+   * The partitions are assigned round-robin, so disk B uses the first
+   * partition and the swapout task processes it first.
+   */
+  create_disk(ctx, DISK_B);
+  create_disk(ctx, DISK_A);
+
+  rtems_test_assert(
+    ctx->dd[DISK_A]->cache_partition != ctx->dd[DISK_B]->cache_partition
+  );
+
+  test_concurrent_devices(ctx);
+  test_partition_isolation(ctx);
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    rv = unlink(disk_paths[i]);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void switch_extension(Thread_Control *executing, Thread_Control *heir)
+{
+  test_context *ctx = &test_instance;
+
+  ++ctx->switches;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (2 * PARTITION_BUFFERS)
+#define CONFIGURE_BDBUF_CACHE_PARTITIONS 2
+
+#define CONFIGURE_SWAPOUT_TASK_PRIORITY SWAPOUT_PRIORITY
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAPOUT_PERIOD
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD 0
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  { .thread_switch = switch_extension }, \
+  RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
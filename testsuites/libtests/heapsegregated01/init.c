@@ -0,0 +1,359 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "HEAPSEGREGATED 1";
+
+#define AREA_SIZE 65536
+
+#define BLOCK_COUNT 64
+
+typedef struct {
+  Heap_Control heap;
+  uint32_t seed;
+  void *blocks[ BLOCK_COUNT ];
+  RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT ) char area[ AREA_SIZE ];
+  RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT ) char extension[ AREA_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t next_random( test_context *ctx )
+{
+  ctx->seed = ctx->seed * 1103515245 + 12345;
+
+  return ctx->seed >> 16;
+}
+
+static void check_heap( test_context *ctx )
+{
+  rtems_test_assert( _Heap_Walk( &ctx->heap, 0, false ) );
+}
+
+static void init_heap( test_context *ctx )
+{
+  uintptr_t space_available;
+
+  memset( &ctx->blocks[ 0 ], 0, sizeof( ctx->blocks ) );
+  space_available = _Heap_Initialize_segregated(
+    &ctx->heap,
+    &ctx->area[ 0 ],
+    sizeof( ctx->area ),
+    0
+  );
+  rtems_test_assert( space_available > 0 );
+  rtems_test_assert( _Heap_Is_segregated( &ctx->heap ) );
+  check_heap( ctx );
+}
+
+static void free_all( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    rtems_test_assert( _Heap_Free( &ctx->heap, ctx->blocks[ i ] ) );
+    ctx->blocks[ i ] = NULL;
+  }
+
+  check_heap( ctx );
+}
+
+static void test_too_small_area( test_context *ctx )
+{
+  uintptr_t space_available;
+
+  space_available = _Heap_Initialize_segregated(
+    &ctx->heap,
+    &ctx->area[ 0 ],
+    sizeof( Heap_Segregated_index ),
+    0
+  );
+  rtems_test_assert( space_available == 0 );
+}
+
+static void test_map( void )
+{
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_map( 32, &fl, &sl );
+  rtems_test_assert( fl == 5 );
+  rtems_test_assert( sl == 0 );
+
+  _Heap_Segregated_map( 63, &fl, &sl );
+  rtems_test_assert( fl == 5 );
+  rtems_test_assert( sl == HEAP_SEGREGATED_SECOND_LEVEL_COUNT - 1 );
+
+  _Heap_Segregated_map( 4096 + 256, &fl, &sl );
+  rtems_test_assert( fl == 12 );
+  rtems_test_assert( sl == 1 );
+}
+
+static void test_bounded_search( test_context *ctx )
+{
+  size_t i;
+
+  init_heap( ctx );
+
+  /* Fragment the heap */
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    ctx->blocks[ i ] = _Heap_Allocate( &ctx->heap, 16 + 8 * i );
+    rtems_test_assert( ctx->blocks[ i ] != NULL );
+  }
+
+  for ( i = 0; i < BLOCK_COUNT; i += 2 ) {
+    rtems_test_assert( _Heap_Free( &ctx->heap, ctx->blocks[ i ] ) );
+    ctx->blocks[ i ] = NULL;
+  }
+
+  check_heap( ctx );
+  ctx->heap.stats.max_search = 0;
+
+  for ( i = 0; i < BLOCK_COUNT; i += 2 ) {
+    ctx->blocks[ i ] = _Heap_Allocate( &ctx->heap, 8 * ( BLOCK_COUNT - i ) );
+    rtems_test_assert( ctx->blocks[ i ] != NULL );
+    check_heap( ctx );
+  }
+
+  rtems_test_assert( ctx->heap.stats.max_search == 1 );
+  free_all( ctx );
+}
+
+static void test_bounded_aligned_search( test_context *ctx )
+{
+  size_t i;
+
+  init_heap( ctx );
+
+  /* Fragment the heap */
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    ctx->blocks[ i ] = _Heap_Allocate( &ctx->heap, 16 + 8 * i );
+    rtems_test_assert( ctx->blocks[ i ] != NULL );
+  }
+
+  for ( i = 0; i < BLOCK_COUNT; i += 2 ) {
+    rtems_test_assert( _Heap_Free( &ctx->heap, ctx->blocks[ i ] ) );
+    ctx->blocks[ i ] = NULL;
+  }
+
+  check_heap( ctx );
+  ctx->heap.stats.max_search = 0;
+
+  /*
+   * Allocations with an alignment or boundary constraint look also only at
+   * one free block.
+   */
+  for ( i = 0; i < BLOCK_COUNT; i += 2 ) {
+    uintptr_t size;
+    uintptr_t alignment;
+    uintptr_t boundary;
+    uintptr_t begin;
+
+    size = 8 * ( BLOCK_COUNT - i );
+    alignment = (uintptr_t) 64 << ( i % 4 );
+    boundary = ( i % 8 ) == 0 ? 1024 : 0;
+    ctx->blocks[ i ] = _Heap_Allocate_aligned_with_boundary(
+      &ctx->heap,
+      size,
+      alignment,
+      boundary
+    );
+    rtems_test_assert( ctx->blocks[ i ] != NULL );
+
+    begin = (uintptr_t) ctx->blocks[ i ];
+    rtems_test_assert( begin % alignment == 0 );
+    rtems_test_assert(
+      boundary == 0
+        || _Heap_Align_down( begin + size - 1, boundary ) <= begin
+    );
+    check_heap( ctx );
+  }
+
+  rtems_test_assert( ctx->heap.stats.max_search == 1 );
+  free_all( ctx );
+}
+
+static void test_random( test_context *ctx )
+{
+  Heap_Information_block info;
+  size_t i;
+
+  init_heap( ctx );
+  ctx->seed = 0;
+
+  for ( i = 0; i < 20000; ++i ) {
+    uint32_t r;
+    void **block;
+
+    r = next_random( ctx );
+    block = &ctx->blocks[ r % BLOCK_COUNT ];
+
+    if ( i == 10000 ) {
+      uintptr_t space_available;
+
+      space_available = _Heap_Extend(
+        &ctx->heap,
+        &ctx->extension[ 0 ],
+        sizeof( ctx->extension ),
+        0
+      );
+      rtems_test_assert( space_available > 0 );
+      check_heap( ctx );
+    }
+
+    if ( *block == NULL ) {
+      uintptr_t size;
+      uintptr_t alignment;
+      uintptr_t boundary;
+
+      size = next_random( ctx ) % ( ( r & 0x100 ) != 0 ? 4096 : 128 );
+      alignment = ( r & 0x600 ) == 0 ? 1U << ( next_random( ctx ) % 10 ) : 0;
+      boundary = ( r & 0x1800 ) == 0 && size <= 1024 ? 1024 : 0;
+
+      *block = _Heap_Allocate_aligned_with_boundary(
+        &ctx->heap,
+        size,
+        alignment,
+        boundary
+      );
+
+      if ( *block != NULL ) {
+        uintptr_t begin;
+
+        begin = (uintptr_t) *block;
+        rtems_test_assert( alignment == 0 || begin % alignment == 0 );
+        rtems_test_assert(
+          boundary == 0
+            || size == 0
+            || _Heap_Align_down( begin + size - 1, boundary ) <= begin
+        );
+        memset( *block, 0xaa, size );
+      }
+    } else if ( ( r & 0x3000 ) == 0 ) {
+      uintptr_t old_size;
+      uintptr_t new_size;
+      Heap_Resize_status status;
+
+      status = _Heap_Resize_block(
+        &ctx->heap,
+        *block,
+        next_random( ctx ) % 256,
+        &old_size,
+        &new_size
+      );
+      rtems_test_assert( status != HEAP_RESIZE_FATAL_ERROR );
+    } else {
+      rtems_test_assert( _Heap_Free( &ctx->heap, *block ) );
+      *block = NULL;
+    }
+
+    if ( i % 97 == 0 ) {
+      check_heap( ctx );
+    }
+  }
+
+  free_all( ctx );
+  _Heap_Get_information( &ctx->heap, &info );
+  rtems_test_assert( info.Used.number == 0 );
+  rtems_test_assert( info.Free.number <= 2 );
+}
+
+static void test_greedy( test_context *ctx )
+{
+  static const uintptr_t block_sizes[] = { 100, 200 };
+  Heap_Block *blocks;
+
+  init_heap( ctx );
+  blocks = _Heap_Greedy_allocate(
+    &ctx->heap,
+    block_sizes,
+    RTEMS_ARRAY_SIZE( block_sizes )
+  );
+  check_heap( ctx );
+  rtems_test_assert( _Heap_Allocate( &ctx->heap, 1024 ) == NULL );
+  _Heap_Greedy_free( &ctx->heap, blocks );
+  check_heap( ctx );
+}
+
+static void test_configuration( void )
+{
+  void *p;
+
+  rtems_test_assert( _Heap_Is_segregated( &_Workspace_Area ) );
+  rtems_test_assert( _Heap_Is_segregated( RTEMS_Malloc_Heap ) );
+  rtems_test_assert( _Heap_Walk( &_Workspace_Area, 0, false ) );
+
+  p = malloc( 123 );
+  rtems_test_assert( p != NULL );
+  rtems_test_assert( _Heap_Walk( RTEMS_Malloc_Heap, 0, false ) );
+  free( p );
+  rtems_test_assert( _Heap_Walk( RTEMS_Malloc_Heap, 0, false ) );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+  test_too_small_area( ctx );
+  test_map();
+  test_bounded_search( ctx );
+  test_bounded_aligned_search( ctx );
+  test_random( ctx );
+  test_greedy( ctx );
+  test_configuration();
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_SEGREGATED_FIT_HEAPS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,255 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libcsupport.h>
+#include <rtems/malloc.h>
+
+#include <stdlib.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define MAGAZINE_SIZE 4
+
+#define SMALL_SIZE 10
+
+static rtems_malloc_cache_statistics get_stats( void )
+{
+  rtems_malloc_cache_statistics stats;
+  int rv;
+
+  rv = malloc_cache_info( rtems_scheduler_get_processor(), &stats );
+  rtems_test_assert( rv == 0 );
+
+  return stats;
+}
+
+static void test_info( void )
+{
+  rtems_malloc_cache_statistics stats;
+  int rv;
+
+  rv = malloc_cache_info( 0, NULL );
+  rtems_test_assert( rv == -1 );
+
+  rv = malloc_cache_info( rtems_scheduler_get_processor_maximum(), &stats );
+  rtems_test_assert( rv == -1 );
+
+  rv = malloc_cache_info( 0, &stats );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_refill_and_hit( void )
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  void *p;
+  void *q;
+
+  rtems_malloc_cache_flush();
+  before = get_stats();
+  rtems_test_assert( before.cached_blocks == 0 );
+  rtems_test_assert( before.cached_size == 0 );
+
+  p = malloc( SMALL_SIZE );
+  rtems_test_assert( p != NULL );
+  after = get_stats();
+  rtems_test_assert( after.misses == before.misses + 1 );
+  rtems_test_assert( after.refills == before.refills + 1 );
+  rtems_test_assert( after.cached_blocks == MAGAZINE_SIZE / 2 );
+
+  q = malloc( SMALL_SIZE );
+  rtems_test_assert( q != NULL );
+  rtems_test_assert( q != p );
+  after = get_stats();
+  rtems_test_assert( after.hits == before.hits + 1 );
+  rtems_test_assert( after.cached_blocks == MAGAZINE_SIZE / 2 - 1 );
+
+  free( p );
+  free( q );
+  after = get_stats();
+  rtems_test_assert( after.frees == before.frees + 2 );
+  rtems_test_assert( after.cached_blocks == MAGAZINE_SIZE / 2 + 1 );
+
+  p = malloc( SMALL_SIZE );
+  rtems_test_assert( p == q );
+  free( p );
+}
+
+static void test_flush( void )
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  void *p[ MAGAZINE_SIZE + 1 ];
+  size_t i;
+
+  rtems_malloc_cache_flush();
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    p[ i ] = malloc( SMALL_SIZE );
+    rtems_test_assert( p[ i ] != NULL );
+  }
+
+  rtems_malloc_cache_flush();
+  before = get_stats();
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    free( p[ i ] );
+  }
+
+  after = get_stats();
+  rtems_test_assert( after.flushes == before.flushes + 1 );
+  rtems_test_assert( after.cached_blocks == 1 );
+
+  rtems_malloc_cache_flush();
+  after = get_stats();
+  rtems_test_assert( after.cached_blocks == 0 );
+  rtems_test_assert( after.cached_size == 0 );
+}
+
+static void test_bypass( void )
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  void *p;
+  int rv;
+
+  rtems_malloc_cache_flush();
+  before = get_stats();
+
+  p = malloc( 4 * RTEMS_MALLOC_CACHE_MAXIMUM_SIZE );
+  rtems_test_assert( p != NULL );
+  free( p );
+
+  rv = posix_memalign( &p, 256, SMALL_SIZE );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( ( (uintptr_t) p % 256 ) == 0 );
+
+  after = get_stats();
+  rtems_test_assert( after.hits == before.hits );
+  rtems_test_assert( after.misses == before.misses );
+  rtems_test_assert( after.frees == before.frees );
+
+  free( p );
+  rtems_malloc_cache_flush();
+}
+
+static void test_realloc( void )
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  unsigned char *p;
+  unsigned char *q;
+  size_t i;
+
+  rtems_malloc_cache_flush();
+
+  p = malloc( SMALL_SIZE );
+  rtems_test_assert( p != NULL );
+
+  for ( i = 0; i < SMALL_SIZE; ++i ) {
+    p[ i ] = (unsigned char) i;
+  }
+
+  q = realloc( p, RTEMS_MALLOC_CACHE_MINIMUM_SIZE );
+  rtems_test_assert( q == p );
+
+  before = get_stats();
+  q = realloc( p, 4 * RTEMS_MALLOC_CACHE_MAXIMUM_SIZE );
+  rtems_test_assert( q != NULL );
+  rtems_test_assert( q != p );
+
+  for ( i = 0; i < SMALL_SIZE; ++i ) {
+    rtems_test_assert( q[ i ] == (unsigned char) i );
+  }
+
+  after = get_stats();
+  rtems_test_assert( after.frees == before.frees + 1 );
+
+  free( q );
+  rtems_malloc_cache_flush();
+}
+
+static void test_malloc_info( void )
+{
+  Heap_Information_block before;
+  Heap_Information_block after;
+  void *p;
+  int rv;
+
+  rtems_malloc_cache_flush();
+  rv = malloc_info( &before );
+  rtems_test_assert( rv == 0 );
+
+  p = malloc( SMALL_SIZE );
+  rtems_test_assert( p != NULL );
+
+  rv = malloc_info( &after );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( after.Used.number == before.Used.number + 1 );
+  rtems_test_assert( after.Free.total + after.Used.total
+    == before.Free.total + before.Used.total );
+
+  free( p );
+  rtems_malloc_cache_flush();
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+  test_info();
+  test_refill_and_hit();
+  test_flush();
+  test_bypass();
+  test_realloc();
+  test_malloc_info();
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_PER_PROCESSOR_CACHE
+
+#define CONFIGURE_MALLOC_CACHE_MAGAZINE_SIZE MAGAZINE_SIZE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -33,10 +33,10 @@ void blow_stack(void)
    *  does not cause problems :)
    */
 
-  area = (char *) executing->Start.Initial_stack.area;
+  area = (char *) executing->Cold->Start.Initial_stack.area;
   low  = (uintptr_t *) area;
   high = (uintptr_t *)
-    (area + executing->Start.Initial_stack.size - 4 * sizeof(*high));
+    (area + executing->Cold->Start.Initial_stack.size - 4 * sizeof(*high));
 
   low[0] = 0x11111111;
   low[1] = 0x22222222;
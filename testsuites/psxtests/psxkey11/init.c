@@ -0,0 +1,245 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/apimutex.h>
+
+#include <errno.h>
+#include <pthread.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "PSXKEY 11";
+
+#define KEY_COUNT 2
+
+#define ITERATIONS 32
+
+typedef struct {
+  rtems_id init;
+  pthread_key_t keys[ KEY_COUNT ];
+  int values[ KEY_COUNT ];
+  bool init_blocked;
+  int destructor_calls;
+} test_context;
+
+static test_context test_instance;
+
+static void destructor( void *value )
+{
+  ++test_instance.destructor_calls;
+}
+
+static void allocator_owner_task( rtems_task_argument arg )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+
+  ctx = (test_context *) arg;
+
+  _RTEMS_Lock_allocator();
+
+  sc = rtems_event_transient_send( ctx->init );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /*
+   * In case the Init task blocks on the allocator mutex, then we get a
+   * timeout here.
+   */
+  sc = rtems_event_transient_receive( RTEMS_WAIT, 10 );
+
+  if ( sc == RTEMS_TIMEOUT ) {
+    ctx->init_blocked = true;
+  } else {
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  sc = rtems_event_transient_send( ctx->init );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_task_exit();
+}
+
+static void test_without_allocator_mutex( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  size_t            i;
+  size_t            k;
+  int               eno;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'A', 'L', 'L', 'O' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, allocator_owner_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The allocator mutex is owned by the other task now */
+  for ( i = 0; i < ITERATIONS; ++i ) {
+    for ( k = 0; k < KEY_COUNT; ++k ) {
+      eno = pthread_setspecific( ctx->keys[ k ], &ctx->values[ k ] );
+      rtems_test_assert( eno == 0 );
+    }
+
+    for ( k = 0; k < KEY_COUNT; ++k ) {
+      rtems_test_assert( pthread_getspecific( ctx->keys[ k ] )
+        == &ctx->values[ k ] );
+      eno = pthread_setspecific( ctx->keys[ k ], NULL );
+      rtems_test_assert( eno == 0 );
+      rtems_test_assert( pthread_getspecific( ctx->keys[ k ] ) == NULL );
+    }
+  }
+
+  eno = pthread_setspecific( ctx->keys[ 0 ], NULL );
+  rtems_test_assert( eno == 0 );
+
+  sc = rtems_event_transient_send( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( !ctx->init_blocked );
+}
+
+static void value_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+  int           eno;
+
+  ctx = (test_context *) arg;
+
+  eno = pthread_setspecific( ctx->keys[ 1 ], &ctx->values[ 1 ] );
+  rtems_test_assert( eno == 0 );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void test_key_delete( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  int               eno;
+
+  eno = pthread_setspecific( ctx->keys[ 1 ], &ctx->values[ 0 ] );
+  rtems_test_assert( eno == 0 );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'V', 'A', 'L', 'U' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, value_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  eno = pthread_key_delete( ctx->keys[ 1 ] );
+  rtems_test_assert( eno == 0 );
+
+  rtems_test_assert( pthread_getspecific( ctx->keys[ 1 ] ) == NULL );
+
+  eno = pthread_setspecific( ctx->keys[ 1 ], &ctx->values[ 1 ] );
+  rtems_test_assert( eno == EINVAL );
+
+  eno = pthread_setspecific( ctx->keys[ 1 ], NULL );
+  rtems_test_assert( eno == EINVAL );
+
+  sc = rtems_task_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( ctx->destructor_calls == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+  size_t        k;
+  int           eno;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  for ( k = 0; k < KEY_COUNT; ++k ) {
+    eno = pthread_key_create( &ctx->keys[ k ], destructor );
+    rtems_test_assert( eno == 0 );
+  }
+
+  test_without_allocator_mutex( ctx );
+  test_key_delete( ctx );
+
+  eno = pthread_key_delete( ctx->keys[ 0 ] );
+  rtems_test_assert( eno == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_POSIX_KEYS KEY_COUNT
+
+#define CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_PAIRS 16
+
+#define CONFIGURE_POSIX_KEYS_PER_PROCESSOR_CACHE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
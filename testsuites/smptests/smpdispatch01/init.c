@@ -0,0 +1,284 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SMPDISPATCH 1";
+
+#define CPU_COUNT 2
+
+#define WORKER_COUNT 3
+
+#define ITERATION_COUNT 10
+
+#define SCHED_A rtems_build_name(' ', ' ', ' ', 'A')
+
+#define SCHED_B rtems_build_name(' ', ' ', ' ', 'B')
+
+typedef struct {
+  rtems_id barrier;
+  rtems_id workers[WORKER_COUNT];
+  volatile uint32_t counters[WORKER_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+typedef struct {
+  uint32_t deferred;
+  uint32_t interrupts;
+} dispatch_stats;
+
+static dispatch_stats get_stats(const Per_CPU_Control *cpu_self)
+{
+  dispatch_stats stats;
+
+  stats.deferred = cpu_self->Dispatch_requests.deferred;
+  stats.interrupts = cpu_self->Dispatch_requests.interrupts;
+
+  return stats;
+}
+
+static void test_nested_batch(void)
+{
+  Per_CPU_Control *cpu_self;
+  Per_CPU_Control *cpu_other;
+  dispatch_stats before;
+  dispatch_stats after;
+  ISR_Level level;
+  int i;
+
+  cpu_self = _Thread_Dispatch_disable();
+  cpu_other = _Per_CPU_Get_by_index(1 - _Per_CPU_Get_index(cpu_self));
+  before = get_stats(cpu_self);
+
+  _Thread_Dispatch_request_batch_begin(cpu_self);
+  _Thread_Dispatch_request_batch_begin(cpu_self);
+
+  for (i = 0; i < 3; ++i) {
+    _ISR_Local_disable(level);
+    _Thread_Dispatch_request(cpu_self, cpu_other);
+    _ISR_Local_enable(level);
+  }
+
+  _Thread_Dispatch_request_batch_end(cpu_self);
+
+  /* The inner batch end must not send the collected requests */
+  after = get_stats(cpu_self);
+  rtems_test_assert(after.deferred == before.deferred + 3);
+  rtems_test_assert(after.interrupts == before.interrupts);
+  rtems_test_assert(
+    _Processor_mask_Is_set(
+      &cpu_self->Dispatch_requests.targets,
+      _Per_CPU_Get_index(cpu_other)
+    )
+  );
+
+  _Thread_Dispatch_request_batch_end(cpu_self);
+
+  after = get_stats(cpu_self);
+  rtems_test_assert(after.deferred == before.deferred + 3);
+  rtems_test_assert(after.interrupts == before.interrupts + 1);
+  rtems_test_assert(_Processor_mask_Is_zero(&cpu_self->Dispatch_requests.targets));
+  rtems_test_assert(cpu_self->Dispatch_requests.nest_level == 0);
+
+  _Thread_Dispatch_enable(cpu_self);
+}
+
+static void wait_for_barrier_wait(rtems_id id)
+{
+  Thread_Control *the_thread;
+  ISR_lock_Context lock_context;
+
+  the_thread = _Thread_Get(id, &lock_context);
+  rtems_test_assert(the_thread != NULL);
+  _ISR_lock_ISR_enable(&lock_context);
+
+  while ((the_thread->current_state & STATES_WAITING_FOR_BARRIER) == 0) {
+    /* Wait */
+  }
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_barrier_wait(ctx->barrier, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++ctx->counters[arg];
+  }
+}
+
+static void test_barrier_release(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_b;
+  size_t i;
+  int iteration;
+  uint32_t expected_requests;
+
+  sc = rtems_barrier_create(
+    rtems_build_name('B', 'A', 'R', 'R'),
+    RTEMS_BARRIER_MANUAL_RELEASE,
+    0,
+    &ctx->barrier
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_ident(SCHED_B, &scheduler_b);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The workers are blocked in the order of increasing priority, so each
+   * unblock operation of the barrier release issues a thread dispatch request
+   * to the other processor.
+   */
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      10 - i,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->workers[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(ctx->workers[i], scheduler_b, 10 - i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->workers[i], worker, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    wait_for_barrier_wait(ctx->workers[i]);
+  }
+
+  expected_requests = WORKER_COUNT;
+
+  for (iteration = 0; iteration < ITERATION_COUNT; ++iteration) {
+    Per_CPU_Control *cpu_self;
+    dispatch_stats before;
+    dispatch_stats after;
+    uint32_t released;
+
+    cpu_self = _Per_CPU_Get_snapshot();
+    before = get_stats(cpu_self);
+
+    sc = rtems_barrier_release(ctx->barrier, &released);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(released == WORKER_COUNT);
+
+    after = get_stats(cpu_self);
+    rtems_test_assert(after.deferred == before.deferred + expected_requests);
+    rtems_test_assert(after.interrupts == before.interrupts + 1);
+
+    /* No thread dispatch request may be lost */
+    for (i = 0; i < WORKER_COUNT; ++i) {
+      while (ctx->counters[i] != (uint32_t) iteration + 1) {
+        /* Wait */
+      }
+    }
+
+    for (i = 0; i < WORKER_COUNT; ++i) {
+      wait_for_barrier_wait(ctx->workers[i]);
+    }
+
+    /*
+     * The workers block again in the order of decreasing priority, so only the
+     * unblock of the highest priority worker issues a thread dispatch request.
+     */
+    expected_requests = 1;
+  }
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_task_delete(ctx->workers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_barrier_delete(ctx->barrier);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test_nested_batch();
+    test_barrier_release(&test_instance);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_PRIORITY_SMP(a, 256);
+
+RTEMS_SCHEDULER_PRIORITY_SMP(b, 256);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(a, SCHED_A), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(b, SCHED_B)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_MAXIMUM_BARRIERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -19,6 +19,7 @@
 #include <rtems/score/smplock.h>
 #include <rtems/score/smplockmcs.h>
 #include <rtems/score/smplockseq.h>
+#include <rtems/score/smplockticket.h>
 #include <rtems/test.h>
 #include <rtems.h>
 
@@ -30,7 +31,7 @@ const char rtems_test_name[] = "SMPLOCK 1";
 
 #define CPU_COUNT 32
 
-#define TEST_COUNT 13
+#define TEST_COUNT 15
 
 typedef struct {
   rtems_test_parallel_context base;
@@ -38,6 +39,10 @@ typedef struct {
   unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
   SMP_lock_Control lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
   Atomic_Uint flag RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+  SMP_ticket_lock_Control ticket_lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats ticket_stats;
+#endif
   SMP_MCS_lock_Control mcs_lock RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
 #if defined(RTEMS_PROFILING)
   SMP_lock_Stats mcs_stats;
@@ -48,8 +53,10 @@ typedef struct {
 } test_context;
 
 static test_context test_instance = {
-  .lock = SMP_LOCK_INITIALIZER("global ticket"),
+  .lock = SMP_LOCK_INITIALIZER("global SMP"),
+  .ticket_lock = SMP_TICKET_LOCK_INITIALIZER,
 #if defined(RTEMS_PROFILING)
+  .ticket_stats = SMP_LOCK_STATS_INITIALIZER("global ticket"),
   .mcs_stats = SMP_LOCK_STATS_INITIALIZER("global MCS"),
 #endif
   .flag = ATOMIC_INITIALIZER_UINT(0),
@@ -117,11 +124,17 @@ static void test_0_body(
   test_context *ctx = (test_context *) base;
   size_t test = 0;
   unsigned long counter = 0;
-  SMP_lock_Context lock_context;
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats_context lock_context;
+#endif
 
   while (!rtems_test_parallel_stop_job(&ctx->base)) {
-    _SMP_lock_Acquire(&ctx->lock, &lock_context);
-    _SMP_lock_Release(&ctx->lock, &lock_context);
+    _SMP_ticket_lock_Acquire(
+      &ctx->ticket_lock,
+      &ctx->ticket_stats,
+      &lock_context
+    );
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &lock_context);
     ++counter;
   }
 
@@ -191,12 +204,18 @@ static void test_2_body(
   test_context *ctx = (test_context *) base;
   size_t test = 2;
   unsigned long counter = 0;
-  SMP_lock_Context lock_context;
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats_context lock_context;
+#endif
 
   while (!rtems_test_parallel_stop_job(&ctx->base)) {
-    _SMP_lock_Acquire(&ctx->lock, &lock_context);
+    _SMP_ticket_lock_Acquire(
+      &ctx->ticket_lock,
+      &ctx->ticket_stats,
+      &lock_context
+    );
     ++ctx->counter[test];
-    _SMP_lock_Release(&ctx->lock, &lock_context);
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &lock_context);
     ++counter;
   }
 
@@ -267,18 +286,23 @@ static void test_4_body(
   test_context *ctx = (test_context *) base;
   size_t test = 4;
   unsigned long counter = 0;
-  SMP_lock_Control lock;
-  SMP_lock_Context lock_context;
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats stats;
+  SMP_lock_Stats_context lock_context;
+#endif
+  SMP_ticket_lock_Control lock;
 
-  _SMP_lock_Initialize(&lock, "local");
+  _SMP_lock_Stats_initialize(&stats, "local");
+  _SMP_ticket_lock_Initialize(&lock);
 
   while (!rtems_test_parallel_stop_job(&ctx->base)) {
-    _SMP_lock_Acquire(&lock, &lock_context);
-    _SMP_lock_Release(&lock, &lock_context);
+    _SMP_ticket_lock_Acquire(&lock, &stats, &lock_context);
+    _SMP_ticket_lock_Release(&lock, &lock_context);
     ++counter;
   }
 
-  _SMP_lock_Destroy(&lock);
+  _SMP_ticket_lock_Destroy(&lock);
+  _SMP_lock_Stats_destroy(&stats);
 
   ctx->local_counter[active_workers - 1][test][worker_index] = counter;
 }
@@ -356,22 +380,27 @@ static void test_6_body(
   test_context *ctx = (test_context *) base;
   size_t test = 6;
   unsigned long counter = 0;
-  SMP_lock_Control lock;
-  SMP_lock_Context lock_context;
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats stats;
+  SMP_lock_Stats_context lock_context;
+#endif
+  SMP_ticket_lock_Control lock;
 
-  _SMP_lock_Initialize(&lock, "local");
+  _SMP_lock_Stats_initialize(&stats, "local");
+  _SMP_ticket_lock_Initialize(&lock);
 
   while (!rtems_test_parallel_stop_job(&ctx->base)) {
-    _SMP_lock_Acquire(&lock, &lock_context);
+    _SMP_ticket_lock_Acquire(&lock, &stats, &lock_context);
 
     /* The counter value is not interesting, only the access to it */
     ++ctx->counter[test];
 
-    _SMP_lock_Release(&lock, &lock_context);
+    _SMP_ticket_lock_Release(&lock, &lock_context);
     ++counter;
   }
 
-  _SMP_lock_Destroy(&lock);
+  _SMP_ticket_lock_Destroy(&lock);
+  _SMP_lock_Stats_destroy(&stats);
 
   ctx->local_counter[active_workers - 1][test][worker_index] = counter;
 }
@@ -462,12 +491,18 @@ static void test_8_body(
   test_context *ctx = (test_context *) base;
   size_t test = 8;
   unsigned long counter = 0;
-  SMP_lock_Context lock_context;
+#if defined(RTEMS_PROFILING)
+  SMP_lock_Stats_context lock_context;
+#endif
 
   while (!rtems_test_parallel_stop_job(&ctx->base)) {
-    _SMP_lock_Acquire(&ctx->lock, &lock_context);
+    _SMP_ticket_lock_Acquire(
+      &ctx->ticket_lock,
+      &ctx->ticket_stats,
+      &lock_context
+    );
     busy_section();
-    _SMP_lock_Release(&ctx->lock, &lock_context);
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &lock_context);
     ++counter;
   }
 
@@ -668,6 +703,81 @@ static void test_12_fini(
   );
 }
 
+static void test_13_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 13;
+  unsigned long counter = 0;
+  SMP_lock_Context lock_context;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _SMP_lock_Acquire(&ctx->lock, &lock_context);
+    _SMP_lock_Release(&ctx->lock, &lock_context);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_13_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    ctx,
+    "GlobalSMPLockWithLocalCounter",
+    13,
+    active_workers
+  );
+}
+
+static void test_14_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = 14;
+  unsigned long counter = 0;
+  SMP_lock_Context lock_context;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    _SMP_lock_Acquire(&ctx->lock, &lock_context);
+    ++ctx->counter[test];
+    _SMP_lock_Release(&ctx->lock, &lock_context);
+    ++counter;
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_14_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  test_fini(
+    ctx,
+    "GlobalSMPLockWithGlobalCounter",
+    14,
+    active_workers
+  );
+}
+
 static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
   {
     .init = test_init,
@@ -734,6 +844,16 @@ static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
     .body = test_12_body,
     .fini = test_12_fini,
     .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_13_body,
+    .fini = test_13_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_14_body,
+    .fini = test_14_fini,
+    .cascade = false
   }
 };
 
@@ -742,7 +862,7 @@ static void test(void)
   test_context *ctx = &test_instance;
   const char *test = "SMPLock01";
 
-  printf("<%s>\n", test);
+  printf("<%s smpLockAlgorithm=\"%s\">\n", test, SMP_LOCK_ALGORITHM_NAME);
   rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
   printf("</%s>\n", test);
 }
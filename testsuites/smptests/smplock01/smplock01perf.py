@@ -29,6 +29,12 @@ plt.plot(x, y, label = 'Ticket Lock', marker = 'o')
 y = map(xmlNode.getContent, ctx.xpathEval('/SMPLock01/GlobalMCSLockWithLocalCounter/SumOfLocalCounter'))
 plt.plot(x, y, label = 'MCS Lock', marker = 'o')
 
+algorithm = ctx.xpathEval('/SMPLock01/@smpLockAlgorithm')
+algorithm = algorithm[0].getContent() if algorithm else 'ticket'
+y = map(xmlNode.getContent, ctx.xpathEval('/SMPLock01/GlobalSMPLockWithLocalCounter/SumOfLocalCounter'))
+if y:
+    plt.plot(x, y, label = 'SMP Lock (' + algorithm + ')', marker = 'o')
+
 y = map(xmlNode.getContent, ctx.xpathEval('/SMPLock01/GlobalTASLockWithLocalCounter/SumOfLocalCounter'))
 plt.plot(x, y, label = 'TAS Lock', marker = 'o')
 
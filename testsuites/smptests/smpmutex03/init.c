@@ -0,0 +1,340 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <pthread.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/profiling.h>
+#include <rtems/thread.h>
+#include <rtems/score/atomic.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMUTEX 3";
+
+#define CPU_COUNT 2
+
+#define ITERATIONS 10000
+
+#define EVENT_START RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+typedef enum {
+  MUTEX_CLASSIC,
+  MUTEX_POSIX,
+  MUTEX_SELF_CONTAINED,
+  MUTEX_COUNT
+} mutex_kind;
+
+typedef struct {
+  rtems_id main_task;
+  rtems_id worker_task;
+  rtems_id classic_mutex;
+  pthread_mutex_t posix_mutex;
+  rtems_recursive_mutex self_contained_mutex;
+  mutex_kind kind;
+  volatile bool in_critical_section;
+  uint32_t counter;
+  Atomic_Uint switch_count;
+} test_context;
+
+typedef struct {
+  uint64_t spin_acquire_count;
+  uint64_t block_count;
+} spin_stats;
+
+static test_context test_instance;
+
+static void switch_extension(Thread_Control *executing, Thread_Control *heir)
+{
+  test_context *ctx = &test_instance;
+  rtems_id id = executing->Object.id;
+
+  (void) heir;
+
+  /* Count the context switches which take a task off its processor */
+  if (id == ctx->main_task || id == ctx->worker_task) {
+    _Atomic_Fetch_add_uint(&ctx->switch_count, 1, ATOMIC_ORDER_RELAXED);
+  }
+}
+
+static void spin_stats_visitor(void *arg, const rtems_profiling_data *data)
+{
+  spin_stats *stats = arg;
+
+  if (data->header.type == RTEMS_PROFILING_PER_CPU) {
+    stats->spin_acquire_count += data->per_cpu.mutex_spin_acquire_count;
+    stats->block_count += data->per_cpu.mutex_block_count;
+  }
+}
+
+static void get_spin_stats(spin_stats *stats)
+{
+  stats->spin_acquire_count = 0;
+  stats->block_count = 0;
+  rtems_profiling_iterate(spin_stats_visitor, stats);
+}
+
+static void obtain(test_context *ctx)
+{
+  rtems_status_code sc;
+  int eno;
+
+  switch (ctx->kind) {
+    case MUTEX_CLASSIC:
+      sc = rtems_semaphore_obtain(
+        ctx->classic_mutex,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+    case MUTEX_POSIX:
+      eno = pthread_mutex_lock(&ctx->posix_mutex);
+      rtems_test_assert(eno == 0);
+      break;
+    default:
+      rtems_test_assert(ctx->kind == MUTEX_SELF_CONTAINED);
+      rtems_recursive_mutex_lock(&ctx->self_contained_mutex);
+      break;
+  }
+}
+
+static void release(test_context *ctx)
+{
+  rtems_status_code sc;
+  int eno;
+
+  switch (ctx->kind) {
+    case MUTEX_CLASSIC:
+      sc = rtems_semaphore_release(ctx->classic_mutex);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      break;
+    case MUTEX_POSIX:
+      eno = pthread_mutex_unlock(&ctx->posix_mutex);
+      rtems_test_assert(eno == 0);
+      break;
+    default:
+      rtems_test_assert(ctx->kind == MUTEX_SELF_CONTAINED);
+      rtems_recursive_mutex_unlock(&ctx->self_contained_mutex);
+      break;
+  }
+}
+
+static void critical_sections(test_context *ctx)
+{
+  int i;
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    obtain(ctx);
+    rtems_test_assert(!ctx->in_critical_section);
+    ctx->in_critical_section = true;
+
+    /*
+     * Keep the owner busy for a short time, so that the other task observes
+     * an owner executing on another processor.
+     */
+    rtems_counter_delay_nanoseconds(1000);
+
+    ++ctx->counter;
+    ctx->in_critical_section = false;
+    release(ctx);
+  }
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      EVENT_START,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    critical_sections(ctx);
+
+    sc = rtems_event_send(ctx->main_task, EVENT_DONE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test(test_context *ctx, mutex_kind kind)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  spin_stats before;
+  spin_stats after;
+  unsigned int switch_count;
+
+  ctx->kind = kind;
+  ctx->counter = 0;
+  get_spin_stats(&before);
+  _Atomic_Store_uint(&ctx->switch_count, 0, ATOMIC_ORDER_RELAXED);
+
+  sc = rtems_event_send(ctx->worker_task, EVENT_START);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  critical_sections(ctx);
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->counter == 2 * ITERATIONS);
+
+  /*
+   * Without the adaptive spinning nearly each obtain operation blocks.  With
+   * the adaptive spinning, the tasks get the mutex while the owner executes
+   * on the other processor, so they stay on their processors.
+   */
+  switch_count = _Atomic_Load_uint(&ctx->switch_count, ATOMIC_ORDER_RELAXED);
+  rtems_test_assert(switch_count < ITERATIONS / 2);
+
+  get_spin_stats(&after);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(after.spin_acquire_count > before.spin_acquire_count);
+  rtems_test_assert(
+    after.spin_acquire_count - before.spin_acquire_count
+      > after.block_count - before.block_count
+  );
+#else
+  rtems_test_assert(after.spin_acquire_count == 0);
+  rtems_test_assert(after.block_count == 0);
+#endif
+}
+
+static void test_adaptive_spinning(test_context *ctx)
+{
+  rtems_status_code sc;
+  pthread_mutexattr_t attr;
+  int eno;
+  mutex_kind kind;
+
+  ctx->main_task = rtems_task_self();
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('M', 'U', 'T', 'X'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->classic_mutex
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  eno = pthread_mutexattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutex_init(&ctx->posix_mutex, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_mutexattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+
+  rtems_recursive_mutex_init(&ctx->self_contained_mutex, "SC");
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker_task, worker, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (kind = MUTEX_CLASSIC; kind < MUTEX_COUNT; ++kind) {
+    test(ctx, kind);
+  }
+
+  sc = rtems_task_delete(ctx->worker_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_recursive_mutex_destroy(&ctx->self_contained_mutex);
+
+  eno = pthread_mutex_destroy(&ctx->posix_mutex);
+  rtems_test_assert(eno == 0);
+
+  sc = rtems_semaphore_delete(ctx->classic_mutex);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() >= 2) {
+    test_adaptive_spinning(&test_instance);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MUTEX_ADAPTIVE_SPIN_LIMIT 1000
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  { .thread_switch = switch_extension }, \
+  RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,256 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/rcuimpl.h>
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPRCU 1";
+
+#define CPU_COUNT 4
+
+#define ELEMENT_COUNT 3
+
+#define UPDATES 1000
+
+#define MAGIC_LIVE 0x4c495645
+
+#define MAGIC_DEAD 0x44454144
+
+typedef struct {
+  RCU_Head head;
+  volatile uint32_t magic;
+  bool in_use;
+} element;
+
+typedef struct {
+  rtems_id worker_tasks[CPU_COUNT];
+  Atomic_Uintptr current;
+  Atomic_Uint stop;
+  Atomic_Uint reads;
+  element elements[ELEMENT_COUNT];
+  uint32_t callbacks;
+} test_context;
+
+static test_context test_instance;
+
+static void reader(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (_Atomic_Load_uint(&ctx->stop, ATOMIC_ORDER_RELAXED) == 0) {
+    Per_CPU_Control *cpu_self;
+    element *e;
+
+    cpu_self = _RCU_Read_lock();
+    e = _RCU_Dereference(&ctx->current);
+    rtems_test_assert(e->magic == MAGIC_LIVE);
+
+    /* Give the updater a chance to interfere */
+    rtems_counter_delay_nanoseconds(100);
+
+    rtems_test_assert(e->magic == MAGIC_LIVE);
+    _RCU_Read_unlock(cpu_self);
+
+    _Atomic_Fetch_add_uint(&ctx->reads, 1, ATOMIC_ORDER_RELAXED);
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static element *get_free_element(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < ELEMENT_COUNT; ++i) {
+    element *e = &ctx->elements[i];
+
+    if (!e->in_use) {
+      e->in_use = true;
+      e->magic = MAGIC_LIVE;
+      return e;
+    }
+  }
+
+  rtems_test_assert(0);
+  return NULL;
+}
+
+static void reclaim(RCU_Head *head)
+{
+  test_context *ctx = &test_instance;
+  element *e = RTEMS_CONTAINER_OF(head, element, head);
+
+  e->magic = MAGIC_DEAD;
+  e->in_use = false;
+  ++ctx->callbacks;
+}
+
+static element *replace(test_context *ctx)
+{
+  element *old;
+
+  old = _RCU_Dereference(&ctx->current);
+  _RCU_Assign_pointer(&ctx->current, get_free_element(ctx));
+  return old;
+}
+
+static void test_synchronize(test_context *ctx)
+{
+  int i;
+
+  for (i = 0; i < UPDATES; ++i) {
+    element *old;
+
+    old = replace(ctx);
+    _RCU_Synchronize();
+    old->magic = MAGIC_DEAD;
+    old->in_use = false;
+  }
+}
+
+static void test_call(test_context *ctx)
+{
+  int i;
+
+  ctx->callbacks = 0;
+
+  for (i = 0; i < UPDATES; ++i) {
+    element *old;
+
+    old = replace(ctx);
+    _RCU_Call(&old->head, reclaim);
+
+    /* Nothing is reclaimed before the grace period */
+    rtems_test_assert(old->magic == MAGIC_LIVE);
+
+    _RCU_Synchronize();
+    rtems_test_assert(old->magic == MAGIC_DEAD);
+  }
+
+  rtems_test_assert(ctx->callbacks == UPDATES);
+}
+
+static void test_call_in_read_section(test_context *ctx)
+{
+  Per_CPU_Control *cpu_self;
+  element *old;
+
+  ctx->callbacks = 0;
+
+  cpu_self = _RCU_Read_lock();
+  old = replace(ctx);
+  _RCU_Call(&old->head, reclaim);
+  _RCU_Read_unlock(cpu_self);
+
+  rtems_test_assert(ctx->callbacks == 0);
+  _RCU_Synchronize();
+  rtems_test_assert(ctx->callbacks == 1);
+  rtems_test_assert(old->magic == MAGIC_DEAD);
+
+  /* No pending callbacks */
+  _RCU_Synchronize();
+  rtems_test_assert(ctx->callbacks == 1);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  _RCU_Assign_pointer(&ctx->current, get_free_element(ctx));
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 1; cpu_index < cpu_count; ++cpu_index) {
+    sc = rtems_task_create(
+      rtems_build_name('R', 'E', 'A', 'D'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_tasks[cpu_index]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(
+      ctx->worker_tasks[cpu_index],
+      reader,
+      (rtems_task_argument) ctx
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  test_synchronize(ctx);
+  test_call(ctx);
+  test_call_in_read_section(ctx);
+
+  _Atomic_Store_uint(&ctx->stop, 1, ATOMIC_ORDER_RELAXED);
+
+  if (cpu_count > 1) {
+    rtems_test_assert(
+      _Atomic_Load_uint(&ctx->reads, ATOMIC_ORDER_RELAXED) > 0
+    );
+  }
+
+  for (cpu_index = 1; cpu_index < cpu_count; ++cpu_index) {
+    sc = rtems_task_delete(ctx->worker_tasks[cpu_index]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
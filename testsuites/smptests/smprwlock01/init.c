@@ -0,0 +1,680 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/posix/rwlock.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPRWLOCK 1";
+
+#define CPU_COUNT 2
+
+#define ITERATIONS 10000
+
+#define WRITE_INTERVAL 16
+
+#define READ_MAXIMUM 6
+
+#define EVENT_START RTEMS_EVENT_0
+
+#define EVENT_DONE RTEMS_EVENT_1
+
+#define EVENT_REQUEST RTEMS_EVENT_2
+
+typedef enum {
+  RWLOCK_CLASSIC,
+  RWLOCK_POSIX,
+  RWLOCK_COUNT
+} rwlock_kind;
+
+typedef enum {
+  REQ_OBTAIN_READ,
+  REQ_TRY_READ,
+  REQ_TRY_WRITE,
+  REQ_RELEASE
+} request_kind;
+
+typedef struct {
+  rtems_id main_task;
+  rtems_id worker_task;
+  rtems_id helper_task;
+  request_kind request;
+  int request_status;
+  rtems_id classic_rwlock;
+  pthread_rwlock_t posix_rwlock;
+  rwlock_kind kind;
+  volatile bool in_write_section;
+  volatile uint32_t a;
+  volatile uint32_t b;
+} test_context;
+
+static test_context test_instance;
+
+static void obtain_read(test_context *ctx)
+{
+  rtems_status_code sc;
+  int eno;
+
+  if (ctx->kind == RWLOCK_CLASSIC) {
+    sc = rtems_rwlock_obtain_read(
+      ctx->classic_rwlock,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    eno = pthread_rwlock_rdlock(&ctx->posix_rwlock);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static void obtain_write(test_context *ctx)
+{
+  rtems_status_code sc;
+  int eno;
+
+  if (ctx->kind == RWLOCK_CLASSIC) {
+    sc = rtems_rwlock_obtain_write(
+      ctx->classic_rwlock,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    eno = pthread_rwlock_wrlock(&ctx->posix_rwlock);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static void release(test_context *ctx)
+{
+  rtems_status_code sc;
+  int eno;
+
+  if (ctx->kind == RWLOCK_CLASSIC) {
+    sc = rtems_rwlock_release(ctx->classic_rwlock);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static uint32_t critical_sections(test_context *ctx)
+{
+  uint32_t writes;
+  int i;
+
+  writes = 0;
+
+  for (i = 0; i < ITERATIONS; ++i) {
+    if (i % WRITE_INTERVAL == 0) {
+      obtain_write(ctx);
+      rtems_test_assert(!ctx->in_write_section);
+      ctx->in_write_section = true;
+      ++ctx->a;
+
+      /* Give the readers on the other processor a chance to interfere */
+      rtems_counter_delay_nanoseconds(1000);
+
+      ++ctx->b;
+      ctx->in_write_section = false;
+      release(ctx);
+      ++writes;
+    } else {
+      obtain_read(ctx);
+      rtems_test_assert(!ctx->in_write_section);
+      rtems_test_assert(ctx->a == ctx->b);
+      release(ctx);
+    }
+  }
+
+  return writes;
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      EVENT_START,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    critical_sections(ctx);
+
+    sc = rtems_event_send(ctx->main_task, EVENT_DONE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static int perform_classic_request(test_context *ctx)
+{
+  switch (ctx->request) {
+    case REQ_OBTAIN_READ:
+      return (int) rtems_rwlock_obtain_read(
+        ctx->classic_rwlock,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    case REQ_TRY_READ:
+      return (int) rtems_rwlock_obtain_read(
+        ctx->classic_rwlock,
+        RTEMS_NO_WAIT,
+        0
+      );
+    case REQ_TRY_WRITE:
+      return (int) rtems_rwlock_obtain_write(
+        ctx->classic_rwlock,
+        RTEMS_NO_WAIT,
+        0
+      );
+    default:
+      rtems_test_assert(ctx->request == REQ_RELEASE);
+      return (int) rtems_rwlock_release(ctx->classic_rwlock);
+  }
+}
+
+static int perform_posix_request(test_context *ctx)
+{
+  switch (ctx->request) {
+    case REQ_OBTAIN_READ:
+      return pthread_rwlock_rdlock(&ctx->posix_rwlock);
+    case REQ_TRY_READ:
+      return pthread_rwlock_tryrdlock(&ctx->posix_rwlock);
+    case REQ_TRY_WRITE:
+      return pthread_rwlock_trywrlock(&ctx->posix_rwlock);
+    default:
+      rtems_test_assert(ctx->request == REQ_RELEASE);
+      return pthread_rwlock_unlock(&ctx->posix_rwlock);
+  }
+}
+
+static void helper(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      EVENT_REQUEST,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    if (ctx->kind == RWLOCK_CLASSIC) {
+      ctx->request_status = perform_classic_request(ctx);
+    } else {
+      ctx->request_status = perform_posix_request(ctx);
+    }
+
+    sc = rtems_event_send(ctx->main_task, EVENT_DONE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Lets the helper task perform the request, since the rwlocks reject
+ * recursive obtain operations and release operations of non-owners.
+ */
+static int helper_request(test_context *ctx, request_kind request)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+
+  ctx->request = request;
+
+  sc = rtems_event_send(ctx->helper_task, EVENT_REQUEST);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return ctx->request_status;
+}
+
+static void test_contention(test_context *ctx, rwlock_kind kind)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  uint32_t writes;
+
+  ctx->kind = kind;
+  ctx->a = 0;
+  ctx->b = 0;
+
+  sc = rtems_event_send(ctx->worker_task, EVENT_START);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  writes = critical_sections(ctx);
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->a == 2 * writes);
+  rtems_test_assert(ctx->b == 2 * writes);
+}
+
+static void test_classic(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  ctx->kind = RWLOCK_CLASSIC;
+
+  sc = rtems_rwlock_create(0, &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  sc = rtems_rwlock_create(rtems_build_name('R', 'W', 'L', 'K'), NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_rwlock_create(
+    rtems_build_name('R', 'W', 'L', 'K'),
+    &ctx->classic_rwlock
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_create(rtems_build_name('M', 'O', 'R', 'E'), &id);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_rwlock_ident(rtems_build_name('R', 'W', 'L', 'K'), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == ctx->classic_rwlock);
+
+  /* Multiple readers */
+  sc = rtems_rwlock_obtain_read(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = helper_request(ctx, REQ_TRY_READ);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = helper_request(ctx, REQ_TRY_WRITE);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  /* Recursive obtain operations are rejected */
+  sc = rtems_rwlock_obtain_read(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_rwlock_obtain_write(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_rwlock_delete(id);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_rwlock_release(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Only an owner may release the lock */
+  sc = rtems_rwlock_release(id);
+  rtems_test_assert(sc == RTEMS_NOT_OWNER_OF_RESOURCE);
+
+  /* A writer which gives up while the readers drain lets readers in again */
+  sc = rtems_rwlock_obtain_write(id, RTEMS_WAIT, 1);
+  rtems_test_assert(sc == RTEMS_TIMEOUT);
+
+  sc = rtems_rwlock_obtain_read(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_release(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = helper_request(ctx, REQ_RELEASE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Exclusive writer */
+  sc = rtems_rwlock_obtain_write(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_obtain_read(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_rwlock_obtain_write(id, RTEMS_WAIT, 1);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = helper_request(ctx, REQ_TRY_READ);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = helper_request(ctx, REQ_TRY_WRITE);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = helper_request(ctx, REQ_RELEASE);
+  rtems_test_assert(sc == RTEMS_NOT_OWNER_OF_RESOURCE);
+
+  sc = rtems_rwlock_delete(id);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_rwlock_release(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_obtain_write(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_release(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_posix_too_many_readers(void)
+{
+  pthread_rwlock_t rwlocks[READ_MAXIMUM + 1];
+  pthread_rwlockattr_t attr;
+  size_t i;
+  int eno;
+
+  eno = pthread_rwlockattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_setbigreader_np(&attr, 1);
+  rtems_test_assert(eno == 0);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(rwlocks); ++i) {
+    eno = pthread_rwlock_init(&rwlocks[i], &attr);
+    rtems_test_assert(eno == 0);
+  }
+
+  eno = pthread_rwlockattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+
+  for (i = 0; i < READ_MAXIMUM; ++i) {
+    eno = pthread_rwlock_rdlock(&rwlocks[i]);
+    rtems_test_assert(eno == 0);
+  }
+
+  eno = pthread_rwlock_rdlock(&rwlocks[READ_MAXIMUM]);
+  rtems_test_assert(eno == EAGAIN);
+
+  eno = pthread_rwlock_wrlock(&rwlocks[READ_MAXIMUM]);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&rwlocks[READ_MAXIMUM]);
+  rtems_test_assert(eno == 0);
+
+  for (i = 0; i < READ_MAXIMUM; ++i) {
+    eno = pthread_rwlock_unlock(&rwlocks[i]);
+    rtems_test_assert(eno == 0);
+  }
+
+  eno = pthread_rwlock_rdlock(&rwlocks[READ_MAXIMUM]);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&rwlocks[READ_MAXIMUM]);
+  rtems_test_assert(eno == 0);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(rwlocks); ++i) {
+    eno = pthread_rwlock_destroy(&rwlocks[i]);
+    rtems_test_assert(eno == 0);
+  }
+}
+
+static void test_posix(test_context *ctx)
+{
+  pthread_rwlock_t default_rwlock = PTHREAD_RWLOCK_INITIALIZER;
+  pthread_rwlockattr_t attr;
+  struct timespec abstime;
+  int big_reader;
+  int eno;
+  int rv;
+
+  ctx->kind = RWLOCK_POSIX;
+
+  eno = pthread_rwlockattr_setbigreader_np(NULL, 1);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_init(&attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getbigreader_np(&attr, NULL);
+  rtems_test_assert(eno == EINVAL);
+
+  eno = pthread_rwlockattr_getbigreader_np(&attr, &big_reader);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(big_reader == 0);
+
+  eno = pthread_rwlockattr_setbigreader_np(&attr, 1);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_getbigreader_np(&attr, &big_reader);
+  rtems_test_assert(eno == 0);
+  rtems_test_assert(big_reader == 1);
+
+  eno = pthread_rwlock_init(&ctx->posix_rwlock, &attr);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlockattr_destroy(&attr);
+  rtems_test_assert(eno == 0);
+
+  /* Multiple readers */
+  eno = pthread_rwlock_rdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = helper_request(ctx, REQ_TRY_READ);
+  rtems_test_assert(eno == 0);
+
+  eno = helper_request(ctx, REQ_TRY_WRITE);
+  rtems_test_assert(eno == EBUSY);
+
+  /* Recursive lock operations are rejected */
+  eno = pthread_rwlock_rdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = pthread_rwlock_trywrlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = pthread_rwlock_destroy(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  /* Only an owner may unlock the lock */
+  eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EPERM);
+
+  /* A writer which gives up while the readers drain lets readers in again */
+  rv = clock_gettime(CLOCK_REALTIME, &abstime);
+  rtems_test_assert(rv == 0);
+  abstime.tv_nsec += 10000000;
+
+  if (abstime.tv_nsec >= 1000000000) {
+    abstime.tv_nsec -= 1000000000;
+    ++abstime.tv_sec;
+  }
+
+  eno = pthread_rwlock_timedwrlock(&ctx->posix_rwlock, &abstime);
+  rtems_test_assert(eno == ETIMEDOUT);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = helper_request(ctx, REQ_RELEASE);
+  rtems_test_assert(eno == 0);
+
+  /* Exclusive writer */
+  eno = pthread_rwlock_wrlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_tryrdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = pthread_rwlock_wrlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EDEADLK);
+
+  eno = helper_request(ctx, REQ_TRY_READ);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = helper_request(ctx, REQ_TRY_WRITE);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = helper_request(ctx, REQ_RELEASE);
+  rtems_test_assert(eno == EPERM);
+
+  eno = pthread_rwlock_destroy(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EBUSY);
+
+  eno = pthread_rwlock_unlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  test_posix_too_many_readers();
+
+  /* The default rwlock kind is still available */
+  eno = pthread_rwlock_rdlock(&default_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_unlock(&default_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_destroy(&default_rwlock);
+  rtems_test_assert(eno == 0);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  rwlock_kind kind;
+  int eno;
+
+  ctx->main_task = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('H', 'E', 'L', 'P'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->helper_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->helper_task, helper, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_classic(ctx);
+  test_posix(ctx);
+
+  if (rtems_scheduler_get_processor_maximum() >= 2) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_task
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->worker_task, worker, (rtems_task_argument) ctx);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (kind = RWLOCK_CLASSIC; kind < RWLOCK_COUNT; ++kind) {
+      test_contention(ctx, kind);
+    }
+
+    sc = rtems_task_delete(ctx->worker_task);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->helper_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  eno = pthread_rwlock_destroy(&ctx->posix_rwlock);
+  rtems_test_assert(eno == 0);
+
+  eno = pthread_rwlock_rdlock(&ctx->posix_rwlock);
+  rtems_test_assert(eno == EINVAL);
+
+  sc = rtems_rwlock_delete(ctx->classic_rwlock);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rwlock_delete(ctx->classic_rwlock);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_rwlock_obtain_read(ctx->classic_rwlock, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test(&test_instance);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_RWLOCKS 1
+
+#define CONFIGURE_MAXIMUM_BIG_READER_RWLOCKS_PER_THREAD READ_MAXIMUM
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
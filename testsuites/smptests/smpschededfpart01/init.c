@@ -0,0 +1,577 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/atomic.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSCHEDEDFPART 1";
+
+#define CPU_COUNT 4
+
+#define DEADLINE_WORKER_COUNT 3
+
+typedef enum {
+  WORKER_STEAL,
+  WORKER_HOLD,
+  WORKER_PARTITION_A,
+  WORKER_PARTITION_B,
+  WORKER_FIXED,
+  WORKER_REHOME,
+  WORKER_REHOME_BLOCKER,
+  WORKER_COUNT
+} worker_index;
+
+typedef struct {
+  rtems_id scheduler_a;
+  rtems_id scheduler_b;
+  rtems_id worker[WORKER_COUNT];
+  Atomic_Uint processors[WORKER_COUNT];
+  Atomic_Uint release[WORKER_COUNT];
+  rtems_id deadline_worker[DEADLINE_WORKER_COUNT];
+  rtems_id deadline_period[DEADLINE_WORKER_COUNT];
+  uint32_t deadline_processor[DEADLINE_WORKER_COUNT];
+  size_t deadline_order[DEADLINE_WORKER_COUNT];
+  Atomic_Uint deadline_count;
+  rtems_id holder;
+  rtems_id holder_period;
+  Atomic_Uint holder_running;
+  Atomic_Uint holder_release;
+} test_context;
+
+static test_context test_instance;
+
+static const rtems_interval deadline_periods[DEADLINE_WORKER_COUNT] =
+  { 30, 20, 10 };
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void busy_worker(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  worker_index i = arg;
+
+  while (_Atomic_Load_uint(&ctx->release[i], ATOMIC_ORDER_ACQUIRE) == 0) {
+    uint32_t cpu_self_index = rtems_scheduler_get_processor();
+
+    _Atomic_Fetch_or_uint(
+      &ctx->processors[i],
+      1U << cpu_self_index,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static unsigned int used_processors(test_context *ctx, worker_index i)
+{
+  return _Atomic_Exchange_uint(&ctx->processors[i], 0, ATOMIC_ORDER_RELAXED);
+}
+
+static void wait_for_processors(
+  test_context *ctx,
+  worker_index i,
+  unsigned int expected
+)
+{
+  while (
+    _Atomic_Load_uint(&ctx->processors[i], ATOMIC_ORDER_RELAXED) == 0
+  ) {
+    /* Wait */
+  }
+
+  rtems_test_assert(used_processors(ctx, i) == expected);
+}
+
+static void create_worker(
+  test_context *ctx,
+  worker_index i,
+  rtems_task_priority priority
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker[i]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void start_worker(test_context *ctx, worker_index i)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_start(ctx->worker[i], busy_worker, i);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_worker(test_context *ctx, worker_index i)
+{
+  rtems_status_code sc;
+
+  _Atomic_Store_uint(&ctx->release[i], 1, ATOMIC_ORDER_RELEASE);
+
+  sc = rtems_task_delete(ctx->worker[i]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_scheduler_name(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_id;
+
+  sc = rtems_scheduler_ident_by_processor(0, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_ident(
+    rtems_build_name('P', 'E', 'D', 'A'),
+    &ctx->scheduler_a
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(scheduler_id == ctx->scheduler_a);
+
+  sc = rtems_scheduler_ident(
+    rtems_build_name('P', 'E', 'D', 'B'),
+    &ctx->scheduler_b
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_steal(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  /* The main task is bound to processor 0 */
+  set_affinity(RTEMS_SELF, 0);
+
+  /*
+   * The worker is pushed to the idle processor 1, which becomes its home
+   * processor.
+   */
+  create_worker(ctx, WORKER_STEAL, 2);
+  start_worker(ctx, WORKER_STEAL);
+  wait_for_processors(ctx, WORKER_STEAL, 0x2);
+
+  /*
+   * The holder bound to processor 1 preempts the worker.  The worker waits
+   * in the ready queue of processor 1.
+   */
+  create_worker(ctx, WORKER_HOLD, 1);
+  set_affinity(ctx->worker[WORKER_HOLD], 1);
+  start_worker(ctx, WORKER_HOLD);
+  wait_for_processors(ctx, WORKER_HOLD, 0x2);
+  (void) used_processors(ctx, WORKER_STEAL);
+
+  /*
+   * The higher priority worker bound to processor 1 waits in front of the
+   * worker in the ready queue of processor 1.
+   */
+  create_worker(ctx, WORKER_FIXED, 1);
+  set_affinity(ctx->worker[WORKER_FIXED], 1);
+  start_worker(ctx, WORKER_FIXED);
+
+  /*
+   * While the main task sleeps, processor 0 has an empty ready queue and
+   * steals the worker from processor 1.  The bound worker is skipped.
+   */
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(used_processors(ctx, WORKER_STEAL) == 0x1);
+  rtems_test_assert(used_processors(ctx, WORKER_HOLD) == 0x2);
+  rtems_test_assert(used_processors(ctx, WORKER_FIXED) == 0);
+
+  delete_worker(ctx, WORKER_HOLD);
+  wait_for_processors(ctx, WORKER_FIXED, 0x2);
+  delete_worker(ctx, WORKER_FIXED);
+  delete_worker(ctx, WORKER_STEAL);
+}
+
+static void deadline_worker(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  size_t i = arg;
+  rtems_status_code sc;
+  unsigned int n;
+
+  sc = rtems_rate_monotonic_period(
+    ctx->deadline_period[i],
+    deadline_periods[i]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  n = _Atomic_Load_uint(&ctx->deadline_count, ATOMIC_ORDER_RELAXED);
+  ctx->deadline_order[n] = i;
+  ctx->deadline_processor[i] = rtems_scheduler_get_processor();
+  _Atomic_Store_uint(&ctx->deadline_count, n + 1, ATOMIC_ORDER_RELEASE);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void holder(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  /* This job has the earliest deadline */
+  sc = rtems_rate_monotonic_period(ctx->holder_period, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  _Atomic_Store_uint(&ctx->holder_running, 1, ATOMIC_ORDER_RELEASE);
+
+  while (
+    _Atomic_Load_uint(&ctx->holder_release, ATOMIC_ORDER_ACQUIRE) == 0
+  ) {
+    /* Wait */
+  }
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static rtems_id create_bound_task(rtems_id *period, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('D', 'E', 'A', 'D'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(id, cpu_index);
+
+  sc = rtems_rate_monotonic_create(
+    rtems_build_name('P', 'E', 'R', 'D'),
+    period
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void delete_bound_task(rtems_id id, rtems_id period)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_delete(period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_deadline_order(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  /*
+   * The workers bound to processor 1 start jobs with the latest deadline
+   * first and then wait for an event.
+   */
+  for (i = 0; i < DEADLINE_WORKER_COUNT; ++i) {
+    ctx->deadline_worker[i] =
+      create_bound_task(&ctx->deadline_period[i], 1);
+
+    sc = rtems_task_start(ctx->deadline_worker[i], deadline_worker, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /* The holder job with the earliest deadline occupies processor 1 */
+  ctx->holder = create_bound_task(&ctx->holder_period, 1);
+
+  sc = rtems_task_start(ctx->holder, holder, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (
+    _Atomic_Load_uint(&ctx->holder_running, ATOMIC_ORDER_ACQUIRE) == 0
+  ) {
+    /* Wait */
+  }
+
+  /* All workers are ready in the ready queue of processor 1 */
+  for (i = 0; i < DEADLINE_WORKER_COUNT; ++i) {
+    sc = rtems_event_transient_send(ctx->deadline_worker[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(
+    _Atomic_Load_uint(&ctx->deadline_count, ATOMIC_ORDER_ACQUIRE) == 0
+  );
+
+  _Atomic_Store_uint(&ctx->holder_release, 1, ATOMIC_ORDER_RELEASE);
+
+  while (
+    _Atomic_Load_uint(&ctx->deadline_count, ATOMIC_ORDER_ACQUIRE)
+      != DEADLINE_WORKER_COUNT
+  ) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /* The workers executed in deadline order on their processor */
+  rtems_test_assert(ctx->deadline_order[0] == 2);
+  rtems_test_assert(ctx->deadline_order[1] == 1);
+  rtems_test_assert(ctx->deadline_order[2] == 0);
+
+  for (i = 0; i < DEADLINE_WORKER_COUNT; ++i) {
+    rtems_test_assert(ctx->deadline_processor[i] == 1);
+    delete_bound_task(ctx->deadline_worker[i], ctx->deadline_period[i]);
+  }
+
+  delete_bound_task(ctx->holder, ctx->holder_period);
+}
+
+static void test_partitions(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+  cpu_set_t cpuset;
+  unsigned int processors;
+
+  create_worker(ctx, WORKER_PARTITION_A, 2);
+  create_worker(ctx, WORKER_PARTITION_B, 2);
+
+  sc = rtems_task_set_scheduler(
+    ctx->worker[WORKER_PARTITION_B],
+    ctx->scheduler_b,
+    2
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_get_priority(
+    ctx->worker[WORKER_PARTITION_B],
+    ctx->scheduler_b,
+    &prio
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(prio == 2);
+
+  /* A thread cannot be bound to a processor of another partition */
+  CPU_ZERO(&cpuset);
+  CPU_SET(0, &cpuset);
+  sc = rtems_task_set_affinity(
+    ctx->worker[WORKER_PARTITION_B],
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  start_worker(ctx, WORKER_PARTITION_A);
+  start_worker(ctx, WORKER_PARTITION_B);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  processors = used_processors(ctx, WORKER_PARTITION_A);
+  rtems_test_assert(processors != 0);
+  rtems_test_assert((processors & ~0x3U) == 0);
+
+  processors = used_processors(ctx, WORKER_PARTITION_B);
+  rtems_test_assert(processors != 0);
+  rtems_test_assert((processors & ~0xcU) == 0);
+
+  delete_worker(ctx, WORKER_PARTITION_A);
+  delete_worker(ctx, WORKER_PARTITION_B);
+}
+
+static void test_rehome(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  /* The worker has an affinity to processor 3 of partition B */
+  create_worker(ctx, WORKER_REHOME, 3);
+
+  sc = rtems_task_set_scheduler(
+    ctx->worker[WORKER_REHOME],
+    ctx->scheduler_b,
+    3
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(ctx->worker[WORKER_REHOME], 3);
+  start_worker(ctx, WORKER_REHOME);
+  wait_for_processors(ctx, WORKER_REHOME, 0x8);
+
+  /* The higher priority blocker occupies processor 2 */
+  create_worker(ctx, WORKER_REHOME_BLOCKER, 2);
+
+  sc = rtems_task_set_scheduler(
+    ctx->worker[WORKER_REHOME_BLOCKER],
+    ctx->scheduler_b,
+    2
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  start_worker(ctx, WORKER_REHOME_BLOCKER);
+  wait_for_processors(ctx, WORKER_REHOME_BLOCKER, 0x4);
+
+  /* Remove the home processor of the worker while it is blocked */
+  sc = rtems_task_suspend(ctx->worker[WORKER_REHOME]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_remove_processor(ctx->scheduler_b, 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) used_processors(ctx, WORKER_REHOME);
+
+  /*
+   * The unblocked worker is inserted into the ready queue of its new home
+   * processor 2 and not into the ready queue of the removed processor.
+   */
+  sc = rtems_task_resume(ctx->worker[WORKER_REHOME]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(used_processors(ctx, WORKER_REHOME) == 0);
+
+  delete_worker(ctx, WORKER_REHOME_BLOCKER);
+  wait_for_processors(ctx, WORKER_REHOME, 0x4);
+  delete_worker(ctx, WORKER_REHOME);
+
+  sc = rtems_scheduler_add_processor(ctx->scheduler_b, 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static bool has_processor(rtems_id scheduler_id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  sc = rtems_scheduler_get_processor_set(
+    scheduler_id,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return CPU_ISSET((int) cpu_index, &cpuset);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_scheduler_name(ctx);
+
+  if (has_processor(ctx->scheduler_a, 1)) {
+    test_steal(ctx);
+    test_deadline_order(ctx);
+  }
+
+  if (has_processor(ctx->scheduler_b, 2)) {
+    test_partitions(ctx);
+  }
+
+  if (has_processor(ctx->scheduler_b, 3)) {
+    test_rehome(ctx);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 5
+
+#define CONFIGURE_MAXIMUM_PERIODS (DEADLINE_WORKER_COUNT + 1)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_EDF_PARTITIONED_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_EDF_PARTITIONED_SMP(a);
+
+RTEMS_SCHEDULER_EDF_PARTITIONED_SMP(b);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_EDF_PARTITIONED_SMP( \
+    a, \
+    rtems_build_name('P', 'E', 'D', 'A') \
+  ), \
+  RTEMS_SCHEDULER_TABLE_EDF_PARTITIONED_SMP( \
+    b, \
+    rtems_build_name('P', 'E', 'D', 'B') \
+  )
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,504 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/atomic.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSTRONGAPA 2";
+
+#define CPU_COUNT 2
+
+#define FILLER_MAX 64
+
+#define ROUND_TRIPS 10000
+
+#define SCHED_IAPA rtems_build_name('I', 'A', 'P', 'A')
+
+#define SCHED_PAFF rtems_build_name('P', 'A', 'F', 'F')
+
+#define PRIO_HOG 2
+
+#define PRIO_FILLER_FIRST 3
+
+#define PRIO_WORKER 199
+
+#define PRIO_MASTER 200
+
+#define PRIO_HOLDER 3
+
+#define PRIO_MIGRATING 4
+
+#define PRIO_BOUND 5
+
+/*
+ * The master and the worker task execute on processor A.  The hog task
+ * executes on processor B.  The filler tasks have a higher priority than the
+ * master and the worker, however, their affinity set contains only processor
+ * B.  So, they are ready, but never scheduled.  Each time the worker blocks,
+ * the scheduler has to find the highest priority ready task eligible for
+ * processor A, which is the master.
+ */
+typedef enum {
+  DISPLACE_HOLDER,
+  DISPLACE_MIGRATING,
+  DISPLACE_BOUND,
+  DISPLACE_COUNT
+} displace_index;
+
+typedef struct {
+  rtems_id master;
+  rtems_id worker;
+  rtems_id hog;
+  rtems_id fillers[FILLER_MAX];
+  size_t filler_count;
+  uint32_t cpu_a;
+  uint32_t cpu_b;
+  rtems_id displace_tasks[DISPLACE_COUNT];
+  Atomic_Uint displace_processors[DISPLACE_COUNT];
+  Atomic_Uint holder_release;
+} test_context;
+
+static test_context test_instance;
+
+static const size_t filler_counts[] = { 0, 4, 16, FILLER_MAX };
+
+static void set_affinity(rtems_id task, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(task, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void set_all_affinity(rtems_id task)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_FILL(&cpuset);
+
+  sc = rtems_task_set_affinity(task, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_id create_task(
+  rtems_task_priority priority,
+  uint32_t cpu_index,
+  rtems_task_entry entry
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(id, cpu_index);
+
+  sc = rtems_task_start(id, entry, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void delete_task(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void worker(rtems_task_argument arg)
+{
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void busy(rtems_task_argument arg)
+{
+  while (true) {
+    /* Wait for deletion */
+  }
+}
+
+static unsigned int displace_processors(test_context *ctx, displace_index i)
+{
+  return _Atomic_Exchange_uint(
+    &ctx->displace_processors[i],
+    0,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static void record_processor(test_context *ctx, displace_index i)
+{
+  _Atomic_Fetch_or_uint(
+    &ctx->displace_processors[i],
+    1U << rtems_scheduler_get_processor(),
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+static void displace_holder(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (
+    _Atomic_Load_uint(&ctx->holder_release, ATOMIC_ORDER_ACQUIRE) == 0
+  ) {
+    record_processor(ctx, DISPLACE_HOLDER);
+  }
+
+  worker(arg);
+}
+
+static void displace_busy(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (true) {
+    record_processor(ctx, arg);
+  }
+}
+
+static rtems_id create_displace_task(
+  test_context *ctx,
+  displace_index i,
+  rtems_task_priority priority,
+  rtems_task_entry entry
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('D', 'I', 'S', 'P'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  if (i == DISPLACE_HOLDER) {
+    set_affinity(id, 1);
+  } else if (i == DISPLACE_BOUND) {
+    set_affinity(id, 0);
+  }
+
+  ctx->displace_tasks[i] = id;
+
+  sc = rtems_task_start(id, entry, i);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+/*
+ * The migrating task with an affinity to both processors executes on
+ * processor 0.  The bound task with an affinity to processor 0 is ready.  If
+ * processor 1 becomes available, then the migrating task must move to
+ * processor 1, so that the bound task can execute on processor 0.
+ */
+static void test_displacement(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  /* The master task is the highest priority task on processor 1 */
+  set_affinity(ctx->master, 1);
+  rtems_test_assert(rtems_scheduler_get_processor() == 1);
+
+  create_displace_task(ctx, DISPLACE_HOLDER, PRIO_HOLDER, displace_holder);
+  create_displace_task(
+    ctx,
+    DISPLACE_MIGRATING,
+    PRIO_MIGRATING,
+    displace_busy
+  );
+  create_displace_task(ctx, DISPLACE_BOUND, PRIO_BOUND, displace_busy);
+
+  while (displace_processors(ctx, DISPLACE_MIGRATING) == 0) {
+    /* Wait */
+  }
+
+  rtems_test_assert(displace_processors(ctx, DISPLACE_HOLDER) == 0);
+  rtems_test_assert(displace_processors(ctx, DISPLACE_MIGRATING) == 0x1);
+  rtems_test_assert(displace_processors(ctx, DISPLACE_BOUND) == 0);
+
+  /*
+   * While the master task sleeps, the holder blocks and processor 1 becomes
+   * available.
+   */
+  _Atomic_Store_uint(&ctx->holder_release, 1, ATOMIC_ORDER_RELEASE);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(displace_processors(ctx, DISPLACE_HOLDER) == 0x2);
+  rtems_test_assert(
+    (displace_processors(ctx, DISPLACE_MIGRATING) & 0x2) != 0
+  );
+  rtems_test_assert(displace_processors(ctx, DISPLACE_BOUND) == 0x1);
+
+  /*
+   * The master task on processor 1 displaces the migrating task back to
+   * processor 0.  The first sample may be recorded on processor 0 with a
+   * processor index obtained on processor 1, so discard it.
+   */
+  (void) displace_processors(ctx, DISPLACE_MIGRATING);
+
+  while (displace_processors(ctx, DISPLACE_MIGRATING) == 0) {
+    /* Wait */
+  }
+
+  (void) displace_processors(ctx, DISPLACE_BOUND);
+
+  while (
+    _Atomic_Load_uint(
+      &ctx->displace_processors[DISPLACE_MIGRATING],
+      ATOMIC_ORDER_RELAXED
+    ) == 0
+  ) {
+    /* Wait */
+  }
+
+  rtems_test_assert(displace_processors(ctx, DISPLACE_MIGRATING) == 0x1);
+  rtems_test_assert(displace_processors(ctx, DISPLACE_BOUND) == 0);
+
+  for (i = 0; i < DISPLACE_COUNT; ++i) {
+    delete_task(ctx->displace_tasks[i]);
+  }
+
+  set_all_affinity(ctx->master);
+}
+
+static void add_fillers(test_context *ctx, size_t filler_count)
+{
+  while (ctx->filler_count < filler_count) {
+    ctx->fillers[ctx->filler_count] = create_task(
+      PRIO_FILLER_FIRST + ctx->filler_count,
+      ctx->cpu_b,
+      busy
+    );
+    ++ctx->filler_count;
+  }
+}
+
+static void measure(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t d;
+  int i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < ROUND_TRIPS; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_send(ctx->worker);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  t1 = rtems_counter_read();
+  d = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0));
+
+  printf(
+    "    <Sample fillerCount=\"%zu\">"
+      "<RoundTrip unit=\"ns\">%" PRIu64 "</RoundTrip></Sample>\n",
+    ctx->filler_count,
+    d / ROUND_TRIPS
+  );
+}
+
+static void benchmark(test_context *ctx, rtems_name scheduler_name)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+  rtems_id scheduler_id;
+  size_t i;
+
+  sc = rtems_scheduler_ident(scheduler_name, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_all_affinity(ctx->master);
+
+  sc = rtems_task_set_scheduler(ctx->master, scheduler_id, PRIO_MASTER);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->cpu_a = rtems_scheduler_get_processor();
+  ctx->cpu_b = 1 - ctx->cpu_a;
+  set_affinity(ctx->master, ctx->cpu_a);
+  rtems_test_assert(rtems_scheduler_get_processor() == ctx->cpu_a);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(prio == PRIO_MASTER);
+
+  ctx->worker = create_task(PRIO_WORKER, ctx->cpu_a, worker);
+  ctx->hog = create_task(PRIO_HOG, ctx->cpu_b, busy);
+
+  printf(
+    "  <Scheduler name=\"%c%c%c%c\">\n",
+    (char) (scheduler_name >> 24),
+    (char) (scheduler_name >> 16),
+    (char) (scheduler_name >> 8),
+    (char) scheduler_name
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(filler_counts); ++i) {
+    add_fillers(ctx, filler_counts[i]);
+    measure(ctx);
+  }
+
+  printf("  </Scheduler>\n");
+
+  for (i = 0; i < ctx->filler_count; ++i) {
+    delete_task(ctx->fillers[i]);
+  }
+
+  ctx->filler_count = 0;
+  delete_task(ctx->hog);
+  delete_task(ctx->worker);
+}
+
+static void move_processors(rtems_name from_name, rtems_name to_name)
+{
+  rtems_status_code sc;
+  rtems_id from_id;
+  rtems_id to_id;
+  uint32_t cpu_index;
+
+  sc = rtems_scheduler_ident(from_name, &from_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_ident(to_name, &to_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_index = 1 - rtems_scheduler_get_processor();
+
+  sc = rtems_scheduler_remove_processor(from_id, cpu_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_add_processor(to_id, cpu_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_all_affinity(RTEMS_SELF);
+
+  sc = rtems_task_set_scheduler(RTEMS_SELF, to_id, PRIO_MASTER);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_scheduler_get_processor() == cpu_index);
+
+  cpu_index = 1 - cpu_index;
+
+  sc = rtems_scheduler_remove_processor(from_id, cpu_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_add_processor(to_id, cpu_index);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  ctx->master = rtems_task_self();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test_displacement(ctx);
+    printf("<SMPStrongAPA02>\n");
+    benchmark(ctx, SCHED_IAPA);
+    move_processors(SCHED_IAPA, SCHED_PAFF);
+    benchmark(ctx, SCHED_PAFF);
+    printf("</SMPStrongAPA02>\n");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (3 + FILLER_MAX)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_STRONG_APA_INDEXED
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_STRONG_APA_INDEXED(a, 256);
+
+RTEMS_SCHEDULER_PRIORITY_AFFINITY_SMP(b, 256);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_STRONG_APA_INDEXED(a, SCHED_IAPA), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_AFFINITY_SMP(b, SCHED_PAFF)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
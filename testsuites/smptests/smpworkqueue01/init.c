@@ -0,0 +1,337 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/workqueue.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPWORKQUEUE 1";
+
+#define CPU_COUNT 4
+
+#define ITEM_COUNT 3
+
+#define PRIO_INIT 1
+
+#define PRIO_WORKER 2
+
+typedef struct {
+  rtems_work_item item;
+  uint32_t target;
+  uint32_t cpu_index;
+  rtems_id worker;
+  uint32_t resubmit;
+} test_item;
+
+typedef struct {
+  rtems_id init_task;
+  rtems_id timer;
+  test_item items[CPU_COUNT][ITEM_COUNT];
+  test_item *order[ITEM_COUNT + 1];
+  size_t order_count;
+} test_context;
+
+static test_context test_instance;
+
+static test_item *get_test_item(rtems_work_item *item)
+{
+  return RTEMS_CONTAINER_OF(item, test_item, item);
+}
+
+static rtems_event_set event_of_processor(uint32_t cpu_index)
+{
+  return RTEMS_EVENT_0 << cpu_index;
+}
+
+static void done(test_context *ctx, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send(ctx->init_task, event_of_processor(cpu_index));
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait(rtems_event_set events)
+{
+  rtems_status_code sc;
+  rtems_event_set received;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == events);
+}
+
+static void init_item(
+  test_item *ti,
+  rtems_work_handler handler,
+  uint32_t target
+)
+{
+  rtems_work_item_initialize(&ti->item, handler);
+  ti->target = target;
+  ti->cpu_index = UINT32_MAX;
+  ti->worker = 0;
+  ti->resubmit = 0;
+}
+
+static void record_handler(rtems_work_item *item)
+{
+  test_context *ctx = &test_instance;
+  test_item *ti = get_test_item(item);
+
+  ti->cpu_index = rtems_scheduler_get_processor();
+  ti->worker = rtems_task_self();
+  done(ctx, ti->target);
+}
+
+static void order_handler(rtems_work_item *item)
+{
+  test_context *ctx = &test_instance;
+  test_item *ti = get_test_item(item);
+  rtems_status_code sc;
+
+  rtems_test_assert(ctx->order_count < RTEMS_ARRAY_SIZE(ctx->order));
+  ctx->order[ctx->order_count] = ti;
+  ++ctx->order_count;
+
+  if (ti->resubmit > 0) {
+    --ti->resubmit;
+    sc = rtems_work_item_submit_local(item);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else if (ctx->order_count == RTEMS_ARRAY_SIZE(ctx->order)) {
+    done(ctx, ti->target);
+  }
+}
+
+static void test_not_initialized(test_context *ctx)
+{
+  rtems_status_code sc;
+  test_item *ti;
+
+  ti = &ctx->items[0][0];
+  init_item(ti, record_handler, 0);
+
+  sc = rtems_work_item_submit(&ti->item, 0);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_work_item_submit_local(&ti->item);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static void test_initialize(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_work_queue_initialize(
+    PRIO_WORKER,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_work_queue_initialize(
+    PRIO_WORKER,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static void test_invalid_processor(test_context *ctx)
+{
+  rtems_status_code sc;
+  test_item *ti;
+
+  ti = &ctx->items[0][0];
+  init_item(ti, record_handler, 0);
+
+  sc = rtems_work_item_submit(
+    &ti->item,
+    rtems_scheduler_get_processor_maximum()
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_each_processor(test_context *ctx)
+{
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_status_code sc;
+    test_item *ti;
+
+    ti = &ctx->items[cpu_index][0];
+    init_item(ti, record_handler, cpu_index);
+
+    sc = rtems_work_item_submit(&ti->item, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    wait(event_of_processor(cpu_index));
+    rtems_test_assert(ti->cpu_index == cpu_index);
+    rtems_test_assert(ti->worker != 0);
+    rtems_test_assert(ti->worker != ctx->init_task);
+  }
+}
+
+static void test_fifo_order(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t cpu_self;
+  size_t i;
+
+  ctx->order_count = 0;
+  cpu_self = rtems_scheduler_get_processor();
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    test_item *ti;
+
+    ti = &ctx->items[0][i];
+    init_item(ti, order_handler, cpu_self);
+    ti->resubmit = i == 0 ? 1 : 0;
+  }
+
+  /*
+   * The worker task of this processor has a lower priority than the init
+   * task, so the work items stay pending until the init task blocks.
+   */
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    sc = rtems_work_item_submit(&ctx->items[0][i].item, cpu_self);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_work_item_submit(&ctx->items[0][i].item, cpu_self);
+    rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+  }
+
+  wait(event_of_processor(cpu_self));
+  rtems_test_assert(ctx->order_count == ITEM_COUNT + 1);
+
+  for (i = 0; i < ITEM_COUNT; ++i) {
+    rtems_test_assert(ctx->order[i] == &ctx->items[0][i]);
+  }
+
+  rtems_test_assert(ctx->order[ITEM_COUNT] == &ctx->items[0][0]);
+}
+
+static void timer(rtems_id id, void *arg)
+{
+  test_context *ctx = arg;
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_status_code sc;
+    test_item *ti;
+
+    ti = &ctx->items[cpu_index][1];
+    init_item(ti, record_handler, cpu_index);
+
+    sc = rtems_work_item_submit(&ti->item, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_submit_from_interrupt(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_fire_after(ctx->timer, 1, timer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+  events = 0;
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    events |= event_of_processor(cpu_index);
+  }
+
+  wait(events);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_test_assert(ctx->items[cpu_index][1].cpu_index == cpu_index);
+  }
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+  ctx->init_task = rtems_task_self();
+  test_not_initialized(ctx);
+  test_initialize();
+  test_invalid_processor(ctx);
+  test_each_processor(ctx);
+  test_fifo_order(ctx);
+  test_submit_from_interrupt(ctx);
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -21,6 +21,89 @@ typedef struct {
   int x;
 } test_node;
 
+#define CACHE_TEST_NODES 40
+
+#define CACHE_TEST_BATCH 4
+
+static Freechain_Cache caches[CPU_MAXIMUM_PROCESSORS];
+
+static test_node cache_test_nodes[CACHE_TEST_NODES];
+
+static size_t cached_node_count(const Freechain_Control *fc)
+{
+    uint32_t cpu_max;
+    uint32_t cpu_index;
+    size_t count;
+
+    cpu_max = rtems_scheduler_get_processor_maximum();
+    count = 0;
+
+    for (cpu_index = 0; cpu_index < cpu_max; ++cpu_index) {
+        count += _Chain_Node_count_unprotected(&fc->caches[cpu_index].Free);
+        rtems_test_assert(
+            _Chain_Node_count_unprotected(&fc->caches[cpu_index].Free)
+                == fc->caches[cpu_index].count
+        );
+    }
+
+    return count;
+}
+
+static void test_caches(void)
+{
+    Freechain_Control fc;
+    test_node *nodes[CACHE_TEST_NODES];
+    test_node *node;
+    size_t i;
+
+    puts( "INIT - Verify freechain per-processor caches - OK" );
+
+    _Freechain_Initialize(&fc, &cache_test_nodes[0], CACHE_TEST_NODES,
+        sizeof(test_node));
+    _Freechain_Initialize_caches(&fc, &caches[0], CACHE_TEST_BATCH);
+    rtems_test_assert(cached_node_count(&fc) == 0);
+
+    /* A get operation refills the cache with one batch */
+    nodes[0] = _Freechain_Get(&fc, NULL, 0, sizeof(test_node));
+    rtems_test_assert(nodes[0] != NULL);
+    rtems_test_assert(cached_node_count(&fc) == CACHE_TEST_BATCH - 1);
+    rtems_test_assert(_Chain_Node_count_unprotected(&fc.Free)
+        == CACHE_TEST_NODES - CACHE_TEST_BATCH);
+
+    for (i = 1; i < CACHE_TEST_NODES; ++i) {
+        nodes[i] = _Freechain_Get(&fc, NULL, 0, sizeof(test_node));
+        rtems_test_assert(nodes[i] != NULL);
+    }
+
+    rtems_test_assert(_Freechain_Get(&fc, NULL, 0, sizeof(test_node)) == NULL);
+    rtems_test_assert(cached_node_count(&fc) == 0);
+    rtems_test_assert(_Freechain_Is_empty(&fc));
+
+    /* The cache keeps at most two batches */
+    for (i = 0; i < CACHE_TEST_NODES; ++i) {
+        _Freechain_Put(&fc, nodes[i]);
+        rtems_test_assert(cached_node_count(&fc) <= 2 * CACHE_TEST_BATCH);
+    }
+
+    rtems_test_assert(cached_node_count(&fc)
+        + _Chain_Node_count_unprotected(&fc.Free) == CACHE_TEST_NODES);
+
+    _Freechain_Flush_caches(&fc);
+    rtems_test_assert(cached_node_count(&fc) == 0);
+    rtems_test_assert(_Chain_Node_count_unprotected(&fc.Free)
+        == CACHE_TEST_NODES);
+
+    /* Extend an empty freechain with per-processor caches */
+    _Freechain_Initialize(&fc, NULL, 0, sizeof(test_node));
+    _Freechain_Initialize_caches(&fc, &caches[0], CACHE_TEST_BATCH);
+
+    node = _Freechain_Get(&fc, malloc, 10, sizeof(test_node));
+    rtems_test_assert(node != NULL);
+    rtems_test_assert(cached_node_count(&fc) == CACHE_TEST_BATCH - 1);
+    rtems_test_assert(_Chain_Node_count_unprotected(&fc.Free)
+        == 10 - CACHE_TEST_BATCH);
+}
+
 static rtems_task Init(rtems_task_argument ignored)
 {
     Freechain_Control fc;
@@ -61,6 +144,8 @@ static rtems_task Init(rtems_task_argument ignored)
     node = _Freechain_Get(&fc, NULL, 0, sizeof(test_node));
     rtems_test_assert(node->x == 1);
 
+    test_caches();
+
     TEST_END();
     rtems_test_exit(0);
 }
@@ -0,0 +1,629 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/posix/mqueue.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPMSGQLOAN 1";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 16
+
+typedef struct {
+  rtems_id queue;
+  rtems_id producer;
+  void *loaned;
+  bool copy;
+  mqd_t mq;
+  rtems_id loan_receiver;
+  rtems_id sender;
+  rtems_id receiver;
+  uint8_t send_value;
+  int send_status;
+  void *received_buffer;
+  ssize_t received_size;
+  uint8_t received[ MESSAGE_SIZE ];
+  ssize_t copied_size;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_id create( rtems_attribute attribute_set )
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'L', 'O', 'A', 'N' ),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    attribute_set,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void *loan( rtems_id id, uint8_t value )
+{
+  rtems_status_code sc;
+  void *buffer;
+
+  buffer = NULL;
+  sc = rtems_message_queue_loan_buffer( id, &buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( buffer != NULL );
+  memset( buffer, value, MESSAGE_SIZE );
+
+  return buffer;
+}
+
+static void check( const void *buffer, size_t size, uint8_t value )
+{
+  uint8_t expected[ MESSAGE_SIZE ];
+
+  rtems_test_assert( size == MESSAGE_SIZE );
+  memset( expected, value, sizeof( expected ) );
+  rtems_test_assert( memcmp( buffer, expected, sizeof( expected ) ) == 0 );
+}
+
+static void test_classic( void )
+{
+  rtems_status_code sc;
+  rtems_id id;
+  void *a;
+  void *b;
+  void *c;
+  uint8_t buf[ MESSAGE_SIZE ];
+  size_t size;
+
+  id = create( RTEMS_DEFAULT_ATTRIBUTES );
+
+  sc = rtems_message_queue_loan_buffer( id, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  /* Send a loaned buffer and receive it with a copy */
+  a = loan( id, 1 );
+  sc = rtems_message_queue_send_buffer( id, a, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive(
+    id,
+    buf,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  check( buf, size, 1 );
+
+  /* All buffers loaned */
+  a = loan( id, 2 );
+  b = loan( id, 3 );
+  rtems_test_assert( a != b );
+
+  sc = rtems_message_queue_loan_buffer( id, &c );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_send( id, buf, sizeof( buf ) );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  /* Invalid buffers */
+  sc = rtems_message_queue_send_buffer( id, buf, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer( id, (char *) a + 1, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer( id, a, MESSAGE_SIZE + 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  sc = rtems_message_queue_return_buffer( id, b );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_return_buffer( id, b );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  /* Receive without a copy */
+  sc = rtems_message_queue_send_buffer( id, a, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_send_buffer( id, a, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  c = NULL;
+  size = 0;
+  sc = rtems_message_queue_receive_buffer(
+    id,
+    &c,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( c == a );
+  check( c, size, 2 );
+
+  sc = rtems_message_queue_return_buffer( id, c );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Send with a copy and receive without a copy */
+  memset( buf, 4, sizeof( buf ) );
+  sc = rtems_message_queue_send( id, buf, sizeof( buf ) );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_buffer(
+    id,
+    &c,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  check( c, size, 4 );
+
+  sc = rtems_message_queue_return_buffer( id, c );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_buffer(
+    id,
+    &c,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  delete( id );
+
+  /* Lock-free ring message queues do not support loans */
+  id = create( RTEMS_MESSAGE_QUEUE_SPSC_RING );
+
+  sc = rtems_message_queue_loan_buffer( id, &c );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_message_queue_receive_buffer(
+    id,
+    &c,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  delete( id );
+}
+
+static void producer( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    if ( ctx->copy ) {
+      uint8_t buf[ MESSAGE_SIZE ];
+
+      memset( buf, 5, sizeof( buf ) );
+      sc = rtems_message_queue_send( ctx->queue, buf, sizeof( buf ) );
+    } else {
+      ctx->loaned = loan( ctx->queue, 6 );
+      sc = rtems_message_queue_send_buffer(
+        ctx->queue,
+        ctx->loaned,
+        MESSAGE_SIZE
+      );
+    }
+
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void receive_blocking( test_context *ctx, uint8_t value )
+{
+  rtems_status_code sc;
+  void *buffer;
+  size_t size;
+
+  sc = rtems_event_transient_send( ctx->producer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The producer runs once we block on the empty message queue */
+  buffer = NULL;
+  size = 0;
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  check( buffer, size, value );
+
+  if ( !ctx->copy ) {
+    rtems_test_assert( buffer == ctx->loaned );
+  }
+
+  sc = rtems_message_queue_return_buffer( ctx->queue, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_classic_blocking( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  ctx->queue = create( RTEMS_DEFAULT_ATTRIBUTES );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'O', 'D' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->producer
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start(
+    ctx->producer,
+    producer,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->copy = false;
+  receive_blocking( ctx, 6 );
+  ctx->copy = true;
+  receive_blocking( ctx, 5 );
+
+  sc = rtems_task_delete( ctx->producer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  delete( ctx->queue );
+}
+
+static void test_posix( void )
+{
+  struct mq_attr attr;
+  mqd_t mq;
+  void *a;
+  void *b;
+  unsigned int prio;
+  ssize_t n;
+  int rv;
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = MESSAGE_COUNT;
+  attr.mq_msgsize = MESSAGE_SIZE;
+
+  mq = mq_open( "/loan", O_CREAT | O_RDWR | O_NONBLOCK, 0777, &attr );
+  rtems_test_assert( mq != (mqd_t) -1 );
+
+  a = NULL;
+  rv = mq_loan_buffer_np( mq, &a );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( a != NULL );
+  memset( a, 7, MESSAGE_SIZE );
+
+  errno = 0;
+  rv = mq_send_buffer_np( mq, a, MESSAGE_SIZE, MQ_PRIO_MAX + 1 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  rv = mq_send_buffer_np( mq, a, MESSAGE_SIZE, 3 );
+  rtems_test_assert( rv == 0 );
+
+  b = NULL;
+  prio = 0;
+  n = mq_receive_buffer_np( mq, &b, &prio );
+  rtems_test_assert( n == MESSAGE_SIZE );
+  rtems_test_assert( b == a );
+  rtems_test_assert( prio == 3 );
+  check( b, (size_t) n, 7 );
+
+  rv = mq_return_buffer_np( mq, b );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = mq_return_buffer_np( mq, b );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  n = mq_receive_buffer_np( mq, &b, &prio );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == EAGAIN );
+
+  rv = mq_close( mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/loan" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void wait_for_event( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wake_up( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_send( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void loan_receiver( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    unsigned int prio;
+
+    wait_for_event();
+    ctx->received_buffer = NULL;
+    ctx->received_size = mq_receive_buffer_np(
+      ctx->mq,
+      &ctx->received_buffer,
+      &prio
+    );
+  }
+}
+
+static void sender( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    uint8_t buf[ MESSAGE_SIZE ];
+
+    wait_for_event();
+    memset( buf, ctx->send_value, sizeof( buf ) );
+    ctx->send_status = mq_send( ctx->mq, (const char *) buf, sizeof( buf ), 0 );
+  }
+}
+
+static void receiver( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    unsigned int prio;
+
+    wait_for_event();
+    ctx->copied_size = mq_receive(
+      ctx->mq,
+      (char *) ctx->received,
+      sizeof( ctx->received ),
+      &prio
+    );
+  }
+}
+
+static rtems_id start_task( test_context *ctx, rtems_task_entry entry )
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, entry, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_task( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_posix_mixed_waiters( test_context *ctx )
+{
+  struct mq_attr attr;
+  rtems_status_code sc;
+  rtems_task_priority prio;
+  void *a;
+  void *b;
+  int rv;
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = MESSAGE_COUNT;
+  attr.mq_msgsize = MESSAGE_SIZE;
+
+  ctx->mq = mq_open( "/mixed", O_CREAT | O_RDWR, 0777, &attr );
+  rtems_test_assert( ctx->mq != (mqd_t) -1 );
+
+  /* The workers shall run and block as soon as they are woken up */
+  sc = rtems_task_set_priority( RTEMS_SELF, 3, &prio );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->loan_receiver = start_task( ctx, loan_receiver );
+  ctx->sender = start_task( ctx, sender );
+  ctx->receiver = start_task( ctx, receiver );
+
+  /* All buffers loaned, so senders and receivers block at the same time */
+  a = NULL;
+  rv = mq_loan_buffer_np( ctx->mq, &a );
+  rtems_test_assert( rv == 0 );
+
+  b = NULL;
+  rv = mq_loan_buffer_np( ctx->mq, &b );
+  rtems_test_assert( rv == 0 );
+
+  ctx->received_size = -2;
+  wake_up( ctx->loan_receiver );
+  rtems_test_assert( ctx->received_size == -2 );
+
+  ctx->send_status = -2;
+  ctx->send_value = 8;
+  wake_up( ctx->sender );
+  rtems_test_assert( ctx->send_status == -2 );
+
+  /*
+   * The returned buffer carries the message of the blocked sender to the
+   * blocked receiver.  Both are unblocked.
+   */
+  rv = mq_return_buffer_np( ctx->mq, a );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( ctx->send_status == 0 );
+  rtems_test_assert( ctx->received_size == MESSAGE_SIZE );
+  rtems_test_assert( ctx->received_buffer == a );
+  check( ctx->received_buffer, (size_t) ctx->received_size, 8 );
+
+  /* A copying receiver takes the message of a blocked sender */
+  ctx->send_status = -2;
+  ctx->send_value = 9;
+  wake_up( ctx->sender );
+  rtems_test_assert( ctx->send_status == -2 );
+
+  ctx->copied_size = -2;
+  wake_up( ctx->receiver );
+  rtems_test_assert( ctx->send_status == 0 );
+  rtems_test_assert( ctx->copied_size == MESSAGE_SIZE );
+  check( ctx->received, (size_t) ctx->copied_size, 9 );
+
+  /* A committed buffer is handed over to a blocked receiver */
+  ctx->received_size = -2;
+  wake_up( ctx->loan_receiver );
+  rtems_test_assert( ctx->received_size == -2 );
+
+  memset( b, 10, MESSAGE_SIZE );
+  rv = mq_send_buffer_np( ctx->mq, b, MESSAGE_SIZE, 0 );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( ctx->received_size == MESSAGE_SIZE );
+  rtems_test_assert( ctx->received_buffer == b );
+  check( ctx->received_buffer, (size_t) ctx->received_size, 10 );
+
+  /* A copying receiver blocks behind the loaned buffers */
+  ctx->copied_size = -2;
+  wake_up( ctx->receiver );
+  rtems_test_assert( ctx->copied_size == -2 );
+
+  memset( a, 11, MESSAGE_SIZE );
+  rv = mq_send_buffer_np( ctx->mq, a, MESSAGE_SIZE, 0 );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( ctx->copied_size == MESSAGE_SIZE );
+  check( ctx->received, (size_t) ctx->copied_size, 11 );
+
+  rv = mq_return_buffer_np( ctx->mq, b );
+  rtems_test_assert( rv == 0 );
+
+  delete_task( ctx->loan_receiver );
+  delete_task( ctx->sender );
+  delete_task( ctx->receiver );
+
+  sc = rtems_task_set_priority( RTEMS_SELF, prio, &prio );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rv = mq_close( ctx->mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/mixed" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_classic();
+  test_classic_blocking( &test_instance );
+  test_posix();
+  test_posix_mixed_waiters( &test_instance );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  ( CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MESSAGE_COUNT, MESSAGE_SIZE ) \
+    + CONFIGURE_MESSAGE_BUFFERS_FOR_RING_QUEUE( MESSAGE_COUNT, MESSAGE_SIZE ) )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,460 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include <string.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPMSGQRING 1";
+
+#define MESSAGE_COUNT 4
+
+#define MESSAGE_SIZE 8
+
+#define RECEIVER_COUNT 2
+
+typedef struct {
+  rtems_id queue;
+  rtems_id consumer;
+  uint8_t value;
+  uint8_t received[ RECEIVER_COUNT ];
+  uint32_t received_count;
+  rtems_status_code status[ RECEIVER_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void fill( uint8_t *buf, uint8_t value )
+{
+  memset( buf, value, MESSAGE_SIZE );
+}
+
+static void send( rtems_id queue, uint8_t value )
+{
+  rtems_status_code sc;
+  uint8_t buf[ MESSAGE_SIZE ];
+
+  fill( buf, value );
+  sc = rtems_message_queue_send( queue, buf, sizeof( buf ) );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void receive( rtems_id queue, rtems_option options, uint8_t value )
+{
+  rtems_status_code sc;
+  uint8_t buf[ MESSAGE_SIZE ];
+  uint8_t expected[ MESSAGE_SIZE ];
+  size_t size;
+
+  size = 0;
+  sc = rtems_message_queue_receive(
+    queue,
+    buf,
+    &size,
+    options,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == MESSAGE_SIZE );
+  fill( expected, value );
+  rtems_test_assert( memcmp( buf, expected, sizeof( buf ) ) == 0 );
+}
+
+static rtems_id create( rtems_attribute attribute_set )
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'R', 'I', 'N', 'G' ),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    attribute_set,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_create_errors( void )
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'R', 'I', 'N', 'G' ),
+    3,
+    MESSAGE_SIZE,
+    RTEMS_MESSAGE_QUEUE_SPSC_RING,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'R', 'I', 'N', 'G' ),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_MESSAGE_QUEUE_SPSC_RING | RTEMS_MESSAGE_QUEUE_MPSC_RING,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+}
+
+static void test_send_receive( rtems_attribute attribute_set )
+{
+  rtems_status_code sc;
+  rtems_id id;
+  uint8_t buf[ MESSAGE_SIZE + 1 ];
+  size_t size;
+  uint32_t count;
+  uint8_t i;
+
+  id = create( attribute_set );
+
+  for ( i = 0; i < 3 * MESSAGE_COUNT; ++i ) {
+    send( id, i );
+    receive( id, RTEMS_NO_WAIT, i );
+  }
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    send( id, i );
+  }
+
+  memset( buf, 0, sizeof( buf ) );
+  sc = rtems_message_queue_send( id, buf, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_send( id, buf, sizeof( buf ) );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  sc = rtems_message_queue_urgent( id, buf, MESSAGE_SIZE );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  count = 0;
+  sc = rtems_message_queue_get_number_pending( id, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == MESSAGE_COUNT );
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    receive( id, RTEMS_NO_WAIT, i );
+  }
+
+  sc = rtems_message_queue_receive(
+    id,
+    buf,
+    &size,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  send( id, 1 );
+  send( id, 2 );
+
+  count = 0;
+  sc = rtems_message_queue_flush( id, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 2 );
+
+  sc = rtems_message_queue_get_number_pending( id, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 0 );
+
+  delete( id );
+}
+
+static void producer( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    send( ctx->queue, ctx->value );
+    ++ctx->value;
+  }
+}
+
+static void test_blocking_receive(
+  test_context    *ctx,
+  rtems_attribute  attribute_set
+)
+{
+  rtems_status_code sc;
+  rtems_id task;
+  uint8_t i;
+
+  ctx->queue = create( attribute_set );
+  ctx->value = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'O', 'D' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( task, producer, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < 2 * MESSAGE_COUNT; ++i ) {
+    sc = rtems_event_transient_send( task );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    /* The producer runs once we block on the empty ring */
+    receive( ctx->queue, RTEMS_WAIT, i );
+  }
+
+  sc = rtems_task_delete( task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  delete( ctx->queue );
+}
+
+static void receiver( rtems_task_argument arg )
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint8_t buf[ MESSAGE_SIZE ];
+  size_t size;
+
+  ctx = &test_instance;
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    buf,
+    &size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == MESSAGE_SIZE );
+
+  ctx->received[ arg ] = buf[ 0 ];
+  ++ctx->received_count;
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void test_multiple_receivers(
+  test_context    *ctx,
+  rtems_attribute  attribute_set
+)
+{
+  rtems_status_code sc;
+  rtems_task_priority priority;
+  rtems_id tasks[ RECEIVER_COUNT ];
+  uint32_t count;
+  size_t i;
+
+  ctx->queue = create( attribute_set );
+  ctx->received_count = 0;
+
+  for ( i = 0; i < RECEIVER_COUNT; ++i ) {
+    sc = rtems_task_create(
+      rtems_build_name( 'R', 'E', 'C', 'V' ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &tasks[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_start( tasks[ i ], receiver, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* Let the receivers block on the empty ring */
+  sc = rtems_task_set_priority( RTEMS_SELF, 3, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Each message must wake up exactly one receiver */
+  send( ctx->queue, 1 );
+  rtems_test_assert( ctx->received_count == 1 );
+  send( ctx->queue, 2 );
+  rtems_test_assert( ctx->received_count == 2 );
+  rtems_test_assert( ctx->received[ 0 ] != ctx->received[ 1 ] );
+  rtems_test_assert( ctx->received[ 0 ] + ctx->received[ 1 ] == 3 );
+
+  count = 0;
+  sc = rtems_message_queue_flush( ctx->queue, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 0 );
+
+  for ( i = 0; i < RECEIVER_COUNT; ++i ) {
+    sc = rtems_task_delete( tasks[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_task_set_priority( RTEMS_SELF, priority, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  delete( ctx->queue );
+}
+
+static void status_receiver( rtems_task_argument arg )
+{
+  test_context *ctx;
+  uint8_t buf[ MESSAGE_SIZE ];
+  size_t size;
+
+  ctx = &test_instance;
+  ctx->status[ arg ] = rtems_message_queue_receive(
+    ctx->queue,
+    buf,
+    &size,
+    RTEMS_WAIT,
+    arg == 0 ? 1 : RTEMS_NO_TIMEOUT
+  );
+  ++ctx->received_count;
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void test_delete_with_receivers(
+  test_context    *ctx,
+  rtems_attribute  attribute_set
+)
+{
+  rtems_status_code sc;
+  rtems_task_priority priority;
+  rtems_id tasks[ RECEIVER_COUNT ];
+  uint8_t buf[ MESSAGE_SIZE ];
+  uint32_t count;
+  size_t i;
+
+  ctx->queue = create( attribute_set );
+  ctx->received_count = 0;
+
+  for ( i = 0; i < RECEIVER_COUNT; ++i ) {
+    sc = rtems_task_create(
+      rtems_build_name( 'R', 'E', 'C', 'V' ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &tasks[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_start( tasks[ i ], status_receiver, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* Let the receivers block on the empty ring */
+  sc = rtems_task_set_priority( RTEMS_SELF, 3, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The first receiver times out and does not access the ring afterwards */
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received_count == 1 );
+  rtems_test_assert( ctx->status[ 0 ] == RTEMS_TIMEOUT );
+
+  /* The deletion wakes up the remaining receiver */
+  delete( ctx->queue );
+  rtems_test_assert( ctx->received_count == 2 );
+  rtems_test_assert( ctx->status[ 1 ] == RTEMS_OBJECT_WAS_DELETED );
+
+  fill( buf, 0 );
+  sc = rtems_message_queue_send( ctx->queue, buf, sizeof( buf ) );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_message_queue_get_number_pending( ctx->queue, &count );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  for ( i = 0; i < RECEIVER_COUNT; ++i ) {
+    sc = rtems_task_delete( tasks[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_task_set_priority( RTEMS_SELF, priority, &priority );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_create_errors();
+  test_send_receive( RTEMS_MESSAGE_QUEUE_SPSC_RING );
+  test_send_receive( RTEMS_MESSAGE_QUEUE_MPSC_RING );
+  test_blocking_receive( ctx, RTEMS_MESSAGE_QUEUE_SPSC_RING );
+  test_blocking_receive( ctx, RTEMS_MESSAGE_QUEUE_MPSC_RING | RTEMS_PRIORITY );
+  test_multiple_receivers( ctx, RTEMS_MESSAGE_QUEUE_SPSC_RING );
+  test_multiple_receivers( ctx, RTEMS_MESSAGE_QUEUE_MPSC_RING );
+  test_delete_with_receivers( ctx, RTEMS_MESSAGE_QUEUE_SPSC_RING );
+  test_delete_with_receivers( ctx, RTEMS_MESSAGE_QUEUE_MPSC_RING );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_RING_QUEUE( MESSAGE_COUNT, MESSAGE_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
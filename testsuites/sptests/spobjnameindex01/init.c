@@ -0,0 +1,217 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include <fcntl.h>
+#include <semaphore.h>
+#include <stdio.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPOBJNAMEINDEX 1";
+
+#define SEMAPHORE_COUNT 40
+
+static rtems_id semaphores[ SEMAPHORE_COUNT ];
+
+static rtems_name semaphore_name( int i )
+{
+  return rtems_build_name( 'S', 'M', '0' + i / 10, '0' + i % 10 );
+}
+
+static void create_semaphore( int i, rtems_name name )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    name,
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &semaphores[ i ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void delete_semaphore( int i )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete( semaphores[ i ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  semaphores[ i ] = 0;
+}
+
+static rtems_status_code ident( rtems_name name, rtems_id *id )
+{
+  return rtems_semaphore_ident( name, RTEMS_SEARCH_LOCAL_NODE, id );
+}
+
+static void test_classic( void )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  int               i;
+
+  /* Enough semaphores to extend the information several times */
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    create_semaphore( i, semaphore_name( i ) );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    sc = ident( semaphore_name( i ), &id );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    rtems_test_assert( id == semaphores[ i ] );
+  }
+
+  sc = ident( rtems_build_name( 'N', 'O', 'N', 'E' ), &id );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+
+  /* Delete every other semaphore to exercise the removal */
+  for ( i = 0; i < SEMAPHORE_COUNT; i += 2 ) {
+    delete_semaphore( i );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    sc = ident( semaphore_name( i ), &id );
+
+    if ( i % 2 == 0 ) {
+      rtems_test_assert( sc == RTEMS_INVALID_NAME );
+    } else {
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+      rtems_test_assert( id == semaphores[ i ] );
+    }
+  }
+
+  /* Duplicate names must yield the object with the lowest index */
+  for ( i = 0; i < SEMAPHORE_COUNT; i += 2 ) {
+    create_semaphore( i, rtems_build_name( 'D', 'U', 'P', ' ' ) );
+  }
+
+  sc = ident( rtems_build_name( 'D', 'U', 'P', ' ' ), &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == semaphores[ 0 ] );
+
+  delete_semaphore( 0 );
+
+  sc = ident( rtems_build_name( 'D', 'U', 'P', ' ' ), &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == semaphores[ 2 ] );
+
+  /* Renamed objects must be found by the new name only */
+  sc = rtems_object_set_name( semaphores[ 1 ], "NEW1" );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = ident( semaphore_name( 1 ), &id );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+
+  sc = ident( rtems_build_name( 'N', 'E', 'W', '1' ), &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == semaphores[ 1 ] );
+
+  for ( i = 1; i < SEMAPHORE_COUNT; ++i ) {
+    if ( semaphores[ i ] != 0 ) {
+      delete_semaphore( i );
+    }
+  }
+
+  sc = ident( rtems_build_name( 'D', 'U', 'P', ' ' ), &id );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+}
+
+static void test_posix( void )
+{
+  sem_t *sems[ SEMAPHORE_COUNT ];
+  char   name[ 16 ];
+  int    rv;
+  int    i;
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    snprintf( name, sizeof( name ), "/sem%i", i );
+    sems[ i ] = sem_open( name, O_CREAT | O_EXCL, 0777, 0 );
+    rtems_test_assert( sems[ i ] != SEM_FAILED );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    sem_t *sem;
+
+    snprintf( name, sizeof( name ), "/sem%i", i );
+    sem = sem_open( name, 0 );
+    rtems_test_assert( sem == sems[ i ] );
+
+    rv = sem_close( sem );
+    rtems_test_assert( rv == 0 );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    snprintf( name, sizeof( name ), "/sem%i", i );
+    rv = sem_unlink( name );
+    rtems_test_assert( rv == 0 );
+
+    rv = sem_close( sems[ i ] );
+    rtems_test_assert( rv == 0 );
+
+    rtems_test_assert( sem_open( name, 0 ) == SEM_FAILED );
+  }
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_classic();
+  test_posix();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited( 4 )
+
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES rtems_resource_unlimited( 4 )
+
+#define CONFIGURE_MEMORY_OVERHEAD 64
+
+#define CONFIGURE_OBJECTS_NAME_INDEX
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
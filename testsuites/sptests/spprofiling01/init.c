@@ -113,6 +113,65 @@ static void test_iterate(void)
   rtems_interrupt_lock_destroy(&ctx->d);
 }
 
+typedef struct {
+  uint64_t counts[RTEMS_PROFILING_THREAD_DISPATCH + 1];
+} scheduler_operation_context;
+
+static void scheduler_operation_visitor(
+  void *arg,
+  const rtems_profiling_data *data
+)
+{
+  scheduler_operation_context *ctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_SCHEDULER_OPERATION) {
+    const rtems_profiling_scheduler_operation *op = &data->scheduler_operation;
+    uint64_t count = 0;
+    size_t i;
+
+    rtems_test_assert(op->operation <= RTEMS_PROFILING_THREAD_DISPATCH);
+    rtems_test_assert(op->scheduler_name != 0);
+
+    for (i = 0; i < RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS; ++i) {
+      if (i > 0) {
+        rtems_test_assert(
+          op->histogram_limits[i - 1] <= op->histogram_limits[i]
+        );
+      }
+
+      count += op->histogram[i];
+    }
+
+    rtems_test_assert(count == op->count);
+    rtems_test_assert(
+      op->histogram_limits[RTEMS_PROFILING_LATENCY_HISTOGRAM_BINS - 1]
+        == UINT32_MAX
+    );
+
+    ctx->counts[op->operation] += op->count;
+  }
+}
+
+static void test_scheduler_operations(void)
+{
+  scheduler_operation_context ctx;
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(&ctx, 0, sizeof(ctx));
+  rtems_profiling_iterate(scheduler_operation_visitor, &ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx.counts[RTEMS_PROFILING_SCHEDULER_BLOCK] > 0);
+  rtems_test_assert(ctx.counts[RTEMS_PROFILING_SCHEDULER_UNBLOCK] > 0);
+  rtems_test_assert(ctx.counts[RTEMS_PROFILING_THREAD_DISPATCH] > 0);
+#else
+  rtems_test_assert(ctx.counts[RTEMS_PROFILING_SCHEDULER_BLOCK] == 0);
+#endif
+}
+
 static void test_report_xml(void)
 {
   rtems_status_code sc;
@@ -130,6 +189,7 @@ static void Init(rtems_task_argument arg)
   TEST_BEGIN();
 
   test_iterate();
+  test_scheduler_operations();
   test_report_xml();
 
   TEST_END();
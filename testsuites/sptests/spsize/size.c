@@ -363,9 +363,6 @@ uninitialized =
 /*thread.h*/    (sizeof _Thread_Dispatch_disable_level)   +
                 (sizeof _Thread_Executing)                +
                 (sizeof _Thread_Heir)                     +
-#if (CPU_HARDWARE_FP == 1) || (CPU_SOFTWARE_FP == 1)
-                (sizeof _Thread_Allocated_fp)             +
-#endif
                 (sizeof _Thread_Information)     +
 
 /*threadq.h*/
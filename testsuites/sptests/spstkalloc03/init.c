@@ -0,0 +1,258 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/stackpool.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPSTKALLOC 3";
+
+#define TASK_COUNT 4
+
+#define POOL_MAXIMUM 1
+
+static Stack_Pool_Statistics stats;
+
+static void get_delta( Stack_Pool_Statistics *delta )
+{
+  Stack_Pool_Statistics current;
+
+  _Stack_Pool_Get_statistics( &current );
+  delta->slab_size = current.slab_size;
+  delta->stack_size = current.stack_size;
+  delta->maximum_free_slabs = current.maximum_free_slabs;
+  delta->free_slabs = current.free_slabs;
+  delta->hits = current.hits - stats.hits;
+  delta->misses = current.misses - stats.misses;
+  delta->oversized = current.oversized - stats.oversized;
+  delta->overflows = current.overflows - stats.overflows;
+  stats = current;
+}
+
+static void task( rtems_task_argument arg )
+{
+  (void) arg;
+  rtems_task_exit();
+}
+
+static rtems_id create_task( size_t stack_size )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'T', 'A', 'S', 'K' ),
+    RTEMS_MAXIMUM_PRIORITY,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_task( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_recycle( void )
+{
+  Stack_Pool_Statistics delta;
+  rtems_id              id;
+
+  _Stack_Pool_Get_statistics( &stats );
+  rtems_test_assert( stats.slab_size >= RTEMS_MINIMUM_STACK_SIZE );
+  rtems_test_assert( stats.stack_size >= RTEMS_MINIMUM_STACK_SIZE );
+  rtems_test_assert( stats.slab_size > stats.stack_size );
+  rtems_test_assert( stats.maximum_free_slabs == POOL_MAXIMUM );
+  rtems_test_assert( stats.free_slabs == 0 );
+  rtems_test_assert( stats.misses > 0 );
+
+  id = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  get_delta( &delta );
+  rtems_test_assert( delta.hits == 0 );
+  rtems_test_assert( delta.misses == 1 );
+  rtems_test_assert( delta.free_slabs == 0 );
+
+  /* The stack of a deleted task is freed during the next task create */
+  delete_task( id );
+  id = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  get_delta( &delta );
+  rtems_test_assert( delta.hits == 1 );
+  rtems_test_assert( delta.misses == 0 );
+  rtems_test_assert( delta.free_slabs == 0 );
+
+  delete_task( id );
+}
+
+static void test_oversized( void )
+{
+  Stack_Pool_Statistics delta;
+  rtems_id              id;
+
+  id = create_task( 2 * stats.slab_size );
+  get_delta( &delta );
+  rtems_test_assert( delta.oversized == 1 );
+  rtems_test_assert( delta.hits == 0 );
+  rtems_test_assert( delta.misses == 0 );
+  rtems_test_assert( delta.free_slabs == 1 );
+
+  /* Oversized stacks are not recycled */
+  delete_task( id );
+  id = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  get_delta( &delta );
+  rtems_test_assert( delta.oversized == 0 );
+  rtems_test_assert( delta.hits == 1 );
+  rtems_test_assert( delta.misses == 0 );
+  rtems_test_assert( delta.overflows == 0 );
+  rtems_test_assert( delta.free_slabs == 0 );
+
+  delete_task( id );
+}
+
+static void test_barely_oversized( void )
+{
+  Stack_Pool_Statistics  delta;
+  void                  *stack;
+
+  get_delta( &delta );
+
+  /* An oversized stack area may be barely larger than a slab */
+  stack = _Stack_Pool_Allocate( stats.stack_size + 1 );
+  rtems_test_assert( stack != NULL );
+  get_delta( &delta );
+  rtems_test_assert( delta.oversized == 1 );
+  rtems_test_assert( delta.misses == 0 );
+
+  _Stack_Pool_Free( stack );
+  get_delta( &delta );
+  rtems_test_assert( delta.overflows == 0 );
+
+  /* A slab is recycled regardless of the size of the workspace block */
+  stack = _Stack_Pool_Allocate( stats.stack_size );
+  rtems_test_assert( stack != NULL );
+  get_delta( &delta );
+  rtems_test_assert( delta.misses == 1 );
+
+  _Stack_Pool_Free( stack );
+  get_delta( &delta );
+  rtems_test_assert( delta.free_slabs == 1 );
+  rtems_test_assert( delta.overflows == 0 );
+
+  stack = _Stack_Pool_Allocate( 1 );
+  get_delta( &delta );
+  rtems_test_assert( delta.hits == 1 );
+  rtems_test_assert( delta.free_slabs == 0 );
+
+  _Stack_Pool_Free( stack );
+  get_delta( &delta );
+  rtems_test_assert( delta.free_slabs == 1 );
+}
+
+static void test_overflow( void )
+{
+  Stack_Pool_Statistics delta;
+  rtems_id              id[ TASK_COUNT - 1 ];
+  size_t                i;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( id ) - 1; ++i ) {
+    id[ i ] = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  }
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( id ) - 1; ++i ) {
+    delete_task( id[ i ] );
+  }
+
+  get_delta( &delta );
+  rtems_test_assert( delta.hits == 1 );
+  rtems_test_assert( delta.misses == RTEMS_ARRAY_SIZE( id ) - 2 );
+
+  /* Only POOL_MAXIMUM slabs are kept in the pool */
+  id[ 0 ] = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  get_delta( &delta );
+  rtems_test_assert( delta.hits == 1 );
+  rtems_test_assert( delta.misses == 0 );
+  rtems_test_assert( delta.overflows == RTEMS_ARRAY_SIZE( id ) - 2 );
+  rtems_test_assert( delta.free_slabs == 0 );
+
+  delete_task( id[ 0 ] );
+}
+
+static void test_task_start( void )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  id = create_task( RTEMS_MINIMUM_STACK_SIZE );
+  sc = rtems_task_start( id, task, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+  test_recycle();
+  test_oversized();
+  test_overflow();
+  test_task_start();
+  test_barely_oversized();
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS TASK_COUNT
+
+#define CONFIGURE_TASK_STACK_POOL_MAXIMUM POOL_MAXIMUM
+
+#define CONFIGURE_TASK_STACK_POOL_GUARD_SIZE 64
+
+#define CONFIGURE_EXTRA_TASK_STACKS ( 4 * RTEMS_MINIMUM_STACK_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,205 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH (http://www.embedded-brains.de)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include <time.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPTICKLESS 1";
+
+#define US_PER_TICK 10000
+
+#define LONG_IDLE_TICKS 30
+
+#define TIMER_COUNT 8
+
+static rtems_id timer_ids[ TIMER_COUNT ];
+
+static uint32_t timer_fired;
+
+static uint64_t get_uptime_us( void )
+{
+  struct timespec uptime;
+
+  rtems_clock_get_uptime( &uptime );
+
+  return (uint64_t) uptime.tv_sec * 1000000 + (uint64_t) uptime.tv_nsec / 1000;
+}
+
+static void check_ticks_and_uptime(
+  rtems_interval ticks_start,
+  uint64_t       uptime_start,
+  rtems_interval min_ticks
+)
+{
+  rtems_interval ticks;
+  uint64_t       uptime;
+  uint64_t       expected;
+
+  ticks = rtems_clock_get_ticks_since_boot() - ticks_start;
+  uptime = get_uptime_us() - uptime_start;
+  rtems_test_assert( ticks >= min_ticks );
+
+  /*
+   * The ticks skipped during an idle period must be caught up, so the tick
+   * count must follow the uptime within one tick in both directions.
+   */
+  expected = uptime / US_PER_TICK;
+  rtems_test_assert( ticks + 1 >= expected );
+  rtems_test_assert( ticks <= expected + 1 );
+}
+
+static void test_long_idle( void )
+{
+  rtems_status_code sc;
+  rtems_interval    ticks_start;
+  uint64_t          uptime_start;
+
+  /* The idle period exceeds the maximum one-shot clock event interval */
+  ticks_start = rtems_clock_get_ticks_since_boot();
+  uptime_start = get_uptime_us();
+  sc = rtems_task_wake_after( LONG_IDLE_TICKS );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  check_ticks_and_uptime( ticks_start, uptime_start, LONG_IDLE_TICKS );
+}
+
+static void test_short_idle( void )
+{
+  rtems_interval i;
+
+  for ( i = 0; i < 10; ++i ) {
+    rtems_status_code sc;
+    rtems_interval    ticks_start;
+    uint64_t          uptime_start;
+
+    ticks_start = rtems_clock_get_ticks_since_boot();
+    uptime_start = get_uptime_us();
+    sc = rtems_task_wake_after( 1 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    check_ticks_and_uptime( ticks_start, uptime_start, 1 );
+  }
+}
+
+static void test_nanosleep( void )
+{
+  struct timespec delay;
+  uint64_t        uptime_start;
+  uint64_t        uptime;
+  int             rv;
+
+  delay.tv_sec = 0;
+  delay.tv_nsec = US_PER_TICK * 1000 / 4;
+  uptime_start = get_uptime_us();
+  rv = nanosleep( &delay, NULL );
+  rtems_test_assert( rv == 0 );
+  uptime = get_uptime_us() - uptime_start;
+  rtems_test_assert( uptime >= US_PER_TICK / 4 );
+}
+
+static rtems_timer_service_routine timer_routine(
+  rtems_id  id,
+  void     *arg
+)
+{
+  ++timer_fired;
+}
+
+static void test_timers( void )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+  size_t            i;
+
+  /*
+   * Timers with the same and with different expiration ticks must all fire,
+   * so no clock event may be lost.
+   */
+  for ( i = 0; i < TIMER_COUNT; ++i ) {
+    sc = rtems_timer_create(
+      rtems_build_name( 'T', 'I', 'M', '0' + i ),
+      &timer_ids[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_timer_fire_after(
+      timer_ids[ i ],
+      1 + i / 2,
+      timer_routine,
+      NULL
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_event_receive(
+    RTEMS_EVENT_0,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    TIMER_COUNT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_TIMEOUT );
+  rtems_test_assert( timer_fired == TIMER_COUNT );
+
+  for ( i = 0; i < TIMER_COUNT; ++i ) {
+    sc = rtems_timer_delete( timer_ids[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+  test_long_idle();
+  test_short_idle();
+  test_nanosleep();
+  test_timers();
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MICROSECONDS_PER_TICK US_PER_TICK
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS TIMER_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -33,7 +33,7 @@ static void test(void)
   rtems_test_assert(read_write_small == 0xdeadbeefUL);
   rtems_test_assert(read_only_small == 0x601dc0feUL);
 
-  rtems_test_assert(executing->Start.tls_area == NULL);
+  rtems_test_assert(executing->Cold->Start.tls_area == NULL);
 }
 
 static void Init(rtems_task_argument arg)
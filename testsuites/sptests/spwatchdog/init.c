@@ -231,6 +231,89 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static uint64_t test_watchdog_tick_wheel(
+  Watchdog_Header *header,
+  uint64_t         now
+)
+{
+  ISR_LOCK_DEFINE( , lock, "Test" )
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+  ++now;
+  _Watchdog_Tickle_wheel( header, now, &lock, &lock_context );
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+
+  return now;
+}
+
+static void test_watchdog_wheel( void )
+{
+  static Watchdog_Wheel wheel;
+  Watchdog_Header header;
+  uint64_t now;
+  uint64_t far;
+  test_watchdog a;
+  test_watchdog b;
+  test_watchdog c;
+  test_watchdog d;
+
+  /* Start close to the overflow chain boundary */
+  far = UINT64_C( 1 )
+    << ( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT );
+  now = far - 3;
+
+  _Watchdog_Header_initialize( &header );
+  _Watchdog_Header_initialize_wheel( &header, &wheel, now );
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+  test_watchdog_init( &c, 30 );
+  test_watchdog_init( &d, 40 );
+
+  /* An expiration time in the past expires with the next tick */
+  _Watchdog_Insert( &header, &a.Base, now - 1 );
+  rtems_test_assert( !test_watchdog_is_inactive( &a ) ) ;
+
+  _Watchdog_Insert( &header, &b.Base, now + 100 );
+  _Watchdog_Insert( &header, &c.Base, now + 5000 );
+  _Watchdog_Insert( &header, &d.Base, now + 2 * far );
+
+  now = test_watchdog_tick_wheel( &header, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) ) ;
+  rtems_test_assert( a.counter == 11 );
+
+  /* Cancel and insert again */
+  _Watchdog_Remove( &header, &b.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) ) ;
+  _Watchdog_Remove( &header, &b.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) ) ;
+  _Watchdog_Insert( &header, &b.Base, now + 200 );
+
+  while ( b.counter == 20 ) {
+    now = test_watchdog_tick_wheel( &header, now );
+  }
+
+  rtems_test_assert( now == b.Base.expire );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) ) ;
+  rtems_test_assert( c.counter == 30 );
+
+  while ( c.counter == 30 ) {
+    now = test_watchdog_tick_wheel( &header, now );
+  }
+
+  rtems_test_assert( now == c.Base.expire );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) ) ;
+  rtems_test_assert( !test_watchdog_is_inactive( &d ) ) ;
+
+  _Watchdog_Remove( &header, &d.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &d ) ) ;
+  rtems_test_assert( d.counter == 40 );
+
+  _Watchdog_Header_destroy( &header );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -241,6 +324,7 @@ rtems_task Init(
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel();
   test_watchdog_static_init();
   test_watchdog_config();
 
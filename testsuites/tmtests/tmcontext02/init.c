@@ -0,0 +1,239 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 123
+
+#define PRIO_HIGH 1
+
+#define PRIO_NORMAL 2
+
+const char rtems_test_name[] = "TMCONTEXT 2";
+
+typedef enum {
+  ENV_NORMAL,
+  ENV_DIRTY_DATA,
+  ENV_DIRTY_ALL
+} test_environment;
+
+static const char * const environment_names[] = {
+  "normal",
+  "dirtyData",
+  "dirtyAll"
+};
+
+static rtems_counter_ticks t[SAMPLES];
+
+static size_t cache_line_size;
+
+static size_t data_size;
+
+static volatile int *main_data;
+
+static rtems_id worker_id;
+
+static volatile rtems_counter_ticks worker_begin;
+
+static int dirty_data_cache(volatile int *data, size_t n, size_t clsz, int j)
+{
+  size_t m = n / sizeof(*data);
+  size_t k = clsz / sizeof(*data);
+  size_t i;
+
+  for (i = 0; i < m; i += k) {
+    data[i] = i + j;
+  }
+
+  return i + j;
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    worker_begin = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void sort_t(void)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+}
+
+/*
+ * Each sample measures the time from the event send in the normal priority
+ * task until the high priority worker returns from its blocking event
+ * receive.  This includes the thread queue and scheduler operations to
+ * unblock the worker and the thread dispatch to it.  The worker thread control
+ * block was not used since the last sample, so in the dirty environments its
+ * cache lines are likely evicted.
+ */
+static void test(test_environment env)
+{
+  int s;
+  int j;
+  uint64_t min;
+  uint64_t q1;
+  uint64_t q2;
+  uint64_t q3;
+  uint64_t max;
+
+  j = 0;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_status_code sc;
+    rtems_counter_ticks a;
+
+    if (env != ENV_NORMAL) {
+      j = dirty_data_cache(main_data, data_size, cache_line_size, j);
+
+      if (env == ENV_DIRTY_ALL) {
+        rtems_cache_invalidate_entire_instruction();
+      }
+    }
+
+    a = rtems_counter_read();
+    sc = rtems_event_transient_send(worker_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    t[s] = rtems_counter_difference(worker_begin, a);
+  }
+
+  sort_t();
+
+  min = t[0];
+  q1 = t[(1 * SAMPLES) / 4];
+  q2 = t[SAMPLES / 2];
+  q3 = t[(3 * SAMPLES) / 4];
+  max = t[SAMPLES - 1];
+
+  printf(
+    "  <DispatchLatencyTest environment=\"%s\">\n"
+    "    <Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q1 unit=\"ns\">%" PRIu64 "</Q1>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Q3 unit=\"ns\">%" PRIu64 "</Q3>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>\n"
+    "  </DispatchLatencyTest>\n",
+    environment_names[env],
+    rtems_counter_ticks_to_nanoseconds(min),
+    rtems_counter_ticks_to_nanoseconds(q1),
+    rtems_counter_ticks_to_nanoseconds(q2),
+    rtems_counter_ticks_to_nanoseconds(q3),
+    rtems_counter_ticks_to_nanoseconds(max)
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  TEST_BEGIN();
+
+  cache_line_size = rtems_cache_get_data_line_size();
+  if (cache_line_size == 0) {
+    cache_line_size = 32;
+  }
+
+  data_size = rtems_cache_get_data_cache_size(0);
+  if (data_size == 0) {
+    data_size = cache_line_size;
+  }
+
+  main_data = malloc(data_size);
+  rtems_test_assert(main_data != NULL);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, PRIO_NORMAL, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    PRIO_HIGH,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(worker_id, worker_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<Test>\n");
+
+  test(ENV_NORMAL);
+  test(ENV_DIRTY_DATA);
+  test(ENV_DIRTY_ALL);
+
+  printf("</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/*
+ * Do not use a clock driver, since this will disturb the test in the "normal"
+ * environment.
+ */
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_NORMAL
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2020 embedded brains GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 123
+
+#define PRIO_HIGH 2
+
+#define PRIO_NORMAL 3
+
+#define PRIO_LOW 4
+
+const char rtems_test_name[] = "TMCONTEXT 3";
+
+typedef enum {
+  ENV_NO_FP,
+  ENV_FP_UNUSED,
+  ENV_FP_USED
+} test_environment;
+
+static const char * const environment_names[] = {
+  "noFP",
+  "fpUnused",
+  "fpUsed"
+};
+
+static rtems_counter_ticks t[SAMPLES];
+
+static rtems_id init_id;
+
+static rtems_id worker_id;
+
+static volatile rtems_counter_ticks worker_begin;
+
+static volatile double fp_data = 1.0;
+
+static void use_fp(void)
+{
+  fp_data = fp_data * 1.000001 + 0.5;
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_environment env = (test_environment) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    if (env == ENV_FP_USED) {
+      use_fp();
+    }
+
+    worker_begin = rtems_counter_read();
+  }
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void sort_t(void)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+}
+
+/*
+ * Each sample measures the time from the event send in the normal priority
+ * master task until the high priority worker could use the floating point
+ * unit after its blocking event receive.  Both tasks have the same floating
+ * point attribute.  In the used environment, both tasks use the floating point
+ * unit in each sample, so that the floating point context must be switched
+ * on each thread dispatch.  In the unused environment, the tasks are floating
+ * point tasks which do not use the floating point unit.
+ */
+static void master_task(rtems_task_argument arg)
+{
+  test_environment env = (test_environment) arg;
+  rtems_status_code sc;
+  int s;
+  uint64_t min;
+  uint64_t q1;
+  uint64_t q2;
+  uint64_t q3;
+  uint64_t max;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_counter_ticks a;
+
+    if (env == ENV_FP_USED) {
+      use_fp();
+    }
+
+    a = rtems_counter_read();
+    sc = rtems_event_transient_send(worker_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    t[s] = rtems_counter_difference(worker_begin, a);
+  }
+
+  sort_t();
+
+  min = t[0];
+  q1 = t[(1 * SAMPLES) / 4];
+  q2 = t[SAMPLES / 2];
+  q3 = t[(3 * SAMPLES) / 4];
+  max = t[SAMPLES - 1];
+
+  printf(
+    "  <SwitchLatencyTest environment=\"%s\">\n"
+    "    <Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q1 unit=\"ns\">%" PRIu64 "</Q1>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Q3 unit=\"ns\">%" PRIu64 "</Q3>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>\n"
+    "  </SwitchLatencyTest>\n",
+    environment_names[env],
+    rtems_counter_ticks_to_nanoseconds(min),
+    rtems_counter_ticks_to_nanoseconds(q1),
+    rtems_counter_ticks_to_nanoseconds(q2),
+    rtems_counter_ticks_to_nanoseconds(q3),
+    rtems_counter_ticks_to_nanoseconds(max)
+  );
+
+  sc = rtems_event_transient_send(init_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_exit();
+}
+
+static void test(test_environment env)
+{
+  rtems_status_code sc;
+  rtems_attribute attr;
+  rtems_id master_id;
+
+  attr = env == ENV_NO_FP ? RTEMS_DEFAULT_ATTRIBUTES : RTEMS_FLOATING_POINT;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    PRIO_HIGH,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    attr,
+    &worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(worker_id, worker_task, env);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('M', 'A', 'S', 'T'),
+    PRIO_NORMAL,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    attr,
+    &master_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(master_id, master_task, env);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(worker_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  TEST_BEGIN();
+
+  init_id = rtems_task_self();
+
+  sc = rtems_task_set_priority(RTEMS_SELF, PRIO_LOW, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<Test>\n");
+
+  test(ENV_NO_FP);
+  test(ENV_FP_UNUSED);
+  test(ENV_FP_USED);
+
+  printf("</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/*
+ * Do not use a clock driver, since this will disturb the test.
+ */
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_LOW
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>